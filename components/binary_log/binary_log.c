@@ -0,0 +1,168 @@
+/**
+ * @file binary_log.c
+ * @brief Implements binary log ring and its decoding
+ */
+#include "binary_log.h"
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+
+#define RING_SIZE CONFIG_BINARY_LOG_RING_SIZE
+
+static binary_log_record_t ring[RING_SIZE];
+static uint32_t next_index = 0;     //< total number of written records, slot is next_index % ring size
+static uint32_t first_index = 0;    //< index of the oldest record not discarded by binary_log_clear()
+static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+static const char level_letters[] = { 'N', 'E', 'W', 'I', 'D', 'V' };
+
+void binary_log_write(esp_log_level_t level, const char *tag, const char *format, unsigned argc, ...){
+    binary_log_record_t record = {
+        .timestamp = esp_log_timestamp(),
+        .tag = tag,
+        .format = format,
+        .level = level,
+        .argc = (argc < BINARY_LOG_MAX_ARGS) ? argc : BINARY_LOG_MAX_ARGS
+    };
+    va_list args;
+    va_start(args, argc);
+    for(unsigned i = 0; i < record.argc; i++){
+        record.args[i] = va_arg(args, uint32_t);
+    }
+    va_end(args);
+
+    portENTER_CRITICAL_SAFE(&lock);
+    ring[next_index % RING_SIZE] = record;
+    next_index++;
+    portEXIT_CRITICAL_SAFE(&lock);
+}
+
+void binary_log_clear(){
+    portENTER_CRITICAL(&lock);
+    first_index = next_index;
+    portEXIT_CRITICAL(&lock);
+}
+
+/**
+ * @brief Returns range of records currently held in ring
+ *
+ * @param[out] first index of the oldest record
+ * @param[out] lost number of records overwritten since last clear
+ * @return uint32_t index after the newest record
+ */
+static uint32_t ring_range(uint32_t *first, uint32_t *lost){
+    portENTER_CRITICAL(&lock);
+    uint32_t end = next_index;
+    uint32_t start = first_index;
+    portEXIT_CRITICAL(&lock);
+    *first = ((end - start) > RING_SIZE) ? end - RING_SIZE : start;
+    *lost = *first - start;
+    return end;
+}
+
+/**
+ * @brief Copies record out of ring
+ *
+ * @return true if record was still in ring, false if it was overwritten meanwhile
+ */
+static bool ring_read(uint32_t index, binary_log_record_t *record){
+    portENTER_CRITICAL(&lock);
+    bool valid = (next_index - index) <= RING_SIZE;
+    if(valid){
+        *record = ring[index % RING_SIZE];
+    }
+    portEXIT_CRITICAL(&lock);
+    return valid;
+}
+
+/**
+ * @brief Checks that all conversions in format consume one integer argument each, so it's safe to pass it to snprintf
+ */
+static bool format_is_safe(const char *format, unsigned argc){
+    unsigned conversions = 0;
+    for(const char *c = format; *c != '\0'; c++){
+        if(*c != '%'){
+            continue;
+        }
+        c++;
+        if(*c == '%'){
+            continue;
+        }
+        while((*c != '\0') && (strchr("-+ #0123456789.", *c) != NULL)){
+            c++;
+        }
+        if((*c == 'h') || (*c == 'l')){
+            c += ((c[1] == 'h') && (*c == 'h')) ? 2 : 1;
+        }
+        if((*c == '\0') || (strchr("diuxXocp", *c) == NULL)){
+            return false;
+        }
+        conversions++;
+    }
+    return conversions <= argc;
+}
+
+esp_err_t binary_log_write_text(binary_log_text_writer_t writer, void *ctx){
+    char line[160];
+    uint32_t first;
+    uint32_t lost;
+    uint32_t end = ring_range(&first, &lost);
+    esp_err_t err;
+    if(lost > 0){
+        snprintf(line, sizeof(line), "%u records lost\n", lost);
+        if((err = writer(ctx, line)) != ESP_OK){
+            return err;
+        }
+    }
+    for(uint32_t i = first; i < end; i++){
+        binary_log_record_t record;
+        if(!ring_read(i, &record)){
+            continue;
+        }
+        char level = (record.level < sizeof(level_letters)) ? level_letters[record.level] : '?';
+        int length = snprintf(line, sizeof(line), "%c (%u) %s: ", level, record.timestamp, record.tag);
+        if(format_is_safe(record.format, record.argc)){
+            snprintf(&line[length], sizeof(line) - length, record.format,
+                record.args[0], record.args[1], record.args[2], record.args[3]);
+        }
+        else {
+            snprintf(&line[length], sizeof(line) - length, "%s [%08x %08x %08x %08x]", record.format,
+                record.args[0], record.args[1], record.args[2], record.args[3]);
+        }
+        length = strlen(line);
+        if(length > sizeof(line) - 2){
+            length = sizeof(line) - 2;
+        }
+        line[length] = '\n';
+        line[length + 1] = '\0';
+        if((err = writer(ctx, line)) != ESP_OK){
+            return err;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t binary_log_write_raw(binary_log_raw_writer_t writer, void *ctx){
+    binary_log_dump_header_t header = {
+        .magic = BINARY_LOG_MAGIC,
+        .version = BINARY_LOG_VERSION,
+        .record_size = sizeof(binary_log_record_t)
+    };
+    uint32_t first;
+    uint32_t end = ring_range(&first, &header.lost);
+    header.count = end - first;
+    esp_err_t err = writer(ctx, (const uint8_t *) &header, sizeof(header));
+    for(uint32_t i = first; (i < end) && (err == ESP_OK); i++){
+        binary_log_record_t record;
+        if(!ring_read(i, &record)){
+            // keep record count from header, overwritten record is dumped empty
+            memset(&record, 0, sizeof(record));
+        }
+        err = writer(ctx, (const uint8_t *) &record, sizeof(record));
+    }
+    return err;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file binary_log.h
+ * @brief Provides deferred binary logging for hot paths
+ *
+ * Instead of formatting message in the calling task, only pointer to format string, tag and up to
+ * BINARY_LOG_MAX_ARGS integer arguments are copied into fixed RAM ring. Messages are formatted later,
+ * when the ring is read, either on device by binary_log_write_text() or on host from raw dump
+ * written by binary_log_write_raw() and firmware ELF file, where format string addresses point to.
+ *
+ * Messages above LOG_LOCAL_LEVEL of calling file are removed at compile time like ESP_LOGx messages.
+ *
+ * @note Format strings must be string literals and may use only integer conversions (\c d, \c i, \c u, \c x,
+ * \c X, \c o, \c c, \c p with optional \c h, \c hh or \c l modifiers). Arguments are stored as 32-bit values.
+ */
+#ifndef BINARY_LOG_H
+#define BINARY_LOG_H
+
+#include <stdint.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "esp_log.h"
+
+#define BINARY_LOG_MAX_ARGS 4
+
+/**
+ * @brief Raw dump identification
+ * @{
+ */
+#define BINARY_LOG_MAGIC 0x474f4c42     //< "BLOG" in little endian
+#define BINARY_LOG_VERSION 1
+//@}
+
+/**
+ * @brief Record stored in ring
+ */
+typedef struct {
+    uint32_t timestamp;                 //< ms since boot
+    const char *tag;
+    const char *format;                 //< address of format string in flash, identifies message
+    uint8_t level;                      //< esp_log_level_t
+    uint8_t argc;
+    uint16_t reserved;
+    uint32_t args[BINARY_LOG_MAX_ARGS];
+} binary_log_record_t;
+
+/**
+ * @brief Header of raw dump, followed by \c count records, the oldest first
+ */
+typedef struct {
+    uint32_t magic;                     //< BINARY_LOG_MAGIC
+    uint16_t version;                   //< BINARY_LOG_VERSION
+    uint16_t record_size;               //< sizeof(binary_log_record_t)
+    uint32_t count;                     //< number of records in dump
+    uint32_t lost;                      //< number of records overwritten before dump
+} binary_log_dump_header_t;
+
+/**
+ * @brief Writer of decoded text
+ *
+ * @param ctx context passed to binary_log_write_text()
+ * @param text null-terminated chunk of text
+ */
+typedef esp_err_t (*binary_log_text_writer_t)(void *ctx, const char *text);
+
+/**
+ * @brief Writer of raw dump
+ *
+ * @param ctx context passed to binary_log_write_raw()
+ * @param data
+ * @param length
+ */
+typedef esp_err_t (*binary_log_raw_writer_t)(void *ctx, const uint8_t *data, unsigned length);
+
+/**
+ * @brief Counts arguments of BINARY_LOGx macros
+ * @{
+ */
+#define BINARY_LOG_ARGC_(_0, _1, _2, _3, _4, n, ...) n
+#define BINARY_LOG_ARGC(...) BINARY_LOG_ARGC_(0, ##__VA_ARGS__, 4, 3, 2, 1, 0)
+//@}
+
+/**
+ * @brief Stores message in ring if level is compiled in
+ *
+ * @code{.c}
+ * BINARY_LOGV(TAG, "Captured frame %d.", (int) frame->rx_ctrl.sig_len);
+ * @endcode
+ * @{
+ */
+#define BINARY_LOG_LEVEL(level, tag, format, ...) do { \
+        if(LOG_LOCAL_LEVEL >= (level)){ \
+            binary_log_write((level), (tag), (format), BINARY_LOG_ARGC(__VA_ARGS__), ##__VA_ARGS__); \
+        } \
+    } while(0)
+
+#define BINARY_LOGE(tag, format, ...) BINARY_LOG_LEVEL(ESP_LOG_ERROR, tag, format, ##__VA_ARGS__)
+#define BINARY_LOGW(tag, format, ...) BINARY_LOG_LEVEL(ESP_LOG_WARN, tag, format, ##__VA_ARGS__)
+#define BINARY_LOGI(tag, format, ...) BINARY_LOG_LEVEL(ESP_LOG_INFO, tag, format, ##__VA_ARGS__)
+#define BINARY_LOGD(tag, format, ...) BINARY_LOG_LEVEL(ESP_LOG_DEBUG, tag, format, ##__VA_ARGS__)
+#define BINARY_LOGV(tag, format, ...) BINARY_LOG_LEVEL(ESP_LOG_VERBOSE, tag, format, ##__VA_ARGS__)
+//@}
+
+/**
+ * @brief Stores record into ring. Use BINARY_LOGx macros instead.
+ *
+ * @param level
+ * @param tag static string
+ * @param format static format string
+ * @param argc number of following integer arguments, at most BINARY_LOG_MAX_ARGS
+ */
+void binary_log_write(esp_log_level_t level, const char *tag, const char *format, unsigned argc, ...);
+
+/**
+ * @brief Discards all records.
+ */
+void binary_log_clear();
+
+/**
+ * @brief Formats records, the oldest first, as text lines in ESP-IDF log style.
+ *
+ * @param writer
+ * @param ctx context passed to writer
+ * @return esp_err_t ESP_OK or first error returned by writer
+ */
+esp_err_t binary_log_write_text(binary_log_text_writer_t writer, void *ctx);
+
+/**
+ * @brief Writes raw dump: binary_log_dump_header_t followed by records, the oldest first.
+ *
+ * Dump can be decoded on host by \c utils/decode_binary_log.py with ELF file of running firmware.
+ *
+ * @param writer
+ * @param ctx context passed to writer
+ * @return esp_err_t ESP_OK or first error returned by writer
+ */
+esp_err_t binary_log_write_raw(binary_log_raw_writer_t writer, void *ctx);
+
+#endif
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Decodes raw binary log dump downloaded from /log.bin endpoint.
+
+Format strings and tags are resolved from ELF file of the firmware that produced the dump.
+Requires pyelftools (pip install pyelftools).
+
+Usage: decode_binary_log.py build/esp32-wifi-penetration-tool.elf log.bin
+"""
+import re
+import struct
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+MAGIC = 0x474f4c42
+VERSION = 1
+HEADER = struct.Struct('<IHHII')
+RECORD = struct.Struct('<IIIBBH4I')
+LEVELS = 'NEWIDV'
+CONVERSION = re.compile(r'%(%|[-+ #0]*\d*(?:\.\d+)?(?:hh|h|l)?([diuxXocp]))')
+
+
+def load_sections(elf_path):
+    sections = []
+    with open(elf_path, 'rb') as file:
+        for section in ELFFile(file).iter_sections():
+            if section['sh_addr'] and section['sh_type'] == 'SHT_PROGBITS':
+                sections.append((section['sh_addr'], section.data()))
+    return sections
+
+
+def read_string(sections, address):
+    for start, data in sections:
+        if start <= address < start + len(data):
+            offset = address - start
+            return data[offset:data.index(b'\0', offset)].decode('utf-8', 'replace')
+    return '<0x%08x>' % address
+
+
+def format_message(fmt, args):
+    args = list(args)
+
+    def convert(match):
+        if match.group(1) == '%':
+            return '%'
+        if not args:
+            return match.group(0)
+        value = args.pop(0)
+        spec = re.sub(r'(hh|h|l)', '', match.group(1))
+        conversion = match.group(2)
+        if conversion in 'di':
+            value = value - (1 << 32) if value & 0x80000000 else value
+        elif conversion == 'c':
+            value = chr(value & 0xff)
+        elif conversion == 'p':
+            return '0x%08x' % value
+        return ('%' + spec) % value
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    sections = load_sections(sys.argv[1])
+    with open(sys.argv[2], 'rb') as file:
+        dump = file.read()
+    magic, version, record_size, count, lost = HEADER.unpack_from(dump)
+    if magic != MAGIC or version != VERSION or record_size != RECORD.size:
+        sys.exit('Unsupported dump format')
+    if lost:
+        print('%u records lost' % lost)
+    for i in range(count):
+        timestamp, tag, fmt, level, argc, _, *args = RECORD.unpack_from(dump, HEADER.size + i * RECORD.size)
+        if fmt == 0:
+            continue
+        print('%s (%u) %s: %s' % (LEVELS[level] if level < len(LEVELS) else '?', timestamp,
+                                  read_string(sections, tag), format_message(read_string(sections, fmt), args[:argc])))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,459 @@
+/**
+ * @file capture_filter.c
+ * @brief Implements capture filter expression compiler, bytecode verifier and VM
+ */
+#include "capture_filter.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOG_LOCAL_LEVEL CONFIG_CAPTURE_FILTER_LOG_LEVEL
+#include "esp_log.h"
+#include "esp_err.h"
+
+static const char *TAG = "capture_filter";
+
+/**
+ * @brief Maximum nesting of parentheses and "not" in expression. Limits recursion of compiler.
+ */
+#define CAPTURE_FILTER_MAX_NESTING 8
+#define CAPTURE_FILTER_MAX_TOKEN_LEN 24
+
+#define FRAME_TYPE_MGMT 0
+#define FRAME_TYPE_CTRL 1
+#define FRAME_TYPE_DATA 2
+
+/**
+ * @brief Subtype names accepted by "subtype" primitive.
+ */
+static const struct {
+    const char *name;
+    uint8_t type;
+    uint8_t subtype;
+} subtype_names[] = {
+    { "assoc-req", FRAME_TYPE_MGMT, 0 },
+    { "assoc-resp", FRAME_TYPE_MGMT, 1 },
+    { "reassoc-req", FRAME_TYPE_MGMT, 2 },
+    { "reassoc-resp", FRAME_TYPE_MGMT, 3 },
+    { "probe-req", FRAME_TYPE_MGMT, 4 },
+    { "probe-resp", FRAME_TYPE_MGMT, 5 },
+    { "beacon", FRAME_TYPE_MGMT, 8 },
+    { "atim", FRAME_TYPE_MGMT, 9 },
+    { "disassoc", FRAME_TYPE_MGMT, 10 },
+    { "auth", FRAME_TYPE_MGMT, 11 },
+    { "deauth", FRAME_TYPE_MGMT, 12 },
+    { "action", FRAME_TYPE_MGMT, 13 },
+    { "bar", FRAME_TYPE_CTRL, 8 },
+    { "ba", FRAME_TYPE_CTRL, 9 },
+    { "ps-poll", FRAME_TYPE_CTRL, 10 },
+    { "rts", FRAME_TYPE_CTRL, 11 },
+    { "cts", FRAME_TYPE_CTRL, 12 },
+    { "ack", FRAME_TYPE_CTRL, 13 },
+    { "cf-end", FRAME_TYPE_CTRL, 14 },
+    { "data", FRAME_TYPE_DATA, 0 },
+    { "null", FRAME_TYPE_DATA, 4 },
+    { "qos-data", FRAME_TYPE_DATA, 8 },
+    { "qos-null", FRAME_TYPE_DATA, 12 },
+};
+
+static const struct {
+    const char *name;
+    uint16_t ethertype;
+} ether_proto_names[] = {
+    { "ip", 0x0800 },
+    { "arp", 0x0806 },
+    { "ip6", 0x86dd },
+    { "eapol", 0x888e },
+};
+
+/**
+ * @brief State of recursive descent compiler
+ */
+typedef struct {
+    const char *pos;
+    char token[CAPTURE_FILTER_MAX_TOKEN_LEN];
+    capture_filter_t *filter;
+    unsigned depth;
+    unsigned nesting;
+    esp_err_t err;
+} compiler_t;
+
+static void compile_expr(compiler_t *c);
+
+/**
+ * @brief Reads next token into c->token. Parentheses are tokens on their own.
+ */
+static void next_token(compiler_t *c){
+    while(*c->pos == ' ' || *c->pos == '\t' || *c->pos == '\n' || *c->pos == '\r'){
+        c->pos++;
+    }
+    unsigned len = 0;
+    if(*c->pos == '(' || *c->pos == ')'){
+        c->token[len++] = *c->pos++;
+    }
+    else {
+        while(*c->pos != '\0' && *c->pos != ' ' && *c->pos != '\t' && *c->pos != '\n' && *c->pos != '\r'
+            && *c->pos != '(' && *c->pos != ')'){
+            if(len < CAPTURE_FILTER_MAX_TOKEN_LEN - 1){
+                c->token[len++] = *c->pos;
+            }
+            c->pos++;
+        }
+    }
+    c->token[len] = '\0';
+}
+
+static bool accept_token(compiler_t *c, const char *token){
+    if(strcmp(c->token, token) == 0){
+        next_token(c);
+        return true;
+    }
+    return false;
+}
+
+static void syntax_error(compiler_t *c, const char *message){
+    if(c->err == ESP_OK){
+        ESP_LOGW(TAG, "%s near '%s'", message, c->token);
+        c->err = ESP_ERR_INVALID_ARG;
+    }
+}
+
+/**
+ * @brief Appends instruction to program and tracks stack depth.
+ */
+static capture_filter_insn_t *emit(compiler_t *c, uint8_t opcode, uint16_t k){
+    if(c->err != ESP_OK){
+        return NULL;
+    }
+    if(c->filter->length >= CONFIG_CAPTURE_FILTER_MAX_INSNS){
+        ESP_LOGW(TAG, "Filter exceeds %d instructions", CONFIG_CAPTURE_FILTER_MAX_INSNS);
+        c->err = ESP_ERR_INVALID_SIZE;
+        return NULL;
+    }
+    if(opcode == CAPTURE_FILTER_OP_AND || opcode == CAPTURE_FILTER_OP_OR){
+        c->depth--;
+    }
+    else if(opcode != CAPTURE_FILTER_OP_NOT){
+        if(++c->depth > CAPTURE_FILTER_MAX_DEPTH){
+            ESP_LOGW(TAG, "Filter exceeds stack depth %d", CAPTURE_FILTER_MAX_DEPTH);
+            c->err = ESP_ERR_INVALID_SIZE;
+            return NULL;
+        }
+    }
+    capture_filter_insn_t *insn = &c->filter->insns[c->filter->length++];
+    memset(insn, 0, sizeof(capture_filter_insn_t));
+    insn->opcode = opcode;
+    insn->k = k;
+    return insn;
+}
+
+static int parse_frame_type(const char *token){
+    if(strcmp(token, "mgmt") == 0){
+        return FRAME_TYPE_MGMT;
+    }
+    if(strcmp(token, "ctrl") == 0){
+        return FRAME_TYPE_CTRL;
+    }
+    if(strcmp(token, "data") == 0){
+        return FRAME_TYPE_DATA;
+    }
+    return -1;
+}
+
+/**
+ * @brief Compiles "subtype NAME" primitive. If type is not negative, subtype must belong to it.
+ */
+static void compile_subtype(compiler_t *c, int type){
+    for(unsigned i = 0; i < sizeof(subtype_names) / sizeof(subtype_names[0]); i++){
+        if(strcmp(c->token, subtype_names[i].name) == 0 && (type < 0 || type == subtype_names[i].type)){
+            emit(c, CAPTURE_FILTER_OP_SUBTYPE, (subtype_names[i].type << 4) | subtype_names[i].subtype);
+            next_token(c);
+            return;
+        }
+    }
+    syntax_error(c, "Unknown subtype");
+}
+
+static void compile_ether_proto(compiler_t *c){
+    for(unsigned i = 0; i < sizeof(ether_proto_names) / sizeof(ether_proto_names[0]); i++){
+        if(strcmp(c->token, ether_proto_names[i].name) == 0){
+            emit(c, CAPTURE_FILTER_OP_ETHER_PROTO, ether_proto_names[i].ethertype);
+            next_token(c);
+            return;
+        }
+    }
+    char *end;
+    unsigned long ethertype = strtoul(c->token, &end, 0);
+    if(c->token[0] == '\0' || *end != '\0' || ethertype > 0xffff){
+        syntax_error(c, "Unknown ether proto");
+        return;
+    }
+    emit(c, CAPTURE_FILTER_OP_ETHER_PROTO, ethertype);
+    next_token(c);
+}
+
+static void compile_mac(compiler_t *c, uint8_t opcode){
+    uint8_t mac[6];
+    int consumed = 0;
+    if(sscanf(c->token, "%2hhx:%2hhx:%2hhx:%2hhx:%2hhx:%2hhx%n",
+        &mac[0], &mac[1], &mac[2], &mac[3], &mac[4], &mac[5], &consumed) != 6 || c->token[consumed] != '\0'){
+        syntax_error(c, "Invalid MAC address");
+        return;
+    }
+    capture_filter_insn_t *insn = emit(c, opcode, 0);
+    if(insn != NULL){
+        memcpy(insn->mac, mac, 6);
+    }
+    next_token(c);
+}
+
+static void compile_primitive(compiler_t *c){
+    if(accept_token(c, "type")){
+        int type = parse_frame_type(c->token);
+        if(type < 0){
+            syntax_error(c, "Unknown frame type");
+            return;
+        }
+        next_token(c);
+        if(accept_token(c, "subtype")){
+            // subtype code already contains type
+            compile_subtype(c, type);
+        }
+        else {
+            emit(c, CAPTURE_FILTER_OP_TYPE, type);
+        }
+    }
+    else if(accept_token(c, "subtype")){
+        compile_subtype(c, -1);
+    }
+    else if(accept_token(c, "ether")){
+        if(!accept_token(c, "proto")){
+            syntax_error(c, "Expected 'proto'");
+            return;
+        }
+        compile_ether_proto(c);
+    }
+    else if(accept_token(c, "bssid")){
+        compile_mac(c, CAPTURE_FILTER_OP_BSSID);
+    }
+    else if(accept_token(c, "addr1")){
+        compile_mac(c, CAPTURE_FILTER_OP_ADDR1);
+    }
+    else if(accept_token(c, "addr2")){
+        compile_mac(c, CAPTURE_FILTER_OP_ADDR2);
+    }
+    else if(accept_token(c, "addr3")){
+        compile_mac(c, CAPTURE_FILTER_OP_ADDR3);
+    }
+    else if(accept_token(c, "protected")){
+        emit(c, CAPTURE_FILTER_OP_PROTECTED, 0);
+    }
+    else {
+        syntax_error(c, "Unknown primitive");
+    }
+}
+
+static void compile_factor(compiler_t *c){
+    if(c->err != ESP_OK){
+        return;
+    }
+    if(c->nesting >= CAPTURE_FILTER_MAX_NESTING){
+        syntax_error(c, "Expression nested too deep");
+        return;
+    }
+    c->nesting++;
+    if(accept_token(c, "not")){
+        compile_factor(c);
+        emit(c, CAPTURE_FILTER_OP_NOT, 0);
+    }
+    else if(accept_token(c, "(")){
+        compile_expr(c);
+        if(!accept_token(c, ")")){
+            syntax_error(c, "Expected ')'");
+        }
+    }
+    else {
+        compile_primitive(c);
+    }
+    c->nesting--;
+}
+
+static void compile_term(compiler_t *c){
+    compile_factor(c);
+    while(c->err == ESP_OK && accept_token(c, "and")){
+        compile_factor(c);
+        emit(c, CAPTURE_FILTER_OP_AND, 0);
+    }
+}
+
+static void compile_expr(compiler_t *c){
+    compile_term(c);
+    while(c->err == ESP_OK && accept_token(c, "or")){
+        compile_term(c);
+        emit(c, CAPTURE_FILTER_OP_OR, 0);
+    }
+}
+
+esp_err_t capture_filter_compile(const char *expression, capture_filter_t *filter){
+    compiler_t c = { .pos = expression, .filter = filter, .depth = 0, .nesting = 0, .err = ESP_OK };
+    filter->length = 0;
+    next_token(&c);
+    if(c.token[0] == '\0'){
+        return ESP_OK;
+    }
+    compile_expr(&c);
+    if(c.err == ESP_OK && c.token[0] != '\0'){
+        syntax_error(&c, "Unexpected token");
+    }
+    if(c.err != ESP_OK){
+        filter->length = 0;
+        return c.err;
+    }
+    ESP_LOGI(TAG, "Compiled filter into %u instructions", filter->length);
+    return ESP_OK;
+}
+
+esp_err_t capture_filter_load(const uint8_t *bytecode, unsigned size, capture_filter_t *filter){
+    if((size % sizeof(capture_filter_insn_t)) != 0 || (size / sizeof(capture_filter_insn_t)) > CONFIG_CAPTURE_FILTER_MAX_INSNS){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    unsigned length = size / sizeof(capture_filter_insn_t);
+    unsigned depth = 0;
+    for(unsigned i = 0; i < length; i++){
+        const capture_filter_insn_t *insn = (const capture_filter_insn_t *) &bytecode[i * sizeof(capture_filter_insn_t)];
+        switch(insn->opcode){
+            case CAPTURE_FILTER_OP_AND:
+            case CAPTURE_FILTER_OP_OR:
+                if(depth < 2){
+                    return ESP_ERR_INVALID_ARG;
+                }
+                depth--;
+                break;
+            case CAPTURE_FILTER_OP_NOT:
+                if(depth < 1){
+                    return ESP_ERR_INVALID_ARG;
+                }
+                break;
+            default:
+                if(insn->opcode == 0 || insn->opcode >= CAPTURE_FILTER_OP_MAX || ++depth > CAPTURE_FILTER_MAX_DEPTH){
+                    return ESP_ERR_INVALID_ARG;
+                }
+        }
+    }
+    if(length > 0 && depth != 1){
+        return ESP_ERR_INVALID_ARG;
+    }
+    memcpy(filter->insns, bytecode, size);
+    filter->length = length;
+    return ESP_OK;
+}
+
+/**
+ * @brief Returns offset of BSSID in frame or 0 if frame doesn't carry BSSID
+ */
+static unsigned bssid_offset(const uint8_t *frame){
+    uint8_t type = (frame[0] >> 2) & 0x03;
+    if(type == FRAME_TYPE_MGMT){
+        return 16;
+    }
+    if(type == FRAME_TYPE_DATA){
+        switch(frame[1] & 0x03){
+            case 0: return 16;  // IBSS
+            case 1: return 4;   // ToDS
+            case 2: return 10;  // FromDS
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Returns ethertype from LLC/SNAP header of unprotected data frame or -1
+ */
+static int32_t ether_proto(const uint8_t *frame, unsigned length){
+    uint8_t subtype = frame[0] >> 4;
+    // only data frames with payload (not Null function) and not protected
+    if((((frame[0] >> 2) & 0x03) != FRAME_TYPE_DATA) || (subtype & 0x04) || (frame[1] & 0x40)){
+        return -1;
+    }
+    unsigned offset = 24;
+    if((frame[1] & 0x03) == 0x03){
+        offset += 6;
+    }
+    if(subtype & 0x08){
+        // QoS Control + HT Control if Order bit is set
+        offset += (frame[1] & 0x80) ? 6 : 2;
+    }
+    if(length < offset + 8){
+        return -1;
+    }
+    const uint8_t *llc = &frame[offset];
+    if(llc[0] != 0xaa || llc[1] != 0xaa || llc[2] != 0x03 || llc[3] != 0 || llc[4] != 0 || llc[5] != 0){
+        return -1;
+    }
+    return (llc[6] << 8) | llc[7];
+}
+
+static bool address_matches(const uint8_t *frame, unsigned length, unsigned offset, const uint8_t *mac){
+    return (offset != 0) && (length >= offset + 6) && (memcmp(&frame[offset], mac, 6) == 0);
+}
+
+bool capture_filter_match(const capture_filter_t *filter, const uint8_t *frame, unsigned length){
+    if(filter->length == 0){
+        return true;
+    }
+    if(length < 2){
+        return false;
+    }
+    // Stack of booleans packed into bits, top of stack is bit 0
+    uint32_t stack = 0;
+    for(unsigned i = 0; i < filter->length; i++){
+        const capture_filter_insn_t *insn = &filter->insns[i];
+        uint32_t top;
+        switch(insn->opcode){
+            case CAPTURE_FILTER_OP_TYPE:
+                top = ((frame[0] >> 2) & 0x03) == insn->k;
+                break;
+            case CAPTURE_FILTER_OP_SUBTYPE:
+                top = ((((frame[0] >> 2) & 0x03) << 4) | (frame[0] >> 4)) == insn->k;
+                break;
+            case CAPTURE_FILTER_OP_ETHER_PROTO:
+                top = ether_proto(frame, length) == insn->k;
+                break;
+            case CAPTURE_FILTER_OP_BSSID:
+                top = address_matches(frame, length, bssid_offset(frame), insn->mac);
+                break;
+            case CAPTURE_FILTER_OP_ADDR1:
+                top = address_matches(frame, length, 4, insn->mac);
+                break;
+            case CAPTURE_FILTER_OP_ADDR2:
+                top = address_matches(frame, length, 10, insn->mac);
+                break;
+            case CAPTURE_FILTER_OP_ADDR3:
+                top = address_matches(frame, length, 16, insn->mac);
+                break;
+            case CAPTURE_FILTER_OP_PROTECTED:
+                top = (frame[1] & 0x40) != 0;
+                break;
+            case CAPTURE_FILTER_OP_AND:
+                top = stack & 1;
+                stack >>= 1;
+                stack &= ~1u | top;
+                continue;
+            case CAPTURE_FILTER_OP_OR:
+                top = stack & 1;
+                stack >>= 1;
+                stack |= top;
+                continue;
+            case CAPTURE_FILTER_OP_NOT:
+                stack ^= 1;
+                continue;
+            default:
+                // unreachable for verified programs
+                return false;
+        }
+        stack = (stack << 1) | top;
+    }
+    return stack & 1;
+}
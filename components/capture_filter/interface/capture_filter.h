@@ -0,0 +1,114 @@
+/**
+ * @file capture_filter.h
+ * @brief Provides compiler and bytecode VM for BPF-like capture filter expressions evaluated on raw 802.11 frames
+ *
+ * Expression grammar:
+ * @code
+ * expr      := term { "or" term }
+ * term      := factor { "and" factor }
+ * factor    := "not" factor | "(" expr ")" | primitive
+ * primitive := "type" (mgmt|ctrl|data) [ "subtype" NAME ]
+ *            | "subtype" NAME
+ *            | "ether" "proto" (eapol|ip|ip6|arp|NUMBER)
+ *            | ("bssid"|"addr1"|"addr2"|"addr3") MAC
+ *            | "protected"
+ * @endcode
+ * Example: \c "type mgmt subtype beacon or ether proto eapol and bssid 00:11:22:33:44:55"
+ *
+ * Program is straight-line postfix bytecode without jumps, so evaluation never executes
+ * more than CONFIG_CAPTURE_FILTER_MAX_INSNS instructions.
+ */
+#ifndef CAPTURE_FILTER_H
+#define CAPTURE_FILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+
+/**
+ * @brief Maximum depth of VM stack. Stack is kept as bits of one 32-bit word.
+ */
+#define CAPTURE_FILTER_MAX_DEPTH 32
+
+/**
+ * @brief Opcodes of capture filter VM.
+ *
+ * Test opcodes push one boolean onto stack, logical opcodes pop their operands and push result.
+ */
+typedef enum {
+    CAPTURE_FILTER_OP_TYPE = 1,     //< k = frame type (0 mgmt, 1 ctrl, 2 data)
+    CAPTURE_FILTER_OP_SUBTYPE,      //< k = (type << 4) | subtype
+    CAPTURE_FILTER_OP_ETHER_PROTO,  //< k = ethertype from LLC/SNAP header of unprotected data frame
+    CAPTURE_FILTER_OP_BSSID,        //< mac = BSSID (address selected by ToDS/FromDS bits)
+    CAPTURE_FILTER_OP_ADDR1,        //< mac = address 1
+    CAPTURE_FILTER_OP_ADDR2,        //< mac = address 2
+    CAPTURE_FILTER_OP_ADDR3,        //< mac = address 3
+    CAPTURE_FILTER_OP_PROTECTED,    //< Protected Frame bit is set
+    CAPTURE_FILTER_OP_AND,
+    CAPTURE_FILTER_OP_OR,
+    CAPTURE_FILTER_OP_NOT,
+    CAPTURE_FILTER_OP_MAX
+} capture_filter_opcode_t;
+
+/**
+ * @brief One VM instruction (10 bytes). This is also the wire format of precompiled bytecode.
+ */
+typedef struct __attribute__((__packed__)) {
+    uint8_t opcode;
+    uint8_t reserved;
+    uint16_t k;         //< numeric immediate in little endian
+    uint8_t mac[6];     //< MAC immediate
+} capture_filter_insn_t;
+
+/**
+ * @brief Compiled filter program. Program with zero length matches every frame.
+ */
+typedef struct {
+    uint8_t length;
+    capture_filter_insn_t insns[CONFIG_CAPTURE_FILTER_MAX_INSNS];
+} capture_filter_t;
+
+/**
+ * @brief Compiles filter expression into bytecode.
+ *
+ * Empty expression compiles into program that matches every frame.
+ *
+ * @param expression NUL terminated filter expression
+ * @param filter output program
+ * @return esp_err_t
+ *  - ESP_OK on success
+ *  - ESP_ERR_INVALID_ARG on syntax error
+ *  - ESP_ERR_INVALID_SIZE if program exceeds instruction or stack limit
+ */
+esp_err_t capture_filter_compile(const char *expression, capture_filter_t *filter);
+
+/**
+ * @brief Loads precompiled bytecode (e.g. compiled by web client) and verifies it.
+ *
+ * Verification guarantees that evaluation of loaded program is safe: all opcodes are known,
+ * stack never underflows or exceeds CAPTURE_FILTER_MAX_DEPTH and exactly one value remains at the end.
+ *
+ * @param bytecode array of capture_filter_insn_t
+ * @param size size of bytecode in bytes
+ * @param filter output program
+ * @return esp_err_t
+ *  - ESP_OK on success
+ *  - ESP_ERR_INVALID_SIZE if size is not multiple of instruction size or program is too long
+ *  - ESP_ERR_INVALID_ARG if program is malformed
+ */
+esp_err_t capture_filter_load(const uint8_t *bytecode, unsigned size, capture_filter_t *filter);
+
+/**
+ * @brief Evaluates filter program on raw 802.11 frame.
+ *
+ * Tests that would read beyond frame length evaluate to false.
+ *
+ * @param filter verified program
+ * @param frame raw frame starting with Frame Control field
+ * @param length length of frame in bytes
+ * @return true if frame matches filter
+ */
+bool capture_filter_match(const capture_filter_t *filter, const uint8_t *frame, unsigned length);
+
+#endif
@@ -0,0 +1,639 @@
+/**
+ * @file capture_log.c
+ * @brief Implements persistent append-only capture log
+ */
+#include "capture_log.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#define LOG_LOCAL_LEVEL CONFIG_CAPTURE_LOG_LOG_LEVEL
+#include "esp_log.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "crc32.h"
+
+static const char *TAG = "capture_log";
+
+#define CAPTURE_LOG_SECTOR_MAGIC 0x474f4c43 // "CLOG"
+#define CAPTURE_LOG_VERSION 1
+
+/**
+ * @brief Sequence number of sector without valid header. Valid sequences start from 1.
+ */
+#define SEQUENCE_NONE 0
+
+/**
+ * @brief Size of record with given payload length including header and padding to 4 bytes
+ */
+#define RECORD_SIZE(payload_length) ((sizeof(capture_log_record_header_t) + (payload_length) + 3) & ~3u)
+
+static SemaphoreHandle_t lock = NULL;
+static const capture_log_storage_t *storage = NULL;
+static unsigned sector_count = 0;
+static uint32_t *sector_sequences = NULL;
+
+/**
+ * @brief Write head
+ *
+ * head_buffer is RAM image of head sector. Bytes [0, head_written) are already in flash,
+ * bytes [head_written, head_filled) are batched records waiting for flush.
+ */
+//@{
+static uint8_t head_buffer[CAPTURE_LOG_SECTOR_SIZE];
+static unsigned head_sector = 0;
+static bool head_open = false;
+static unsigned head_written = 0;
+static unsigned head_filled = 0;
+static uint32_t next_sequence = 1;
+//@}
+
+/**
+ * @brief Session index, the oldest session first
+ */
+//@{
+static capture_log_session_t sessions[CONFIG_CAPTURE_LOG_MAX_SESSIONS];
+static unsigned sessions_count = 0;
+static uint16_t next_session_id = 1;
+static bool session_active = false;
+static uint16_t active_session_id = 0;
+//@}
+
+static uint32_t sector_header_crc(const capture_log_sector_header_t *header){
+    return crc32_update(0, (const uint8_t *) header, offsetof(capture_log_sector_header_t, crc));
+}
+
+static uint32_t record_crc(const capture_log_record_header_t *header, const uint8_t *payload){
+    uint32_t crc = crc32_update(0, (const uint8_t *) header, offsetof(capture_log_record_header_t, crc));
+    return crc32_update(crc, payload, header->length);
+}
+
+static bool is_record_erased(const capture_log_record_header_t *header){
+    return (header->length == 0xffff) && (header->type == 0xff);
+}
+
+/**
+ * @brief Reads bytes from sector. Head sector is served from RAM image, so unflushed records are visible.
+ */
+static esp_err_t read_sector_bytes(unsigned sector, unsigned offset, void *buffer, unsigned length){
+    if(head_open && (sector == head_sector)){
+        memcpy(buffer, &head_buffer[offset], length);
+        return ESP_OK;
+    }
+    return storage->read(storage->ctx, sector * CAPTURE_LOG_SECTOR_SIZE + offset, buffer, length);
+}
+
+static capture_log_session_t *find_session(uint16_t session_id){
+    for(unsigned i = 0; i < sessions_count; i++){
+        if(sessions[i].id == session_id){
+            return &sessions[i];
+        }
+    }
+    return NULL;
+}
+
+static void remove_session(unsigned index){
+    memmove(&sessions[index], &sessions[index + 1], (sessions_count - index - 1) * sizeof(capture_log_session_t));
+    sessions_count--;
+}
+
+/**
+ * @brief Updates session index with valid record
+ */
+static void index_record(unsigned sector, unsigned offset, const capture_log_record_header_t *header, const uint8_t *payload){
+    if(header->type == CAPTURE_LOG_RECORD_SESSION_START){
+        if(header->length < sizeof(capture_log_session_info_t)){
+            return;
+        }
+        if(sessions_count >= CONFIG_CAPTURE_LOG_MAX_SESSIONS){
+            remove_session(0);
+        }
+        capture_log_session_t *session = &sessions[sessions_count++];
+        memset(session, 0, sizeof(capture_log_session_t));
+        session->id = header->session_id;
+        memcpy(&session->info, payload, sizeof(capture_log_session_info_t));
+        session->bytes = header->length;
+        session->start_sector = sector;
+        session->start_offset = offset;
+        session->start_sequence = sector_sequences[sector];
+        // records are replayed in chronological order, so the last start record has the highest ID
+        next_session_id = (header->session_id == UINT16_MAX) ? 1 : header->session_id + 1;
+        return;
+    }
+
+    capture_log_session_t *session = find_session(header->session_id);
+    if(session == NULL){
+        // start record was already overwritten or dropped from index
+        return;
+    }
+    session->bytes += header->length;
+    switch(header->type){
+        case CAPTURE_LOG_RECORD_SESSION_END:
+            session->flags |= CAPTURE_LOG_SESSION_ENDED;
+            session->status = (header->length > 0) ? payload[0] : 0;
+            break;
+        case CAPTURE_LOG_RECORD_FRAME:
+            session->frames++;
+            break;
+        case CAPTURE_LOG_RECORD_HCCAPX:
+            session->hccapx++;
+            break;
+        case CAPTURE_LOG_RECORD_PMKID:
+            session->pmkids++;
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Drops sessions that start in given sector from index before the sector is erased.
+ */
+static void drop_sector_sessions(unsigned sector){
+    unsigned i = 0;
+    while(i < sessions_count){
+        if(sessions[i].start_sector == sector){
+            ESP_LOGD(TAG, "Session %u overwritten", sessions[i].id);
+            remove_session(i);
+        }
+        else {
+            i++;
+        }
+    }
+}
+
+static esp_err_t flush_head(){
+    if(!head_open || (head_filled == head_written)){
+        return ESP_OK;
+    }
+    esp_err_t err = storage->write(storage->ctx, head_sector * CAPTURE_LOG_SECTOR_SIZE + head_written,
+        &head_buffer[head_written], head_filled - head_written);
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Flush failed: %s", esp_err_to_name(err));
+        return err;
+    }
+    head_written = head_filled;
+    return ESP_OK;
+}
+
+/**
+ * @brief Erases the next sector in ring and writes its header. Pending records must be flushed before.
+ */
+static esp_err_t open_next_sector(){
+    unsigned sector = head_open ? (head_sector + 1) % sector_count : head_sector;
+    drop_sector_sessions(sector);
+    sector_sequences[sector] = SEQUENCE_NONE;
+    // failed erase is retried on the same sector
+    head_sector = sector;
+    head_open = false;
+
+    esp_err_t err = storage->erase_sector(storage->ctx, sector * CAPTURE_LOG_SECTOR_SIZE);
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Erasing sector %u failed: %s", sector, esp_err_to_name(err));
+        return err;
+    }
+    capture_log_sector_header_t header = {
+        .magic = CAPTURE_LOG_SECTOR_MAGIC,
+        .sequence = next_sequence,
+        .version = CAPTURE_LOG_VERSION,
+        .reserved = 0
+    };
+    header.crc = sector_header_crc(&header);
+    memset(head_buffer, 0xff, sizeof(head_buffer));
+    memcpy(head_buffer, &header, sizeof(header));
+
+    head_open = true;
+    head_written = 0;
+    head_filled = sizeof(header);
+    sector_sequences[sector] = next_sequence++;
+    return flush_head();
+}
+
+/**
+ * @brief Frames payload (prefix + data) into record and appends it to head sector
+ */
+static esp_err_t append_record(uint8_t type, uint16_t session_id, const void *prefix, unsigned prefix_length, const void *data, unsigned length){
+    unsigned payload_length = prefix_length + length;
+    if(payload_length > CAPTURE_LOG_MAX_PAYLOAD){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    unsigned record_size = RECORD_SIZE(payload_length);
+    esp_err_t err;
+    if(!head_open || (head_filled + record_size > CAPTURE_LOG_SECTOR_SIZE)){
+        if(((err = flush_head()) != ESP_OK) || ((err = open_next_sector()) != ESP_OK)){
+            return err;
+        }
+    }
+
+    capture_log_record_header_t header = {
+        .length = payload_length,
+        .type = type,
+        .reserved = 0,
+        .session_id = session_id,
+        .reserved2 = 0
+    };
+    uint8_t *payload = &head_buffer[head_filled + sizeof(header)];
+    if(prefix_length > 0){
+        memcpy(payload, prefix, prefix_length);
+    }
+    memcpy(&payload[prefix_length], data, length);
+    header.crc = record_crc(&header, payload);
+    memcpy(&head_buffer[head_filled], &header, sizeof(header));
+
+    index_record(head_sector, head_filled, &header, payload);
+    head_filled += record_size;
+    if(head_filled - head_written >= CONFIG_CAPTURE_LOG_FLUSH_THRESHOLD){
+        return flush_head();
+    }
+    return ESP_OK;
+}
+
+static esp_err_t end_active_session(uint8_t status){
+    esp_err_t err = append_record(CAPTURE_LOG_RECORD_SESSION_END, active_session_id, NULL, 0, &status, 1);
+    capture_log_session_t *session = find_session(active_session_id);
+    if(session != NULL){
+        session->flags &= ~CAPTURE_LOG_SESSION_ACTIVE;
+    }
+    session_active = false;
+    if(err != ESP_OK){
+        return err;
+    }
+    return flush_head();
+}
+
+/**
+ * @brief Replays records of sector that is loaded in head_buffer into session index
+ *
+ * @return unsigned offset after the last valid record, or sector size if sector is full or ends with torn record
+ */
+static unsigned replay_sector(unsigned sector){
+    unsigned offset = sizeof(capture_log_sector_header_t);
+    while(offset + sizeof(capture_log_record_header_t) <= CAPTURE_LOG_SECTOR_SIZE){
+        capture_log_record_header_t header;
+        memcpy(&header, &head_buffer[offset], sizeof(header));
+        if(is_record_erased(&header)){
+            return offset;
+        }
+        const uint8_t *payload = &head_buffer[offset + sizeof(header)];
+        if((header.length > CAPTURE_LOG_MAX_PAYLOAD) || (offset + RECORD_SIZE(header.length) > CAPTURE_LOG_SECTOR_SIZE)
+            || (record_crc(&header, payload) != header.crc)){
+            // nothing is written after torn record, rest of the sector is skipped
+            ESP_LOGW(TAG, "Torn record in sector %u at offset %u", sector, offset);
+            break;
+        }
+        index_record(sector, offset, &header, payload);
+        offset += RECORD_SIZE(header.length);
+    }
+    return CAPTURE_LOG_SECTOR_SIZE;
+}
+
+static esp_err_t mount(){
+    sector_count = storage->size / CAPTURE_LOG_SECTOR_SIZE;
+    if(sector_count < 2){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    free(sector_sequences);
+    sector_sequences = (uint32_t *) calloc(sector_count, sizeof(uint32_t));
+    if(sector_sequences == NULL){
+        return ESP_ERR_NO_MEM;
+    }
+    head_open = false;
+    head_sector = 0;
+    next_sequence = 1;
+    sessions_count = 0;
+    next_session_id = 1;
+    session_active = false;
+
+    // find the newest sector
+    uint32_t head_sequence = SEQUENCE_NONE;
+    for(unsigned sector = 0; sector < sector_count; sector++){
+        capture_log_sector_header_t header;
+        esp_err_t err = storage->read(storage->ctx, sector * CAPTURE_LOG_SECTOR_SIZE, &header, sizeof(header));
+        if(err != ESP_OK){
+            return err;
+        }
+        if((header.magic != CAPTURE_LOG_SECTOR_MAGIC) || (header.version != CAPTURE_LOG_VERSION)
+            || (sector_header_crc(&header) != header.crc) || (header.sequence == SEQUENCE_NONE)){
+            continue;
+        }
+        sector_sequences[sector] = header.sequence;
+        if(header.sequence > head_sequence){
+            head_sequence = header.sequence;
+            head_sector = sector;
+        }
+    }
+    if(head_sequence == SEQUENCE_NONE){
+        ESP_LOGI(TAG, "Empty log with %u sectors", sector_count);
+        return ESP_OK;
+    }
+
+    // replay sectors from the oldest, head sector is the last one so its image stays in head_buffer
+    unsigned head_end = CAPTURE_LOG_SECTOR_SIZE;
+    uint32_t previous_sequence = SEQUENCE_NONE;
+    for(unsigned i = 1; i <= sector_count; i++){
+        unsigned sector = (head_sector + i) % sector_count;
+        if(sector_sequences[sector] == SEQUENCE_NONE){
+            continue;
+        }
+        if(sector_sequences[sector] <= previous_sequence){
+            // stale sector out of ring order
+            sector_sequences[sector] = SEQUENCE_NONE;
+            continue;
+        }
+        previous_sequence = sector_sequences[sector];
+        esp_err_t err = storage->read(storage->ctx, sector * CAPTURE_LOG_SECTOR_SIZE, head_buffer, CAPTURE_LOG_SECTOR_SIZE);
+        if(err != ESP_OK){
+            return err;
+        }
+        head_end = replay_sector(sector);
+    }
+    head_open = true;
+    head_written = head_end;
+    head_filled = head_end;
+    next_sequence = head_sequence + 1;
+    ESP_LOGI(TAG, "Mounted log with %u sectors, head sector %u, %u sessions", sector_count, head_sector, sessions_count);
+    return ESP_OK;
+}
+
+esp_err_t capture_log_init_storage(const capture_log_storage_t *storage_arg){
+    if(lock == NULL){
+        lock = xSemaphoreCreateMutex();
+        if(lock == NULL){
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    storage = storage_arg;
+    esp_err_t err = mount();
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Mount failed: %s", esp_err_to_name(err));
+        storage = NULL;
+    }
+    xSemaphoreGive(lock);
+    return err;
+}
+
+esp_err_t capture_log_init(){
+    const capture_log_storage_t *partition_storage = capture_log_partition_storage();
+    if(partition_storage == NULL){
+        ESP_LOGW(TAG, "Partition %s not found", CONFIG_CAPTURE_LOG_PARTITION_LABEL);
+        return ESP_ERR_NOT_FOUND;
+    }
+    return capture_log_init_storage(partition_storage);
+}
+
+esp_err_t capture_log_session_start(const capture_log_session_info_t *info, uint16_t *session_id){
+    if(storage == NULL){
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if(session_active){
+        end_active_session(0xff);
+    }
+    uint16_t id = next_session_id;
+    esp_err_t err = append_record(CAPTURE_LOG_RECORD_SESSION_START, id, NULL, 0, info, sizeof(capture_log_session_info_t));
+    capture_log_session_t *session = find_session(id);
+    if(session != NULL){
+        session_active = true;
+        active_session_id = id;
+        session->flags |= CAPTURE_LOG_SESSION_ACTIVE;
+        if(session_id != NULL){
+            *session_id = id;
+        }
+    }
+    xSemaphoreGive(lock);
+    return err;
+}
+
+esp_err_t capture_log_append(uint8_t type, const void *data, unsigned length){
+    if(storage == NULL){
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    esp_err_t err = ESP_ERR_INVALID_STATE;
+    if(session_active){
+        err = append_record(type, active_session_id, NULL, 0, data, length);
+    }
+    xSemaphoreGive(lock);
+    return err;
+}
+
+esp_err_t capture_log_append_frame(const capture_log_frame_t *frame_info, const uint8_t *frame, unsigned length){
+    if(storage == NULL){
+        return ESP_ERR_INVALID_STATE;
+    }
+    if(length > CAPTURE_LOG_MAX_PAYLOAD - sizeof(capture_log_frame_t)){
+        length = CAPTURE_LOG_MAX_PAYLOAD - sizeof(capture_log_frame_t);
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    esp_err_t err = ESP_ERR_INVALID_STATE;
+    if(session_active){
+        err = append_record(CAPTURE_LOG_RECORD_FRAME, active_session_id, frame_info, sizeof(capture_log_frame_t), frame, length);
+    }
+    xSemaphoreGive(lock);
+    return err;
+}
+
+esp_err_t capture_log_session_end(uint8_t status){
+    if(storage == NULL){
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    esp_err_t err = ESP_ERR_INVALID_STATE;
+    if(session_active){
+        err = end_active_session(status);
+    }
+    xSemaphoreGive(lock);
+    return err;
+}
+
+esp_err_t capture_log_flush(){
+    if(storage == NULL){
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    esp_err_t err = flush_head();
+    xSemaphoreGive(lock);
+    return err;
+}
+
+unsigned capture_log_get_sessions(capture_log_session_t *sessions_out, unsigned max_count){
+    if(storage == NULL){
+        return 0;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    unsigned count = 0;
+    for(int i = sessions_count - 1; (i >= 0) && (count < max_count); i--){
+        sessions_out[count++] = sessions[i];
+    }
+    xSemaphoreGive(lock);
+    return count;
+}
+
+esp_err_t capture_log_get_session(uint16_t session_id, capture_log_session_t *session){
+    if(storage == NULL){
+        return ESP_ERR_NOT_FOUND;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    capture_log_session_t *found = find_session(session_id);
+    if(found != NULL){
+        *session = *found;
+    }
+    xSemaphoreGive(lock);
+    return (found != NULL) ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t capture_log_iterator_init(uint16_t session_id, capture_log_iterator_t *iterator){
+    capture_log_session_t session;
+    esp_err_t err = capture_log_get_session(session_id, &session);
+    if(err != ESP_OK){
+        return err;
+    }
+    iterator->session_id = session_id;
+    iterator->sector = session.start_sector;
+    iterator->offset = session.start_offset;
+    iterator->sequence = session.start_sequence;
+    iterator->done = false;
+    return ESP_OK;
+}
+
+/**
+ * @brief Moves iterator to the beginning of the next sector in ring, or ends iteration at write head
+ */
+static void iterator_next_sector(capture_log_iterator_t *iterator){
+    if(head_open && (iterator->sector == head_sector)){
+        iterator->done = true;
+        return;
+    }
+    for(unsigned i = 1; i < sector_count; i++){
+        unsigned sector = (iterator->sector + i) % sector_count;
+        if(sector_sequences[sector] == SEQUENCE_NONE){
+            continue;
+        }
+        if(sector_sequences[sector] < iterator->sequence){
+            break;
+        }
+        iterator->sector = sector;
+        iterator->offset = sizeof(capture_log_sector_header_t);
+        iterator->sequence = sector_sequences[sector];
+        return;
+    }
+    iterator->done = true;
+}
+
+esp_err_t capture_log_iterator_next(capture_log_iterator_t *iterator, capture_log_record_header_t *header, uint8_t *payload){
+    if(storage == NULL){
+        return ESP_ERR_NOT_FOUND;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    esp_err_t err = ESP_ERR_NOT_FOUND;
+    while(!iterator->done){
+        if(sector_sequences[iterator->sector] != iterator->sequence){
+            ESP_LOGW(TAG, "Session %u was overwritten during reading", iterator->session_id);
+            iterator->done = true;
+            break;
+        }
+        unsigned limit = (head_open && (iterator->sector == head_sector)) ? head_filled : CAPTURE_LOG_SECTOR_SIZE;
+        if(iterator->offset + sizeof(capture_log_record_header_t) > limit){
+            iterator_next_sector(iterator);
+            continue;
+        }
+        if((err = read_sector_bytes(iterator->sector, iterator->offset, header, sizeof(capture_log_record_header_t))) != ESP_OK){
+            break;
+        }
+        err = ESP_ERR_NOT_FOUND;
+        if(is_record_erased(header) || (header->length > CAPTURE_LOG_MAX_PAYLOAD)
+            || (iterator->offset + RECORD_SIZE(header->length) > limit)){
+            iterator_next_sector(iterator);
+            continue;
+        }
+        unsigned offset = iterator->offset;
+        iterator->offset += RECORD_SIZE(header->length);
+        if(header->session_id != iterator->session_id){
+            continue;
+        }
+        if((err = read_sector_bytes(iterator->sector, offset + sizeof(capture_log_record_header_t), payload, header->length)) != ESP_OK){
+            break;
+        }
+        err = ESP_ERR_NOT_FOUND;
+        if(record_crc(header, payload) != header->crc){
+            continue;
+        }
+        if(header->type == CAPTURE_LOG_RECORD_SESSION_END){
+            iterator->done = true;
+        }
+        err = ESP_OK;
+        break;
+    }
+    xSemaphoreGive(lock);
+    return err;
+}
+
+/**
+ * @brief Adds seek point if it falls on current stride, halves the points when index is full
+ *
+ * @param index
+ * @param iterator
+ * @param crossing number of sector boundaries crossed since session start
+ */
+static void seek_index_add(capture_log_seek_index_t *index, const capture_log_iterator_t *iterator, unsigned crossing){
+    if((crossing % index->stride) != 0){
+        return;
+    }
+    if(index->count == CAPTURE_LOG_SEEK_POINTS){
+        for(unsigned i = 0; i < CAPTURE_LOG_SEEK_POINTS / 2; i++){
+            index->points[i] = index->points[2 * i];
+        }
+        index->count = CAPTURE_LOG_SEEK_POINTS / 2;
+        index->stride *= 2;
+        if((crossing % index->stride) != 0){
+            return;
+        }
+    }
+    capture_log_seek_point_t *point = &index->points[index->count++];
+    point->iterator = *iterator;
+    point->frames = index->frames;
+    point->frame_bytes = index->frame_bytes;
+}
+
+esp_err_t capture_log_seek_index_build(uint16_t session_id, capture_log_seek_index_t *index, uint8_t *payload){
+    capture_log_session_t session;
+    esp_err_t err = capture_log_get_session(session_id, &session);
+    if(err != ESP_OK){
+        return err;
+    }
+    if(session.flags & CAPTURE_LOG_SESSION_ACTIVE){
+        return ESP_ERR_INVALID_STATE;
+    }
+    capture_log_iterator_t iterator;
+    if((err = capture_log_iterator_init(session_id, &iterator)) != ESP_OK){
+        return err;
+    }
+    index->session_id = session_id;
+    index->start_sequence = session.start_sequence;
+    index->frames = 0;
+    index->frame_bytes = 0;
+    index->stride = 1;
+    index->count = 0;
+    seek_index_add(index, &iterator, 0);
+
+    unsigned crossing = 0;
+    uint16_t sector = iterator.sector;
+    capture_log_iterator_t previous = iterator;
+    capture_log_record_header_t header;
+    while((err = capture_log_iterator_next(&iterator, &header, payload)) == ESP_OK){
+        if(iterator.sector != sector){
+            // record was read from next sector, iterator state before reading it is the seek point
+            sector = iterator.sector;
+            seek_index_add(index, &previous, ++crossing);
+        }
+        if((header.type == CAPTURE_LOG_RECORD_FRAME) && (header.length > sizeof(capture_log_frame_t))){
+            index->frames++;
+            index->frame_bytes += header.length - sizeof(capture_log_frame_t);
+        }
+        previous = iterator;
+    }
+    return (err == ESP_ERR_NOT_FOUND) ? ESP_OK : err;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file capture_log_partition.c
+ * @brief Implements capture log storage backend on top of flash partition
+ */
+#include "capture_log.h"
+
+#include <stddef.h>
+#include "esp_partition.h"
+
+static esp_err_t partition_read(void *ctx, unsigned offset, void *buffer, unsigned length){
+    return esp_partition_read((const esp_partition_t *) ctx, offset, buffer, length);
+}
+
+static esp_err_t partition_write(void *ctx, unsigned offset, const void *buffer, unsigned length){
+    return esp_partition_write((const esp_partition_t *) ctx, offset, buffer, length);
+}
+
+static esp_err_t partition_erase_sector(void *ctx, unsigned offset){
+    return esp_partition_erase_range((const esp_partition_t *) ctx, offset, CAPTURE_LOG_SECTOR_SIZE);
+}
+
+static capture_log_storage_t partition_storage = {
+    .read = partition_read,
+    .write = partition_write,
+    .erase_sector = partition_erase_sector
+};
+
+const capture_log_storage_t *capture_log_partition_storage(){
+    const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+        (esp_partition_subtype_t) CAPTURE_LOG_PARTITION_SUBTYPE, CONFIG_CAPTURE_LOG_PARTITION_LABEL);
+    if(partition == NULL){
+        return NULL;
+    }
+    partition_storage.ctx = (void *) partition;
+    partition_storage.size = partition->size - (partition->size % CAPTURE_LOG_SECTOR_SIZE);
+    return &partition_storage;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file capture_log_ram.c
+ * @brief Implements capture log storage backend in RAM with NOR flash semantics
+ */
+#include "capture_log.h"
+
+#include <stddef.h>
+#include <string.h>
+
+static bool is_in_range(const capture_log_ram_storage_t *ram, unsigned offset, unsigned length){
+    return (offset <= ram->storage.size) && (length <= ram->storage.size - offset);
+}
+
+static esp_err_t ram_read(void *ctx, unsigned offset, void *buffer, unsigned length){
+    const capture_log_ram_storage_t *ram = (const capture_log_ram_storage_t *) ctx;
+    if(!is_in_range(ram, offset, length)){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(buffer, &ram->memory[offset], length);
+    return ESP_OK;
+}
+
+static esp_err_t ram_write(void *ctx, unsigned offset, const void *buffer, unsigned length){
+    capture_log_ram_storage_t *ram = (capture_log_ram_storage_t *) ctx;
+    if(!is_in_range(ram, offset, length)){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    // programming flash only clears bits
+    const uint8_t *data = (const uint8_t *) buffer;
+    for(unsigned i = 0; i < length; i++){
+        ram->memory[offset + i] &= data[i];
+    }
+    return ESP_OK;
+}
+
+static esp_err_t ram_erase_sector(void *ctx, unsigned offset){
+    capture_log_ram_storage_t *ram = (capture_log_ram_storage_t *) ctx;
+    if((offset % CAPTURE_LOG_SECTOR_SIZE) != 0){
+        return ESP_ERR_INVALID_ARG;
+    }
+    if(!is_in_range(ram, offset, CAPTURE_LOG_SECTOR_SIZE)){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memset(&ram->memory[offset], 0xff, CAPTURE_LOG_SECTOR_SIZE);
+    return ESP_OK;
+}
+
+const capture_log_storage_t *capture_log_ram_storage_init(capture_log_ram_storage_t *ram, uint8_t *memory, unsigned size){
+    ram->memory = memory;
+    ram->storage.read = ram_read;
+    ram->storage.write = ram_write;
+    ram->storage.erase_sector = ram_erase_sector;
+    ram->storage.size = size - (size % CAPTURE_LOG_SECTOR_SIZE);
+    ram->storage.ctx = ram;
+    return &ram->storage;
+}
@@ -0,0 +1,350 @@
+/**
+ * @file capture_log.h
+ * @brief Provides persistent append-only capture log stored in dedicated flash partition
+ *
+ * Log is a ring of flash sectors. Every sector starts with a header carrying increasing sequence number,
+ * followed by CRC32-framed records. Sectors are written strictly sequentially and erased only right before
+ * they are reused, so erase cycles are spread evenly over the whole partition.
+ *
+ * Records are grouped into sessions (typically one attack run). Session index is rebuilt
+ * from flash at mount, so sessions survive reboot until their sectors are overwritten.
+ */
+#ifndef CAPTURE_LOG_H
+#define CAPTURE_LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+
+/**
+ * @brief Partition subtype of capture log data partition (custom subtype)
+ */
+#define CAPTURE_LOG_PARTITION_SUBTYPE 0x40
+
+/**
+ * @brief Flash sector size. Sector is the erase unit and no record crosses sector boundary.
+ */
+#define CAPTURE_LOG_SECTOR_SIZE 4096
+
+/**
+ * @brief Header at the beginning of every used sector
+ */
+typedef struct __attribute__((__packed__)) {
+    uint32_t magic;         //< CAPTURE_LOG_SECTOR_MAGIC
+    uint32_t sequence;      //< increases with every newly opened sector
+    uint16_t version;       //< CAPTURE_LOG_VERSION
+    uint16_t reserved;
+    uint32_t crc;           //< CRC32 of previous fields
+} capture_log_sector_header_t;
+
+/**
+ * @brief Header of every record. Payload follows, record is padded to 4 bytes.
+ */
+typedef struct __attribute__((__packed__)) {
+    uint16_t length;        //< payload length
+    uint8_t type;           //< capture_log_record_type_t
+    uint8_t reserved;
+    uint16_t session_id;
+    uint16_t reserved2;
+    uint32_t crc;           //< CRC32 of previous fields and payload
+} capture_log_record_header_t;
+
+/**
+ * @brief Maximum payload length of single record
+ */
+#define CAPTURE_LOG_MAX_PAYLOAD (CAPTURE_LOG_SECTOR_SIZE - sizeof(capture_log_sector_header_t) - sizeof(capture_log_record_header_t))
+
+/**
+ * @brief Types of records
+ */
+typedef enum {
+    CAPTURE_LOG_RECORD_SESSION_START = 1,   //< capture_log_session_info_t
+    CAPTURE_LOG_RECORD_SESSION_END,         //< one byte with session status
+    CAPTURE_LOG_RECORD_FRAME,               //< capture_log_frame_t followed by raw frame
+    CAPTURE_LOG_RECORD_HCCAPX,              //< hccapx_t
+    CAPTURE_LOG_RECORD_PMKID,               //< pmkid_record_t
+} capture_log_record_type_t;
+
+/**
+ * @brief Metadata stored in session start record
+ */
+typedef struct __attribute__((__packed__)) {
+    uint8_t attack_type;
+    uint8_t attack_method;
+    uint8_t channel;
+    uint8_t bssid[6];
+    uint8_t ssid_length;
+    uint8_t ssid[32];
+} capture_log_session_info_t;
+
+/**
+ * @brief Metadata of captured frame stored in front of raw frame in frame record
+ */
+typedef struct __attribute__((__packed__)) {
+    uint32_t ts_usec;
+    uint8_t channel;
+    int8_t rssi;
+    uint16_t reserved;
+} capture_log_frame_t;
+
+/**
+ * @brief Session flags
+ */
+//@{
+#define CAPTURE_LOG_SESSION_ENDED (1 << 0)     //< end record was written
+#define CAPTURE_LOG_SESSION_ACTIVE (1 << 1)    //< session is currently being written
+//@}
+
+/**
+ * @brief Entry of session index
+ */
+typedef struct {
+    uint16_t id;
+    uint8_t flags;          //< CAPTURE_LOG_SESSION_* flags
+    uint8_t status;         //< status from end record
+    capture_log_session_info_t info;
+    uint16_t frames;        //< number of frame records
+    uint16_t hccapx;        //< number of HCCAPX records
+    uint16_t pmkids;        //< number of PMKID records
+    uint32_t bytes;         //< total payload bytes of all records
+    uint16_t start_sector;  //< location of session start record
+    uint16_t start_offset;
+    uint32_t start_sequence;
+} capture_log_session_t;
+
+/**
+ * @brief Position of record reader. Treat as opaque.
+ */
+typedef struct {
+    uint16_t session_id;
+    uint16_t sector;
+    uint16_t offset;
+    uint32_t sequence;
+    bool done;
+} capture_log_iterator_t;
+
+/**
+ * @brief Maximum number of seek points in capture_log_seek_index_t
+ */
+#define CAPTURE_LOG_SEEK_POINTS 32
+
+/**
+ * @brief Point from which session can be read again, see capture_log_seek_index_build()
+ */
+typedef struct {
+    capture_log_iterator_t iterator;    //< iterator positioned right before record that follows this point
+    uint32_t frames;                    //< frame records of session before this point
+    uint32_t frame_bytes;               //< raw frame bytes (without capture_log_frame_t) before this point
+} capture_log_seek_point_t;
+
+/**
+ * @brief Sparse index of frame records of one session
+ *
+ * Seek points are placed on sector boundaries. When the session spans more sectors than CAPTURE_LOG_SEEK_POINTS,
+ * every other point is dropped and stride doubles, so points stay evenly spread.
+ */
+typedef struct {
+    uint16_t session_id;
+    uint32_t start_sequence;            //< identifies session together with ID
+    uint32_t frames;                    //< total frame records of session
+    uint32_t frame_bytes;               //< total raw frame bytes of session
+    unsigned stride;                    //< sectors between neighbouring seek points
+    unsigned count;
+    capture_log_seek_point_t points[CAPTURE_LOG_SEEK_POINTS];   //< the first point is at session start
+} capture_log_seek_index_t;
+
+/**
+ * @brief Storage backend of capture log
+ *
+ * All offsets are relative to start of the storage. Default backend is flash partition,
+ * other backends (e.g. external flash) can be passed to capture_log_init_storage().
+ */
+typedef struct {
+    esp_err_t (*read)(void *ctx, unsigned offset, void *buffer, unsigned length);
+    esp_err_t (*write)(void *ctx, unsigned offset, const void *buffer, unsigned length);
+    esp_err_t (*erase_sector)(void *ctx, unsigned offset);
+    unsigned size;          //< size of storage in bytes, multiple of CAPTURE_LOG_SECTOR_SIZE
+    void *ctx;
+} capture_log_storage_t;
+
+/**
+ * @brief Returns storage backend built on top of capture log flash partition.
+ *
+ * @return const capture_log_storage_t*
+ * @return \c NULL if there is no partition with label CONFIG_CAPTURE_LOG_PARTITION_LABEL
+ */
+const capture_log_storage_t *capture_log_partition_storage();
+
+/**
+ * @brief Storage backend keeping capture log in RAM (e.g. PSRAM or host tests)
+ *
+ * Emulates NOR flash: erase sets sector to 0xff and write can only clear bits,
+ * so interrupted writes leave the same torn records as on flash.
+ */
+typedef struct {
+    capture_log_storage_t storage;  //< pass to capture_log_init_storage()
+    uint8_t *memory;
+} capture_log_ram_storage_t;
+
+/**
+ * @brief Initialises RAM storage backend on top of given memory.
+ *
+ * Memory content is kept, so log written before can be mounted again. Fill it with 0xff for empty log.
+ *
+ * @param ram backend to initialise, must stay valid while log is mounted
+ * @param memory storage memory
+ * @param size size of memory, rounded down to multiple of CAPTURE_LOG_SECTOR_SIZE
+ * @return const capture_log_storage_t* storage to be passed to capture_log_init_storage()
+ */
+const capture_log_storage_t *capture_log_ram_storage_init(capture_log_ram_storage_t *ram, uint8_t *memory, unsigned size);
+
+/**
+ * @brief Mounts capture log from flash partition.
+ *
+ * @return esp_err_t
+ *  - ESP_OK on success
+ *  - ESP_ERR_NOT_FOUND if partition is missing
+ *  - error from capture_log_init_storage()
+ */
+esp_err_t capture_log_init();
+
+/**
+ * @brief Mounts capture log from given storage.
+ *
+ * Scans sector headers to find the newest sector, replays all valid records to rebuild session index
+ * and positions write head after the last valid record. Torn record (e.g. after power loss) ends its sector.
+ *
+ * @param storage backend, must stay valid
+ * @return esp_err_t
+ *  - ESP_OK on success
+ *  - ESP_ERR_INVALID_SIZE if storage has less than 2 sectors
+ *  - ESP_ERR_NO_MEM
+ *  - error of storage backend
+ */
+esp_err_t capture_log_init_storage(const capture_log_storage_t *storage);
+
+/**
+ * @brief Starts new session. Session that is still active is ended first with status 0xff.
+ *
+ * @param info session metadata
+ * @param session_id output ID of new session, may be NULL
+ * @return esp_err_t
+ *  - ESP_OK on success
+ *  - ESP_ERR_INVALID_STATE if log is not mounted
+ *  - error of storage backend
+ */
+esp_err_t capture_log_session_start(const capture_log_session_info_t *info, uint16_t *session_id);
+
+/**
+ * @brief Appends record to active session.
+ *
+ * Record is batched in RAM and written to flash once CONFIG_CAPTURE_LOG_FLUSH_THRESHOLD bytes are pending.
+ *
+ * @param type capture_log_record_type_t
+ * @param data payload
+ * @param length payload length, at most CAPTURE_LOG_MAX_PAYLOAD
+ * @return esp_err_t
+ *  - ESP_OK on success
+ *  - ESP_ERR_INVALID_STATE if log is not mounted or no session is active
+ *  - ESP_ERR_INVALID_SIZE if payload is too long
+ *  - error of storage backend
+ */
+esp_err_t capture_log_append(uint8_t type, const void *data, unsigned length);
+
+/**
+ * @brief Appends frame record to active session.
+ *
+ * Frame longer than CAPTURE_LOG_MAX_PAYLOAD is truncated.
+ *
+ * @param frame_info metadata of frame
+ * @param frame raw frame
+ * @param length length of frame
+ * @return esp_err_t same as capture_log_append()
+ */
+esp_err_t capture_log_append_frame(const capture_log_frame_t *frame_info, const uint8_t *frame, unsigned length);
+
+/**
+ * @brief Writes session end record and flushes all pending records to flash.
+ *
+ * @param status arbitrary status byte stored in session index (e.g. attack state)
+ * @return esp_err_t
+ *  - ESP_OK on success
+ *  - ESP_ERR_INVALID_STATE if log is not mounted or no session is active
+ *  - error of storage backend
+ */
+esp_err_t capture_log_session_end(uint8_t status);
+
+/**
+ * @brief Writes all pending records to flash.
+ *
+ * @return esp_err_t
+ */
+esp_err_t capture_log_flush();
+
+/**
+ * @brief Copies session index, newest session first.
+ *
+ * @param sessions output array
+ * @param max_count capacity of output array
+ * @return unsigned number of sessions copied
+ */
+unsigned capture_log_get_sessions(capture_log_session_t *sessions, unsigned max_count);
+
+/**
+ * @brief Copies index entry of one session.
+ *
+ * @param session_id
+ * @param session output
+ * @return esp_err_t
+ *  - ESP_OK on success
+ *  - ESP_ERR_NOT_FOUND if session is not in index
+ */
+esp_err_t capture_log_get_session(uint16_t session_id, capture_log_session_t *session);
+
+/**
+ * @brief Positions iterator at the start record of given session.
+ *
+ * @param session_id
+ * @param iterator output
+ * @return esp_err_t
+ *  - ESP_OK on success
+ *  - ESP_ERR_NOT_FOUND if session is not in index
+ */
+esp_err_t capture_log_iterator_init(uint16_t session_id, capture_log_iterator_t *iterator);
+
+/**
+ * @brief Reads next valid record of the session.
+ *
+ * Records of other sessions and records with invalid CRC are skipped. Iteration ends after session
+ * end record, at write head or when sector under iterator is overwritten. Unflushed records are included.
+ *
+ * @param iterator
+ * @param header output record header
+ * @param payload output buffer of at least CAPTURE_LOG_MAX_PAYLOAD bytes
+ * @return esp_err_t
+ *  - ESP_OK if record was read
+ *  - ESP_ERR_NOT_FOUND if there are no more records
+ *  - error of storage backend
+ */
+esp_err_t capture_log_iterator_next(capture_log_iterator_t *iterator, capture_log_record_header_t *header, uint8_t *payload);
+
+/**
+ * @brief Reads whole session and builds its seek index.
+ *
+ * Only frame records (capture_log_frame_t followed by at least one byte of raw frame) are counted.
+ * Records are read the same way as by capture_log_iterator_next(), so frames counted up to a seek point
+ * are exactly the frames iterator returns before reaching it.
+ *
+ * @param session_id
+ * @param index output
+ * @param payload buffer of at least CAPTURE_LOG_MAX_PAYLOAD bytes
+ * @return esp_err_t
+ *  - ESP_OK on success
+ *  - ESP_ERR_NOT_FOUND if session is not in index
+ *  - ESP_ERR_INVALID_STATE if session is still being written
+ *  - error of storage backend
+ */
+esp_err_t capture_log_seek_index_build(uint16_t session_id, capture_log_seek_index_t *index, uint8_t *payload);
+
+#endif
@@ -0,0 +1,63 @@
+/**
+ * @file crc32.c
+ * @brief Implements slicing-by-8 CRC-32 (reflected polynomial 0xEDB88320)
+ * 
+ * Slicing-by-8 processes 8 bytes per iteration using 8 lookup tables, which is several times
+ * faster than classic byte-wise table lookup on ESP32.
+ */
+#include "crc32.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#define CRC32_POLYNOMIAL 0xEDB88320
+
+static uint32_t crc32_tables[8][256];
+static bool crc32_tables_ready = false;
+
+void crc32_init(){
+    if(crc32_tables_ready){
+        return;
+    }
+    for(unsigned i = 0; i < 256; i++){
+        uint32_t crc = i;
+        for(unsigned bit = 0; bit < 8; bit++){
+            crc = (crc >> 1) ^ ((crc & 1) ? CRC32_POLYNOMIAL : 0);
+        }
+        crc32_tables[0][i] = crc;
+    }
+    for(unsigned i = 0; i < 256; i++){
+        for(unsigned slice = 1; slice < 8; slice++){
+            uint32_t previous = crc32_tables[slice - 1][i];
+            crc32_tables[slice][i] = (previous >> 8) ^ crc32_tables[0][previous & 0xff];
+        }
+    }
+    crc32_tables_ready = true;
+}
+
+uint32_t crc32_update(uint32_t crc, const uint8_t *data, unsigned length){
+    assert(crc32_tables_ready);
+    crc = ~crc;
+    // ESP32 doesn't support unaligned word loads
+    while((length > 0) && (((uintptr_t) data & 0x03) != 0)){
+        crc = crc32_tables[0][(crc ^ *data++) & 0xff] ^ (crc >> 8);
+        length--;
+    }
+    const uint32_t *words = (const uint32_t *) data;
+    while(length >= 8){
+        uint32_t one = *words++ ^ crc;
+        uint32_t two = *words++;
+        crc = crc32_tables[7][one & 0xff] ^ crc32_tables[6][(one >> 8) & 0xff] ^
+            crc32_tables[5][(one >> 16) & 0xff] ^ crc32_tables[4][one >> 24] ^
+            crc32_tables[3][two & 0xff] ^ crc32_tables[2][(two >> 8) & 0xff] ^
+            crc32_tables[1][(two >> 16) & 0xff] ^ crc32_tables[0][two >> 24];
+        length -= 8;
+    }
+    data = (const uint8_t *) words;
+    while(length > 0){
+        crc = crc32_tables[0][(crc ^ *data++) & 0xff] ^ (crc >> 8);
+        length--;
+    }
+    return ~crc;
+}
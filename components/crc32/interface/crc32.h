@@ -0,0 +1,31 @@
+/**
+ * @file crc32.h
+ * @brief Provides table-driven (slicing-by-8) CRC-32 used by IEEE 802.3/802.11 FCS, gzip and zlib
+ */
+#ifndef CRC32_H
+#define CRC32_H
+
+#include <stdint.h>
+
+/**
+ * @brief Generates lookup tables (8 kB).
+ * 
+ * Must be called once at boot, before any task can call crc32_update(). Tables are kept in RAM,
+ * which is faster than flash on ESP32, and are never written afterwards, so no synchronisation is needed.
+ */
+void crc32_init();
+
+/**
+ * @brief Updates running CRC-32 with next block of data.
+ * 
+ * Semantics are the same as zlib crc32(): start with 0 and pass returned value to next call.
+ * crc32_init() must be called before.
+ * 
+ * @param crc CRC of previous blocks or 0 for first block
+ * @param data 
+ * @param length length of data in bytes
+ * @return uint32_t CRC of all blocks so far
+ */
+uint32_t crc32_update(uint32_t crc, const uint8_t *data, unsigned length);
+
+#endif
@@ -0,0 +1,195 @@
+/**
+ * @file display.c
+ * @brief Implements framebuffer pipeline between drawing task and display task
+ */
+#include "display.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#define LOG_LOCAL_LEVEL CONFIG_DISPLAY_LOG_LEVEL
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "metrics.h"
+#include "task_topology.h"
+
+static const char *TAG = "display";
+
+/**
+ * @brief Frames passed from drawing task to display task
+ *
+ * Drawing task draws into back frame and presents it by swapping it with latest frame. Display task swaps
+ * latest frame with front frame when it's idle and flushes front frame. Frames presented while display task
+ * was busy are replaced by newer ones without ever being sent, so neither task waits for the other.
+ * @{
+ */
+static uint8_t frames[3][DISPLAY_FRAME_SIZE];
+static uint8_t *back_frame = frames[0];         // owned by drawing task
+static uint8_t *latest_frame = frames[1];
+static uint8_t *front_frame = frames[2];        // owned by display task
+static bool latest_frame_fresh = false;         // latest frame was not taken by display task yet
+static portMUX_TYPE frames_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t display_task_handle = NULL;
+//@}
+
+static const display_backend_t *backend = NULL;
+static uint8_t shadow[DISPLAY_FRAME_SIZE];      // content of display RAM
+static uint8_t shadow_valid_pages = 0;          // bitmask of pages whose shadow matches display RAM
+static portMUX_TYPE shadow_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Metrics of display pipeline
+ * @{
+ */
+METRICS_COUNTER_DEFINE(metric_bytes, "display_flushed_bytes_total", NULL, "Framebuffer bytes sent to display");
+METRICS_COUNTER_DEFINE(metric_coalesced, "display_coalesced_frames_total", NULL, "Frames replaced by newer ones before being sent to display");
+static const uint32_t flush_duration_bounds[] = { 1, 2, 5, 10, 20, 50, 100 };
+METRICS_HISTOGRAM_DEFINE(metric_flush_duration, "display_flush_duration_ms", NULL, "Time to send changed parts of one frame to display", flush_duration_bounds);
+//@}
+
+static esp_err_t headless_init(void) {
+    return ESP_OK;
+}
+
+static esp_err_t headless_write(const uint8_t *frame, uint8_t page, uint8_t first, uint8_t last) {
+    return ESP_OK;
+}
+
+const display_backend_t display_headless_backend = {
+    .name = "headless",
+    .init = headless_init,
+    .write = headless_write
+};
+
+/**
+ * @brief Sends only changed column range of every page of frame to backend
+ *
+ * Frame is compared against shadow of display RAM. Pages whose write failed are resent whole next time.
+ */
+static void display_flush(const uint8_t *frame) {
+    int64_t start = esp_timer_get_time();
+    for (uint8_t page = 0; page < DISPLAY_PAGES; page++) {
+        const uint8_t *row = &frame[page * DISPLAY_WIDTH];
+        uint8_t *shadow_row = &shadow[page * DISPLAY_WIDTH];
+        int first = 0;
+        int last = DISPLAY_WIDTH - 1;
+        if (shadow_valid_pages & (1 << page)) {
+            while ((first < DISPLAY_WIDTH) && (row[first] == shadow_row[first])) {
+                first++;
+            }
+            if (first == DISPLAY_WIDTH) {
+                continue;
+            }
+            while (row[last] == shadow_row[last]) {
+                last--;
+            }
+        }
+        if (backend->write(frame, page, first, last) != ESP_OK) {
+            shadow_valid_pages &= ~(1 << page);
+            continue;
+        }
+        portENTER_CRITICAL(&shadow_lock);
+        memcpy(&shadow_row[first], &row[first], last - first + 1);
+        portEXIT_CRITICAL(&shadow_lock);
+        shadow_valid_pages |= (1 << page);
+        metrics_counter_add(&metric_bytes, last - first + 1);
+    }
+    metrics_histogram_observe(&metric_flush_duration, (esp_timer_get_time() - start) / 1000);
+}
+
+/**
+ * @brief Takes latest frame if display task didn't flush it yet
+ *
+ * @return true if front frame now holds new frame
+ */
+static bool display_take_latest(void) {
+    portENTER_CRITICAL(&frames_lock);
+    bool fresh = latest_frame_fresh;
+    if (fresh) {
+        uint8_t *taken = latest_frame;
+        latest_frame = front_frame;
+        front_frame = taken;
+        latest_frame_fresh = false;
+    }
+    portEXIT_CRITICAL(&frames_lock);
+    return fresh;
+}
+
+/**
+ * @brief Flushes the latest presented frame whenever drawing task presents one
+ */
+static void display_task(void *arg) {
+    display_flush(front_frame);
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while (display_take_latest()) {
+            display_flush(front_frame);
+        }
+    }
+}
+
+esp_err_t display_start(const display_backend_t *display_backend) {
+    esp_err_t err = display_backend->init();
+    if (err == ESP_OK) {
+        backend = display_backend;
+    } else {
+        ESP_LOGW(TAG, "Backend %s failed to initialise (%d), display output falls back to headless", display_backend->name, err);
+        backend = &display_headless_backend;
+    }
+    ESP_LOGI(TAG, "Using %s backend", backend->name);
+    metrics_register(&metric_bytes);
+    metrics_register(&metric_coalesced);
+    metrics_register(&metric_flush_duration);
+    xTaskCreatePinnedToCore(display_task, "display", TASK_TOPOLOGY_DISPLAY_STACK_SIZE, NULL,
+        TASK_TOPOLOGY_DISPLAY_PRIORITY, &display_task_handle, TASK_TOPOLOGY_DISPLAY_CORE);
+    return err;
+}
+
+uint8_t *display_frame(void) {
+    return back_frame;
+}
+
+void display_present(void) {
+    portENTER_CRITICAL(&frames_lock);
+    uint8_t *presented = back_frame;
+    back_frame = latest_frame;
+    latest_frame = presented;
+    bool coalesced = latest_frame_fresh;
+    latest_frame_fresh = true;
+    portEXIT_CRITICAL(&frames_lock);
+    if (coalesced) {
+        metrics_counter_inc(&metric_coalesced);
+    }
+    if (display_task_handle) {
+        xTaskNotifyGive(display_task_handle);
+    }
+}
+
+void display_snapshot(uint8_t *frame) {
+    portENTER_CRITICAL(&shadow_lock);
+    memcpy(frame, shadow, DISPLAY_FRAME_SIZE);
+    portEXIT_CRITICAL(&shadow_lock);
+}
+
+esp_err_t display_write_pbm(const uint8_t *frame, display_pbm_writer_t writer, void *ctx) {
+    static const char header[] = "P4\n128 64\n";
+    _Static_assert((DISPLAY_WIDTH == 128) && (DISPLAY_HEIGHT == 64), "PBM header doesn't match display size");
+    esp_err_t err = writer(ctx, (const uint8_t *) header, sizeof(header) - 1);
+    uint8_t row[DISPLAY_WIDTH / 8];
+    for (unsigned y = 0; (y < DISPLAY_HEIGHT) && (err == ESP_OK); y++) {
+        const uint8_t *page = &frame[(y / 8) * DISPLAY_WIDTH];
+        uint8_t bit = 1 << (y % 8);
+        memset(row, 0, sizeof(row));
+        for (unsigned x = 0; x < DISPLAY_WIDTH; x++) {
+            // PBM 1 is black, lit OLED pixel is drawn white
+            if (!(page[x] & bit)) {
+                row[x / 8] |= 0x80 >> (x % 8);
+            }
+        }
+        err = writer(ctx, row, sizeof(row));
+    }
+    return err;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file display_ssd1306.c
+ * @brief Implements display backend for SSD1306 OLED connected over I2C
+ */
+#include "display.h"
+
+#define LOG_LOCAL_LEVEL CONFIG_DISPLAY_LOG_LEVEL
+#include "esp_log.h"
+#include "driver/i2c.h"
+#include "freertos/FreeRTOS.h"
+
+static const char *TAG = "display_ssd1306";
+
+#define I2C_MASTER_SCL_IO 33
+#define I2C_MASTER_SDA_IO 32
+#define I2C_MASTER_NUM I2C_NUM_0
+#define I2C_MASTER_FREQ_HZ 400000
+#define SSD1306_ADDR 0x3C
+
+/**
+ * @brief SSD1306 control bytes and commands used for partial updates
+ * @{
+ */
+#define SSD1306_CONTROL_COMMAND 0x80    // Co = 1, another control byte follows
+#define SSD1306_CONTROL_DATA 0x40       // Co = 0, rest of transaction is data
+#define SSD1306_SET_COLUMN_ADDRESS 0x21
+#define SSD1306_SET_PAGE_ADDRESS 0x22
+//@}
+
+static esp_err_t i2c_master_init(void){
+    i2c_config_t conf = {
+        .mode = I2C_MODE_MASTER,
+        .sda_io_num = I2C_MASTER_SDA_IO,
+        .sda_pullup_en = GPIO_PULLUP_ENABLE,
+        .scl_io_num = I2C_MASTER_SCL_IO,
+        .scl_pullup_en = GPIO_PULLUP_ENABLE,
+        .master = {
+            .clk_speed = I2C_MASTER_FREQ_HZ
+        }
+    };
+    esp_err_t ret = i2c_param_config(I2C_MASTER_NUM, &conf);
+    if(ret != ESP_OK){
+        ESP_LOGE(TAG,"i2c_param_config failed: %d", ret);
+        return ret;
+    }
+    ret = i2c_driver_install(I2C_MASTER_NUM, I2C_MODE_MASTER, 0, 0, 0);
+    if(ret != ESP_OK){
+        ESP_LOGE(TAG,"i2c_driver_install failed: %d", ret);
+    }
+    return ret;
+}
+
+static esp_err_t ssd1306_init(void) {
+    esp_err_t err = i2c_master_init();
+    if (err != ESP_OK) {
+        return err;
+    }
+    uint8_t init_sequence[] = {
+        0xAE, 0xD5, 0x80, 0xA8, 0x3F, 0xD3, 0x00, 0x40,
+        0x8D, 0x14, 0x20, 0x00, 0xA1, 0xC8, 0xDA, 0x12,
+        0x81, 0xCF, 0xD9, 0xF1, 0xDB, 0x40, 0xA4, 0xA6, 0xAF
+    };
+
+    for (size_t i = 0; (i < sizeof(init_sequence)) && (err == ESP_OK); i++) {
+        uint8_t cmd = init_sequence[i];
+        i2c_cmd_handle_t cmd_handle = i2c_cmd_link_create();
+        i2c_master_start(cmd_handle);
+        i2c_master_write_byte(cmd_handle, (SSD1306_ADDR << 1) | I2C_MASTER_WRITE, true);
+        i2c_master_write_byte(cmd_handle, 0x00, true);  // command
+        i2c_master_write_byte(cmd_handle, cmd, true);
+        i2c_master_stop(cmd_handle);
+        err = i2c_master_cmd_begin(I2C_MASTER_NUM, cmd_handle, pdMS_TO_TICKS(10));
+        i2c_cmd_link_delete(cmd_handle);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Display doesn't respond: %d", err);
+        i2c_driver_delete(I2C_MASTER_NUM);
+    }
+    return err;
+}
+
+/**
+ * @brief Sends columns [first, last] of one page in single I2C transaction
+ *
+ * Column and page address window is set by commands at the start of the same transaction,
+ * display then auto-increments column address within the window (horizontal addressing mode).
+ * i2c_master_cmd_begin() is served by I2C driver interrupt, calling task is blocked meanwhile.
+ */
+static esp_err_t ssd1306_write(const uint8_t *frame, uint8_t page, uint8_t first, uint8_t last) {
+    const uint8_t setup[] = {
+        SSD1306_CONTROL_COMMAND, SSD1306_SET_COLUMN_ADDRESS, SSD1306_CONTROL_COMMAND, first, SSD1306_CONTROL_COMMAND, last,
+        SSD1306_CONTROL_COMMAND, SSD1306_SET_PAGE_ADDRESS, SSD1306_CONTROL_COMMAND, page, SSD1306_CONTROL_COMMAND, page,
+        SSD1306_CONTROL_DATA
+    };
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, (SSD1306_ADDR << 1) | I2C_MASTER_WRITE, true);
+    i2c_master_write(cmd, (uint8_t *) setup, sizeof(setup), true);
+    i2c_master_write(cmd, (uint8_t *) &frame[page * DISPLAY_WIDTH + first], last - first + 1, true);
+    i2c_master_stop(cmd);
+    esp_err_t err = i2c_master_cmd_begin(I2C_MASTER_NUM, cmd, pdMS_TO_TICKS(20));
+    i2c_cmd_link_delete(cmd);
+    return err;
+}
+
+const display_backend_t display_ssd1306_backend = {
+    .name = "ssd1306",
+    .init = ssd1306_init,
+    .write = ssd1306_write
+};
@@ -0,0 +1,90 @@
+/**
+ * @file display.h
+ * @brief Provides 128x64 monochrome framebuffer pipeline with pluggable display backend
+ *
+ * Caller draws into back frame returned by display_frame() (see display_draw.h) and presents it by display_present(),
+ * which never blocks. Display task sends the latest presented frame to backend; frames presented while it was busy
+ * are replaced by newer ones. Only column ranges that changed since the previous flush are passed to backend.
+ *
+ * Frame layout follows SSD1306 display RAM: DISPLAY_PAGES pages of DISPLAY_WIDTH bytes, each byte is vertical
+ * column of 8 pixels with the least significant bit on top.
+ */
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "display_draw.h"
+
+/**
+ * @brief Interface of display hardware
+ */
+typedef struct {
+    const char *name;
+    /**
+     * @brief Initialises hardware, called once from display_start()
+     */
+    esp_err_t (*init)(void);
+    /**
+     * @brief Writes columns [first, last] of one page of frame to display
+     */
+    esp_err_t (*write)(const uint8_t *frame, uint8_t page, uint8_t first, uint8_t last);
+} display_backend_t;
+
+/**
+ * @brief SSD1306 OLED on I2C (SDA GPIO32, SCL GPIO33, address 0x3C)
+ */
+extern const display_backend_t display_ssd1306_backend;
+
+/**
+ * @brief Backend without hardware, frames are only kept for display_snapshot()
+ */
+extern const display_backend_t display_headless_backend;
+
+/**
+ * @brief Writer of PBM image
+ *
+ * @param ctx context passed to display_write_pbm()
+ * @param data
+ * @param length
+ */
+typedef esp_err_t (*display_pbm_writer_t)(void *ctx, const uint8_t *data, unsigned length);
+
+/**
+ * @brief Initialises backend and starts display task.
+ *
+ * If backend fails to initialise, display falls back to headless backend, so snapshots keep working.
+ *
+ * @param backend
+ * @return esp_err_t result of backend initialisation
+ */
+esp_err_t display_start(const display_backend_t *backend);
+
+/**
+ * @brief Returns back frame owned by caller. It has to be redrawn from scratch after every display_present().
+ */
+uint8_t *display_frame(void);
+
+/**
+ * @brief Publishes back frame as the latest frame and wakes up display task. Never blocks.
+ */
+void display_present(void);
+
+/**
+ * @brief Copies frame that was last flushed to backend.
+ *
+ * @param[out] frame DISPLAY_FRAME_SIZE bytes
+ */
+void display_snapshot(uint8_t *frame);
+
+/**
+ * @brief Writes frame as binary PBM (P4) image with lit pixels white.
+ *
+ * @param frame
+ * @param writer
+ * @param ctx context passed to writer
+ * @return esp_err_t ESP_OK or first error returned by writer
+ */
+esp_err_t display_write_pbm(const uint8_t *frame, display_pbm_writer_t writer, void *ctx);
+
+#endif
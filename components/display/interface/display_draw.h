@@ -0,0 +1,54 @@
+/**
+ * @file display_draw.h
+ * @brief Provides text drawing into framebuffer
+ *
+ * Drawing functions depend only on C standard library, so they can be compiled on host as well.
+ */
+#ifndef DISPLAY_DRAW_H
+#define DISPLAY_DRAW_H
+
+#include <stdint.h>
+
+/**
+ * @brief Framebuffer geometry
+ * @{
+ */
+#define DISPLAY_WIDTH 128
+#define DISPLAY_HEIGHT 64
+#define DISPLAY_PAGES (DISPLAY_HEIGHT / 8)
+#define DISPLAY_FRAME_SIZE (DISPLAY_WIDTH * DISPLAY_PAGES)
+//@}
+
+/**
+ * @brief Width of single character including spacing column
+ */
+#define DISPLAY_CHAR_WIDTH 6
+
+/**
+ * @brief Turns all pixels of frame off
+ */
+void display_draw_clear(uint8_t *frame);
+
+/**
+ * @brief Draws single 5x7 character
+ *
+ * Characters outside printable ASCII are drawn as '?'.
+ * @param frame
+ * @param x left column
+ * @param y top row, rounded down to page
+ * @param c
+ * @return int number of columns to advance, 0 if character is out of frame
+ */
+int display_draw_char(uint8_t *frame, int x, int y, char c);
+
+/**
+ * @brief Draws text on single line, clipped at the right edge
+ *
+ * @param frame
+ * @param x left column
+ * @param y top row, must be multiple of 8 (page aligned)
+ * @param text null-terminated string
+ */
+void display_draw_text(uint8_t *frame, int x, int y, const char *text);
+
+#endif
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Drives display UI of running device by scripted button input and compares screens with golden images.
+
+Buttons are injected through /button endpoint, screens are downloaded from /screen.pbm endpoint.
+Script is a text file with one command per line, '#' starts a comment:
+
+    click <up|middle|down>              press and release
+    event <up|middle|down> <press|long|repeat|release>
+    wait <ms>
+    screen <name>                       compare display with <golden dir>/<name>.pbm
+
+Usage: display_script.py [--update] <device address> <script> <golden dir>
+
+With --update, golden images are (re)written from the device instead of being compared.
+Exits with non-zero status if any screen differs.
+"""
+import os
+import sys
+import time
+import urllib.request
+
+SETTLE_SECONDS = 0.1    # display task flushes asynchronously after UI handles input
+
+
+def post_event(address, button, event):
+    request = urllib.request.Request('http://%s/button/%s/%s' % (address, button, event), data=b'', method='POST')
+    urllib.request.urlopen(request).read()
+
+
+def get_screen(address):
+    time.sleep(SETTLE_SECONDS)
+    return urllib.request.urlopen('http://%s/screen.pbm' % address).read()
+
+
+def run(address, script_path, golden_dir, update):
+    failures = 0
+    with open(script_path) as script:
+        for number, line in enumerate(script, 1):
+            words = line.split('#', 1)[0].split()
+            if not words:
+                continue
+            command, args = words[0], words[1:]
+            if command == 'click':
+                post_event(address, args[0], 'press')
+                post_event(address, args[0], 'release')
+            elif command == 'event':
+                post_event(address, args[0], args[1])
+            elif command == 'wait':
+                time.sleep(int(args[0]) / 1000)
+            elif command == 'screen':
+                path = os.path.join(golden_dir, args[0] + '.pbm')
+                screen = get_screen(address)
+                if update:
+                    with open(path, 'wb') as file:
+                        file.write(screen)
+                    print('%s: written' % path)
+                else:
+                    with open(path, 'rb') as file:
+                        golden = file.read()
+                    if screen != golden:
+                        failures += 1
+                        with open(path + '.actual', 'wb') as file:
+                            file.write(screen)
+                        print('%s: differs, actual screen saved to %s.actual' % (path, path))
+            else:
+                sys.exit('%s:%u: unknown command %s' % (script_path, number, command))
+    return failures
+
+
+def main():
+    args = sys.argv[1:]
+    update = '--update' in args
+    if update:
+        args.remove('--update')
+    if len(args) != 3:
+        sys.exit(__doc__)
+    os.makedirs(args[2], exist_ok=True)
+    sys.exit(1 if run(args[0], args[1], args[2], update) else 0)
+
+
+if __name__ == '__main__':
+    main()
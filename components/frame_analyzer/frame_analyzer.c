@@ -11,21 +11,116 @@
 #include <stdint.h>
 #include <string.h>
 
-#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#define LOG_LOCAL_LEVEL CONFIG_FRAME_ANALYZER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
+#include "esp_timer.h"
 
 #include "wifi_controller.h"
 #include "frame_analyzer_parser.h"
+#include "station_inventory.h"
+#include "mac_address.h"
+#include "metrics.h"
+#include "frame_trace.h"
+#include "binary_log.h"
 
 static const char *TAG = "frame_analyzer";
-static uint8_t target_bssid[6];
-static search_type_t search_type = -1;
+MAC_SET_DEFINE(target_bssids, FRAME_ANALYZER_MAX_TARGETS * 2);
+static uint32_t objectives = 0;
+static frame_analyzer_stats_t stats;
 
+/**
+ * @brief Metrics of data frame analysis
+ * @{
+ */
+METRICS_COUNTER_DEFINE(metric_data_frames, "frame_analyzer_data_frames_total", NULL, "Data frames delivered to analyzer");
+METRICS_COUNTER_DEFINE(metric_target_frames, "frame_analyzer_target_frames_total", NULL, "Data frames belonging to target BSSIDs");
+METRICS_COUNTER_DEFINE(metric_eapol_key_frames, "frame_analyzer_eapol_key_frames_total", NULL, "Data frames carrying EAPoL-Key packet");
+static const uint32_t handler_duration_bounds[] = { 5, 10, 25, 50, 100, 250, 1000 };
+METRICS_HISTOGRAM_DEFINE(metric_handler_duration, "frame_analyzer_handler_duration_us", NULL,
+    "Time spent parsing and dispatching one target data frame", handler_duration_bounds);
+//@}
+
+
+/**
+ * @brief Determines whether frame belongs to any of the target BSSIDs
+ * 
+ * @param frame 
+ * @return true if BSSID of the frame is one of target BSSIDs
+ */
+static bool is_frame_target_matching(wifi_promiscuous_pkt_t *frame){
+    data_frame_mac_header_t *mac_header = (data_frame_mac_header_t *) frame->payload;
+    return mac_set_contains(&target_bssids, mac_load(mac_header->addr3));
+}
+
+/**
+ * @brief Extracts PMKIDs from EAPoL-Key packet and posts them to event pool
+ * 
+ * @param frame 
+ * @param eapol_packet EAPoL packet with EAPoL-Key parsed from frame
+ */
+static void pmkid_consumer(wifi_promiscuous_pkt_t *frame, eapol_packet_t *eapol_packet){
+    unsigned eapol_length = eapol_captured_length(frame->payload, frame->rx_ctrl.sig_len, eapol_packet);
+    eapol_key_layout_t layout;
+    if((eapol_length == 0) || !parse_eapol_key_layout(eapol_packet, eapol_length, &layout)){
+        return;
+    }
+    uint8_t pmkids[FRAME_ANALYZER_MAX_PMKIDS][PMKID_LEN];
+    unsigned pmkid_count = parse_pmkid(&layout, pmkids, FRAME_ANALYZER_MAX_PMKIDS);
+    if(pmkid_count == 0){
+        return;
+    }
+    if(objectives & FRAME_ANALYZER_OBJECTIVE_STATS){
+        stats.pmkids += pmkid_count;
+    }
+    data_frame_mac_header_t *mac_header = (data_frame_mac_header_t *) frame->payload;
+    pmkid_records_t pmkid_records = { .count = pmkid_count };
+    for(unsigned i = 0; i < pmkid_count; i++){
+        memcpy(pmkid_records.records[i].mac_ap, mac_header->addr2, 6);
+        memcpy(pmkid_records.records[i].mac_sta, mac_header->addr1, 6);
+        memcpy(pmkid_records.records[i].pmkid, pmkids[i], PMKID_LEN);
+    }
+    ESP_ERROR_CHECK(esp_event_post(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_PMKID, &pmkid_records, sizeof(pmkid_records_t), portMAX_DELAY));
+}
+
+/**
+ * @brief Updates session statistics and station inventory
+ * 
+ * Station is the address on the other side of the frame than BSSID.
+ * 
+ * @param frame 
+ * @param eapol true if frame carries EAPoL-Key packet
+ */
+static void stats_consumer(wifi_promiscuous_pkt_t *frame, bool eapol){
+    if(stats.data_frames == 0){
+        stats.first_data_time = esp_timer_get_time() / 1000;
+    }
+    stats.data_frames++;
+    stats.data_bytes += frame->rx_ctrl.sig_len;
+    if(eapol){
+        if(stats.eapol_key_frames == 0){
+            stats.first_eapol_time = esp_timer_get_time() / 1000;
+        }
+        stats.eapol_key_frames++;
+    }
+
+    data_frame_mac_header_t *mac_header = (data_frame_mac_header_t *) frame->payload;
+    mac_t bssid = mac_load(mac_header->addr3);
+    if(mac_load(mac_header->addr2) == bssid){
+        // From AP to STA
+        station_inventory_update(mac_header->addr1, mac_header->addr3, frame->rx_ctrl.rssi, false, frame->rx_ctrl.sig_len, eapol);
+    }
+    else if(mac_load(mac_header->addr1) == bssid){
+        // From STA to AP
+        station_inventory_update(mac_header->addr2, mac_header->addr3, frame->rx_ctrl.rssi, true, frame->rx_ctrl.sig_len, eapol);
+    }
+}
 
 /**
  * @brief Analyzes data frames from sniffer.
+ * 
+ * Frame is parsed once and passed to every consumer requested by current objectives.
  *  
  * @param args 
  * @param event_base 
@@ -33,49 +128,81 @@ static search_type_t search_type = -1;
  * @param event_data 
  */
 static void data_frame_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
-    ESP_LOGV(TAG, "Handling DATA frame");
+    BINARY_LOGV(TAG, "Handling DATA frame");
     wifi_promiscuous_pkt_t *frame = (wifi_promiscuous_pkt_t *) event_data;
+    FRAME_TRACE_ASYNC_END(FRAME_TRACE_STAGE_QUEUE_DWELL, frame->rx_ctrl.timestamp);
+    metrics_counter_inc(&metric_data_frames);
 
-    if(!is_frame_bssid_matching(frame, target_bssid)){
-        ESP_LOGV(TAG, "Not matching BSSIDs.");
+    if(!is_frame_target_matching(frame)){
+        BINARY_LOGV(TAG, "Not matching BSSIDs.");
         return;
     }
+    metrics_counter_inc(&metric_target_frames);
+    int64_t start = esp_timer_get_time();
+    FRAME_TRACE_BEGIN(trace_start);
 
-    eapol_packet_t *eapol_packet = parse_eapol_packet((data_frame_t *) frame->payload);
-    if(eapol_packet == NULL){
-        ESP_LOGV(TAG, "Not an EAPOL packet.");
-        return;
+    eapol_packet_t *eapol_packet = NULL;
+    eapol_key_packet_t *eapol_key_packet = NULL;
+    if(objectives & (FRAME_ANALYZER_OBJECTIVE_HANDSHAKE | FRAME_ANALYZER_OBJECTIVE_PMKID | FRAME_ANALYZER_OBJECTIVE_STATS)){
+        eapol_packet = parse_eapol_packet((data_frame_t *) frame->payload);
+        if(eapol_captured_length(frame->payload, frame->rx_ctrl.sig_len, eapol_packet) == 0){
+            eapol_packet = NULL;
+        }
+        eapol_key_packet = parse_eapol_key_packet(eapol_packet);
+    }
+
+    if(objectives & FRAME_ANALYZER_OBJECTIVE_STATS){
+        stats_consumer(frame, eapol_key_packet != NULL);
     }
 
-    eapol_key_packet_t *eapol_key_packet = parse_eapol_key_packet(eapol_packet);
     if(eapol_key_packet == NULL){
-        ESP_LOGV(TAG, "Not an EAPOL-Key packet");
+        BINARY_LOGV(TAG, "Not an EAPOL-Key packet");
+        metrics_histogram_observe(&metric_handler_duration, esp_timer_get_time() - start);
+        FRAME_TRACE_END(FRAME_TRACE_STAGE_ANALYZER_PARSE, trace_start);
         return;
     }
+    metrics_counter_inc(&metric_eapol_key_frames);
 
-    if(search_type == SEARCH_HANDSHAKE){
+    if(objectives & FRAME_ANALYZER_OBJECTIVE_HANDSHAKE){
         // TODO handle timeouts properly by e.g. for cycle
+        FRAME_TRACE_ASYNC_BEGIN(FRAME_TRACE_STAGE_QUEUE_DWELL, frame->rx_ctrl.timestamp);
         ESP_ERROR_CHECK_WITHOUT_ABORT(esp_event_post(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_EAPOLKEY_FRAME, frame, sizeof(wifi_promiscuous_pkt_t) + frame->rx_ctrl.sig_len, portMAX_DELAY));
-        return;
     }
 
-    if(search_type == SEARCH_PMKID){
-        pmkid_item_t *pmkid_items;
-        if((pmkid_items = parse_pmkid(eapol_key_packet)) == NULL){
-            return;
-        }
-        ESP_ERROR_CHECK(esp_event_post(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_PMKID, &pmkid_items, sizeof(pmkid_item_t *), portMAX_DELAY));
-        return;
+    if(objectives & FRAME_ANALYZER_OBJECTIVE_PMKID){
+        pmkid_consumer(frame, eapol_packet);
     }
+    metrics_histogram_observe(&metric_handler_duration, esp_timer_get_time() - start);
+    FRAME_TRACE_END(FRAME_TRACE_STAGE_ANALYZER_PARSE, trace_start);
 }
 
-void frame_analyzer_capture_start(search_type_t search_type_arg, const uint8_t *bssid){
+void frame_analyzer_capture_start(uint32_t objectives_arg, const uint8_t *const *bssids, unsigned bssids_count){
     ESP_LOGI(TAG, "Frame analysis started...");
-    search_type = search_type_arg;
-    memcpy(&target_bssid, bssid, 6);
+    objectives = objectives_arg;
+    memset(&stats, 0, sizeof(stats));
+    metrics_register(&metric_data_frames);
+    metrics_register(&metric_target_frames);
+    metrics_register(&metric_eapol_key_frames);
+    metrics_register(&metric_handler_duration);
+    if(objectives & FRAME_ANALYZER_OBJECTIVE_STATS){
+        station_inventory_reset();
+    }
+    // Target set is read by the handler without locking, so it must be complete before the handler is registered
+    mac_set_clear(&target_bssids);
+    if(bssids_count > FRAME_ANALYZER_MAX_TARGETS){
+        ESP_LOGE(TAG, "Too many target BSSIDs (max %u)", FRAME_ANALYZER_MAX_TARGETS);
+        bssids_count = FRAME_ANALYZER_MAX_TARGETS;
+    }
+    for(unsigned i = 0; i < bssids_count; i++){
+        mac_set_insert(&target_bssids, mac_load(bssids[i]));
+    }
     ESP_ERROR_CHECK(esp_event_handler_register(SNIFFER_EVENTS, SNIFFER_EVENT_CAPTURED_DATA, &data_frame_handler, NULL));
 }
 
+const frame_analyzer_stats_t *frame_analyzer_get_stats(){
+    return &stats;
+}
+
 void frame_analyzer_capture_stop(){
     ESP_ERROR_CHECK(esp_event_handler_unregister(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID, &data_frame_handler));
 }
@@ -13,11 +13,14 @@
 #include <string.h>
 #include "arpa/inet.h"
 
-#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#define LOG_LOCAL_LEVEL CONFIG_FRAME_ANALYZER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_wifi_types.h"
 
+#include "binary_log.h"
+
 #include "frame_analyzer_types.h"
+#include "mac_address.h"
 
 static const char *TAG = "frame_analyzer:parser";
 
@@ -29,10 +32,7 @@ ESP_EVENT_DEFINE_BASE(FRAME_ANALYZER_EVENTS);
  * @param frame 
  */
 void print_raw_frame(const wifi_promiscuous_pkt_t *frame){
-    for(unsigned i = 0; i < frame->rx_ctrl.sig_len; i++) {
-        printf("%02x", frame->payload[i]);
-    }
-    printf("\n");
+    ESP_LOG_BUFFER_HEX_LEVEL(TAG, frame->payload, frame->rx_ctrl.sig_len, ESP_LOG_VERBOSE);
 }
 
 /**
@@ -41,26 +41,24 @@ void print_raw_frame(const wifi_promiscuous_pkt_t *frame){
  * @param a mac address buffer
  */
 void print_mac_address(const uint8_t *a){
-    printf("%02x:%02x:%02x:%02x:%02x:%02x",
-    a[0], a[1], a[2], a[3], a[4], a[5]);
-    printf("\n");
+    ESP_LOGV(TAG, "%02x:%02x:%02x:%02x:%02x:%02x", a[0], a[1], a[2], a[3], a[4], a[5]);
 }
 
 bool is_frame_bssid_matching(wifi_promiscuous_pkt_t *frame, uint8_t *bssid) {
     data_frame_mac_header_t *mac_header = (data_frame_mac_header_t *) frame->payload;
-    return memcmp(mac_header->addr3, bssid, 6) == 0;
+    return mac_bytes_equal(mac_header->addr3, bssid);
 }
 
 eapol_packet_t *parse_eapol_packet(data_frame_t *frame) {
     uint8_t *frame_buffer = frame->body;
 
     if(frame->mac_header.frame_control.protected_frame == 1) {
-        ESP_LOGV(TAG, "Protected frame, skipping...");
+        BINARY_LOGV(TAG, "Protected frame, skipping...");
         return NULL;
     }
 
     if(frame->mac_header.frame_control.subtype > 7) {
-        ESP_LOGV(TAG, "QoS data frame");
+        BINARY_LOGV(TAG, "QoS data frame");
         // Skipping QoS field (2 bytes)
         frame_buffer += 2;
     }
@@ -70,85 +68,132 @@ eapol_packet_t *parse_eapol_packet(data_frame_t *frame) {
 
     // Check if frame is type of EAPoL
     if(ntohs(*(uint16_t *) frame_buffer) == ETHER_TYPE_EAPOL) {
-        ESP_LOGD(TAG, "EAPOL packet");
+        BINARY_LOGD(TAG, "EAPOL packet");
         frame_buffer += 2;
         return (eapol_packet_t *) frame_buffer; 
     }
     return NULL;
 }
 
+unsigned eapol_captured_length(const void *frame, unsigned frame_length, const eapol_packet_t *eapol_packet){
+    if(eapol_packet == NULL){
+        return 0;
+    }
+    unsigned offset = (const uint8_t *) eapol_packet - (const uint8_t *) frame;
+    if((offset > frame_length) || (frame_length - offset < sizeof(eapol_packet_header_t))){
+        BINARY_LOGD(TAG, "EAPoL header beyond captured frame (%u/%u)", offset, frame_length);
+        return 0;
+    }
+    return frame_length - offset;
+}
+
 eapol_key_packet_t *parse_eapol_key_packet(eapol_packet_t *eapol_packet){
+    if(eapol_packet == NULL){
+        return NULL;
+    }
     if(eapol_packet->header.packet_type != EAPOL_KEY){
-        ESP_LOGD(TAG, "Not an EAPoL-Key packet.");
+        BINARY_LOGD(TAG, "Not an EAPoL-Key packet.");
         return NULL;
     }
     return (eapol_key_packet_t *) eapol_packet->packet_body;
 }
 
 /**
- * @brief Parses all PMKIDs to linked list structure 
+ * @brief Parses all PMKIDs from key data buffer into given array
  * 
- * It crawlers through key data buffer and looks for PMKIDs.
- * If PMKID element is found, its saved into the list of PMKIDs.
+ * It crawls through key data buffer and looks for PMKID KDEs.
+ * Every KDE is checked to fit into the buffer before it's accessed. Walking stops on padding,
+ * on malformed KDE or when the output array is full.
  * @param key_data 
  * @param length of key data
- * @return pmkid_item_t* 
+ * @param pmkids output array
+ * @param max_count capacity of output array
+ * @return unsigned number of PMKIDs found
  */
-static pmkid_item_t *parse_pmkid_from_key_data(uint8_t *key_data, const uint16_t length){
-    uint8_t *key_data_index = key_data;
-    uint8_t *key_data_max_index = key_data + length;
-
-    pmkid_item_t *pmkid_item_head = NULL;
-    key_data_field_t *key_data_field;
-    do{
-        key_data_field = (key_data_field_t *) key_data_index;
-
-        ESP_LOGV(TAG, "EAPOL-Key -> Key-Data -> type=%x; length=%x; oui=%x; data_type=%x",
-                    key_data_field->type, 
-                    key_data_field->length, 
-                    key_data_field->oui,
-                    key_data_field->data_type);
-        
-        if(key_data_field->type != KEY_DATA_TYPE){
-            ESP_LOGD(TAG, "Wrong type %x (expected %x)", key_data_field->type, KEY_DATA_TYPE);
-            continue;
-        }
+static unsigned parse_pmkid_from_key_data(const uint8_t *key_data, const unsigned length, uint8_t pmkids[][PMKID_LEN], unsigned max_count){
+    unsigned pmkid_count = 0;
+    unsigned index = 0;
 
-        if(ntohl(key_data_field->oui) != KEY_DATA_OUI_IEEE80211){
-            ESP_LOGD(TAG, "Wrong OUI %x (expected %x)", key_data_field->oui, KEY_DATA_OUI_IEEE80211);
-            continue;
-        }
+    while((index + KEY_DATA_FIELD_HEADER_LEN <= length) && (pmkid_count < max_count)){
+        const key_data_field_t *key_data_field = (const key_data_field_t *) &key_data[index];
+        unsigned next_index = index + KEY_DATA_FIELD_HEADER_LEN + key_data_field->length;
 
-        if(key_data_field->data_type != KEY_DATA_DATA_TYPE_PMKID_KDE){
-            ESP_LOGD(TAG, "Wrong data type %x (expected %x)", key_data_field->data_type, KEY_DATA_DATA_TYPE_PMKID_KDE);
-            continue;
+        if(next_index > length){
+            // Truncated or malformed KDE
+            break;
         }
-
-        ESP_LOGI(TAG, "Found PMKID: ");
-        pmkid_item_t *pmkid_item = (pmkid_item_t *) malloc(sizeof(pmkid_item_t));
-        pmkid_item->next = pmkid_item_head;
-        pmkid_item_head = pmkid_item;
-        for(unsigned i = 0; i < 16; i++){
-            pmkid_item->pmkid[i] = key_data_field->data[i];
-            printf("%02x", pmkid_item->pmkid[i]);
+        if((key_data_field->type == KEY_DATA_TYPE) && (key_data_field->length == 0)){
+            // Padding - 0xdd followed by zeros, no more KDEs follow
+            // Ref: 802.11-2016 [12.7.2 j)]
+            break;
         }
-        printf("\n");
-
-    } while((key_data_index = key_data_field->data + key_data_field->length - 4 + 1) < key_data_max_index); 
+        if((key_data_field->type == KEY_DATA_TYPE)
+            && (key_data_field->length >= KEY_DATA_FIELD_OUI_TYPE_LEN + PMKID_LEN)
+            && (ntohl(key_data_field->oui) == KEY_DATA_OUI_IEEE80211)
+            && (key_data_field->data_type == KEY_DATA_DATA_TYPE_PMKID_KDE)){
+            memcpy(pmkids[pmkid_count], key_data_field->data, PMKID_LEN);
+            pmkid_count++;
+        }
+        index = next_index;
+    }
 
-    return pmkid_item_head;
+    return pmkid_count;
 }
 
-pmkid_item_t *parse_pmkid(eapol_key_packet_t *eapol_key){
-    if(eapol_key->key_data_length == 0){
-        ESP_LOGD(TAG, "Empty Key Data");
-        return NULL;
+bool parse_eapol_key_layout(const eapol_packet_t *eapol_packet, unsigned eapol_length, eapol_key_layout_t *layout){
+    if((eapol_length < sizeof(eapol_packet_header_t)) || (eapol_packet->header.packet_type != EAPOL_KEY)){
+        return false;
+    }
+    unsigned body_length = ntohs(eapol_packet->header.packet_body_length);
+    if(sizeof(eapol_packet_header_t) + body_length > eapol_length){
+        // EAPoL body is not fully captured
+        return false;
+    }
+    if(body_length < EAPOL_KEY_MIC_OFFSET){
+        return false;
+    }
+    const eapol_key_packet_t *eapol_key = (const eapol_key_packet_t *) eapol_packet->packet_body;
+    const uint8_t *body = eapol_packet->packet_body;
+    layout->packet = eapol_key;
+    layout->descriptor_version = eapol_key->key_information.key_descriptor_version;
+
+    if(layout->descriptor_version != KEY_DESCRIPTOR_VERSION_AKM_DEFINED){
+        // Fast path - fixed 16 bytes MIC
+        if(body_length < sizeof(eapol_key_packet_t)){
+            return false;
+        }
+        layout->mic_length = sizeof(eapol_key->key_mic);
+        layout->mic = eapol_key->key_mic;
+        layout->key_data_length = ntohs(eapol_key->key_data_length);
+        layout->key_data = eapol_key->key_data;
+        return layout->key_data_length <= body_length - sizeof(eapol_key_packet_t);
     }
 
-    if(eapol_key->key_information.encrypted_key_data == 1){
-        ESP_LOGD(TAG, "Key Data encrypted");
-        return NULL;
+    // AKM-defined descriptor: 16 bytes MIC for most AKMs (SAE, OWE, PSK-SHA256...), 
+    // 24 bytes for Suite B 192-bit and FT-802.1X-SHA384, none for FILS
+    // Ref: 802.11-2016 [Table 12-8]
+    static const uint8_t mic_lengths[] = { 16, EAPOL_KEY_MAX_MIC_LEN, 0 };
+    for(unsigned i = 0; i < sizeof(mic_lengths); i++){
+        unsigned key_data_length_offset = EAPOL_KEY_MIC_OFFSET + mic_lengths[i];
+        if(key_data_length_offset + 2 > body_length){
+            continue;
+        }
+        unsigned key_data_length = (body[key_data_length_offset] << 8) | body[key_data_length_offset + 1];
+        if(key_data_length_offset + 2 + key_data_length == body_length){
+            layout->mic_length = mic_lengths[i];
+            layout->mic = &body[EAPOL_KEY_MIC_OFFSET];
+            layout->key_data_length = key_data_length;
+            layout->key_data = &body[key_data_length_offset + 2];
+            return true;
+        }
     }
+    BINARY_LOGD(TAG, "Cannot resolve MIC length of AKM-defined EAPoL-Key packet");
+    return false;
+}
 
-    return parse_pmkid_from_key_data(eapol_key->key_data, ntohs(eapol_key->key_data_length));
+unsigned parse_pmkid(const eapol_key_layout_t *layout, uint8_t pmkids[][PMKID_LEN], unsigned max_count){
+    if(layout->packet->key_information.encrypted_key_data == 1){
+        return 0;
+    }
+    return parse_pmkid_from_key_data(layout->key_data, layout->key_data_length, pmkids, max_count);
 }
\ No newline at end of file
@@ -9,8 +9,11 @@
 #ifndef FRAME_ANALYZER_H
 #define FRAME_ANALYZER_H
 
+#include <stdint.h>
 #include "esp_event.h"
 
+#include "frame_analyzer_types.h"
+
 ESP_EVENT_DECLARE_BASE(FRAME_ANALYZER_EVENTS);
 
 enum {
@@ -19,22 +22,80 @@ enum {
 };
 
 /**
- * @brief Search types for frame analyzer.
+ * @brief Maximum number of target BSSIDs in single analysis session
+ */
+#define FRAME_ANALYZER_MAX_TARGETS 16
+
+/**
+ * @brief Maximum number of PMKIDs extracted from single EAPoL-Key frame
+ */
+#define FRAME_ANALYZER_MAX_PMKIDS 4
+
+/**
+ * @brief Compact PMKID record
+ * 
+ * Self-contained record that can be appended directly to attack results.
+ */
+typedef struct __attribute__((__packed__)) {
+    uint8_t mac_ap[6];
+    uint8_t mac_sta[6];
+    uint8_t pmkid[PMKID_LEN];
+} pmkid_record_t;
+
+/**
+ * @brief Event data of DATA_FRAME_EVENT_PMKID event.
+ * 
+ * Contains all PMKIDs found in single EAPoL-Key frame.
+ */
+typedef struct {
+    uint8_t count;
+    pmkid_record_t records[FRAME_ANALYZER_MAX_PMKIDS];
+} pmkid_records_t;
+
+/**
+ * @brief Objectives of frame analysis.
  * 
- * This hints frame analyzer what kind of information is requested.
+ * Objectives can be combined as a bitmask. Every frame is parsed only once and the result is handed
+ * to all consumers requested by the objectives.
  */
 typedef enum {
-    SEARCH_HANDSHAKE,
-    SEARCH_PMKID
-} search_type_t;
+    FRAME_ANALYZER_OBJECTIVE_HANDSHAKE = (1 << 0),  ///< posts EAPoL-Key frames as DATA_FRAME_EVENT_EAPOLKEY_FRAME
+    FRAME_ANALYZER_OBJECTIVE_PMKID = (1 << 1),      ///< extracts PMKIDs and posts them as DATA_FRAME_EVENT_PMKID
+    FRAME_ANALYZER_OBJECTIVE_STATS = (1 << 2)       ///< updates frame_analyzer_stats_t counters and station inventory
+} frame_analyzer_objective_t;
+
+/**
+ * @brief Statistics of current analysis session
+ * 
+ * Updated only if FRAME_ANALYZER_OBJECTIVE_STATS is requested.
+ */
+typedef struct {
+    uint32_t data_frames;       ///< data frames from target BSSIDs
+    uint32_t data_bytes;        ///< bytes of data frames from target BSSIDs
+    uint32_t eapol_key_frames;  ///< EAPoL-Key frames from target BSSIDs
+    uint32_t pmkids;            ///< PMKIDs found in EAPoL-Key frames
+    uint32_t first_data_time;   ///< ms since boot of the first data frame from target BSSIDs, 0 if none
+    uint32_t first_eapol_time;  ///< ms since boot of the first EAPoL-Key frame from target BSSIDs, 0 if none
+} frame_analyzer_stats_t;
+
+/**
+ * @brief Starts frame analysis based on given objectives and target BSSIDs.
+ * 
+ * Frames from any of the target BSSIDs are analysed. Useful for ESS with multiple APs (BSSIDs).
+ * Target BSSIDs cannot be changed while analysis is running.
+ * 
+ * @param objectives bitmask of frame_analyzer_objective_t
+ * @param bssids target APs' BSSIDs
+ * @param bssids_count number of BSSIDs, at most FRAME_ANALYZER_MAX_TARGETS
+ */
+void frame_analyzer_capture_start(uint32_t objectives, const uint8_t *const *bssids, unsigned bssids_count);
 
 /**
- * @brief Starts frame analysis based on given search type and BSSID.
+ * @brief Returns statistics of current (or last) analysis session.
  * 
- * @param search_type type of information that are demanded
- * @param bssid target AP's BSSID
+ * @return const frame_analyzer_stats_t* 
  */
-void frame_analyzer_capture_start(search_type_t search_type, const uint8_t *bssid);
+const frame_analyzer_stats_t *frame_analyzer_get_stats();
 
 /**
  * @brief stops frame analysis
@@ -33,25 +33,57 @@ bool is_frame_bssid_matching(wifi_promiscuous_pkt_t *frame, uint8_t *bssid);
  */
 eapol_packet_t *parse_eapol_packet(data_frame_t *frame);
 
+/**
+ * @brief Returns number of captured bytes available from the beginning of EAPoL packet
+ * 
+ * Use this instead of subtracting EAPoL offset from frame length, so frames too short to hold EAPoL header
+ * can't wrap the length around.
+ * 
+ * @param frame beginning of captured frame
+ * @param frame_length number of captured bytes of frame
+ * @param eapol_packet result of parse_eapol_packet() on the same frame, may be \c NULL
+ * @return unsigned number of bytes from eapol_packet to the end of frame
+ * @return 0 if eapol_packet is \c NULL or EAPoL header doesn't fit into captured frame
+ */
+unsigned eapol_captured_length(const void *frame, unsigned frame_length, const eapol_packet_t *eapol_packet);
+
 /**
  * @brief Parses EAPoL-Key packet from EAPoL packet
  * 
  * @note result does not include EAPoL header
- * @param eapol_packet 
+ * @param eapol_packet EAPoL packet, may be \c NULL (e.g. result of failed parse_eapol_packet())
  * @return eapol_key_packet_t* if parsing successful
  * @return \c NULL if no EAPoL-Key packet found
  */
 eapol_key_packet_t *parse_eapol_key_packet(eapol_packet_t *eapol_packet);
 
 /**
- * @brief Parses PMKIDs from EAPoL-Key packet
+ * @brief Resolves MIC and Key Data position of EAPoL-Key packet
+ * 
+ * Key descriptor versions 1-3 always use 16 bytes MIC, so fixed eapol_key_packet_t layout is used directly (fast path).
+ * With AKM-defined version the MIC length depends on AKM that isn't part of the packet, so known MIC lengths are tried 
+ * and the one for which Key Data Length is consistent with EAPoL body length is chosen.
+ * 
+ * @param eapol_packet EAPoL packet including header
+ * @param eapol_length number of captured bytes available from the beginning of eapol_packet
+ * @param layout output layout
+ * @return true if packet is EAPoL-Key packet with consistent layout
+ * @return false if packet is truncated or malformed
+ */
+bool parse_eapol_key_layout(const eapol_packet_t *eapol_packet, unsigned eapol_length, eapol_key_layout_t *layout);
+
+/**
+ * @brief Parses PMKIDs from EAPoL-Key packet into caller provided array
+ * 
+ * Key Data field is walked only within bounds resolved by parse_eapol_key_layout(), so malformed or truncated 
+ * frames cannot cause reads outside of captured buffer. No memory is allocated.
  * 
- * @param eapol_key 
- * @return pmkid_item_t* linked list of PMKIDs if parsing successful
- * @return \c NULL if no key data present
- * @return \c NULL if key data are encrypted
- * @return \c NULL parsing fails
+ * @param layout resolved EAPoL-Key packet layout
+ * @param pmkids output array for parsed PMKIDs
+ * @param max_count capacity of pmkids array
+ * @return unsigned number of PMKIDs written into pmkids
+ * @return 0 if no key data present, if key data are encrypted or if parsing fails
  */
-pmkid_item_t *parse_pmkid(eapol_key_packet_t *eapol_key);
+unsigned parse_pmkid(const eapol_key_layout_t *layout, uint8_t pmkids[][PMKID_LEN], unsigned max_count);
 
 #endif
\ No newline at end of file
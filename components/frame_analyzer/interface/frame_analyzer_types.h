@@ -86,15 +86,13 @@ typedef struct {
 
 /**
  * Size: 2 bytes
+ * 
+ * Key Information is big endian, so the first octet holds bits 8-15 and the second one bits 0-7.
  * @note unnamed fields are "reserved"
  * @see Ref: 802.11-2016 [12.7.2]
  */
 typedef struct {
-    uint8_t key_descriptor_version:3;
-    uint8_t key_type:1;
-    uint8_t :2;
-    uint8_t install:1;
-    uint8_t key_ack:1;
+    // bits 8-15
     uint8_t key_mic:1;
     uint8_t secure:1;
     uint8_t error:1;
@@ -102,10 +100,23 @@ typedef struct {
     uint8_t encrypted_key_data:1;
     uint8_t smk_message:1;
     uint8_t :2;
+    // bits 0-7
+    uint8_t key_descriptor_version:3;
+    uint8_t key_type:1;
+    uint8_t :2;
+    uint8_t install:1;
+    uint8_t key_ack:1;
 } key_information_t;
 
+#define KEY_TYPE_GROUP 0
+#define KEY_TYPE_PAIRWISE 1
+
 /**
- * @todo MIC lenght is dependent on 802.11-2016 [12.7.3] - key_infromation_t.descrptor_version
+ * @brief EAPoL-Key packet with 16 bytes MIC
+ * 
+ * This layout applies to key descriptor versions 1-3 (WPA, WPA2, WPA2 with AES-128-CMAC).
+ * With AKM-defined descriptor version (0) the MIC length depends on negotiated AKM, 
+ * so fields after key_rsc must be accessed via eapol_key_layout_t (see parse_eapol_key_layout()).
  * @see Ref: 802.11-2016 [12.7.2]
  */
 typedef struct __attribute__((__packed__)) {
@@ -122,6 +133,39 @@ typedef struct __attribute__((__packed__)) {
     uint8_t key_data[];
 } eapol_key_packet_t;
 
+/**
+ * @brief Offset of Key MIC field within EAPoL-Key packet
+ */
+#define EAPOL_KEY_MIC_OFFSET 77
+
+/**
+ * @brief Maximum MIC length of all AKMs (e.g. Suite B 192-bit uses 24 bytes)
+ */
+#define EAPOL_KEY_MAX_MIC_LEN 24
+
+/**
+ * @brief Key descriptor versions
+ * @see Ref: 802.11-2016 [12.7.2 b)]
+ */
+//@{
+#define KEY_DESCRIPTOR_VERSION_AKM_DEFINED 0
+#define KEY_DESCRIPTOR_VERSION_HMAC_MD5_RC4 1
+#define KEY_DESCRIPTOR_VERSION_HMAC_SHA1_AES 2
+#define KEY_DESCRIPTOR_VERSION_AES_128_CMAC 3
+//@}
+
+/**
+ * @brief Variable part of EAPoL-Key packet resolved according to key descriptor version and AKM
+ */
+typedef struct {
+    const eapol_key_packet_t *packet;   //< fixed part of packet (valid up to key_rsc/reserved)
+    uint8_t descriptor_version;
+    uint8_t mic_length;                 //< 16 for descriptor versions 1-3, AKM dependent otherwise
+    const uint8_t *mic;
+    uint16_t key_data_length;
+    const uint8_t *key_data;
+} eapol_key_layout_t;
+
 /**
  * @see Ref: 802.11-2016 [12.7.2, Table 12-6]
  */
@@ -150,11 +194,21 @@ typedef struct __attribute__((__packed__)) {
 } key_data_field_t;
 
 /**
- * @brief linked list of PMKIDs
+ * @brief Length of single PMKID
+ * @see Ref: 802.11-2016 [12.7.1.3]
+ */
+#define PMKID_LEN 16
+
+/**
+ * @brief Size of KDE header without data - type and length fields
+ * @see Ref: 802.11-2016 [12.7.2, Figure 12-34]
+ */
+#define KEY_DATA_FIELD_HEADER_LEN 2
+
+/**
+ * @brief Size of KDE header fields that are counted into KDE length - OUI and data type
+ * @see Ref: 802.11-2016 [12.7.2, Figure 12-34]
  */
-typedef struct pmkid_item {
-    uint8_t pmkid[16];
-    struct pmkid_item *next;
-} pmkid_item_t;
+#define KEY_DATA_FIELD_OUI_TYPE_LEN 4
 
 #endif
\ No newline at end of file
@@ -0,0 +1,128 @@
+/**
+ * @file frame_trace.c
+ * @brief Implements trace ring and Chrome trace JSON export
+ */
+#include "frame_trace.h"
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#ifdef CONFIG_FRAME_TRACE_ENABLE
+static const char *stage_names[FRAME_TRACE_STAGE_MAX] = {
+    "sniffer callback",
+    "queue dwell",
+    "analyzer parse",
+    "handshake update",
+    "pcap append",
+    "status append"
+};
+
+static frame_trace_event_t ring[CONFIG_FRAME_TRACE_RING_SIZE];
+static uint32_t next_index = 0;     //< total number of reserved slots, slot is next_index % ring size
+static volatile bool paused = false;
+
+uint32_t frame_trace_now(){
+    return (uint32_t) esp_timer_get_time();
+}
+
+static void record(frame_trace_stage_t stage, frame_trace_phase_t phase, uint32_t timestamp, uint32_t value){
+    if(paused){
+        return;
+    }
+    uint32_t index = __atomic_fetch_add(&next_index, 1, __ATOMIC_RELAXED);
+    frame_trace_event_t *event = &ring[index % CONFIG_FRAME_TRACE_RING_SIZE];
+    event->timestamp = timestamp;
+    event->value = value;
+    event->task = (uint32_t) (uintptr_t) xTaskGetCurrentTaskHandle();
+    event->stage = stage;
+    event->phase = phase;
+    event->core = xPortGetCoreID();
+}
+
+void frame_trace_complete(frame_trace_stage_t stage, uint32_t start){
+    record(stage, FRAME_TRACE_PHASE_COMPLETE, start, frame_trace_now() - start);
+}
+
+void frame_trace_async(frame_trace_stage_t stage, frame_trace_phase_t phase, uint32_t id){
+    record(stage, phase, frame_trace_now(), id);
+}
+#endif
+
+void frame_trace_clear(){
+#ifdef CONFIG_FRAME_TRACE_ENABLE
+    paused = true;
+    next_index = 0;
+    paused = false;
+#endif
+}
+
+#ifdef CONFIG_FRAME_TRACE_ENABLE
+static esp_err_t write_event(frame_trace_writer_t writer, void *ctx, const frame_trace_event_t *event, bool first){
+    char line[192];
+    const char *name = (event->stage < FRAME_TRACE_STAGE_MAX) ? stage_names[event->stage] : "unknown";
+    if(event->phase == FRAME_TRACE_PHASE_COMPLETE){
+        snprintf(line, sizeof(line), "%s{\"name\":\"%s\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":%u,\"dur\":%u,\"pid\":0,\"tid\":%u,\"args\":{\"core\":%u}}",
+            first ? "" : ",\n", name, event->timestamp, event->value, event->task, event->core);
+    }
+    else {
+        snprintf(line, sizeof(line), "%s{\"name\":\"%s\",\"cat\":\"frame\",\"ph\":\"%c\",\"ts\":%u,\"id\":\"0x%08x\",\"pid\":0,\"tid\":%u}",
+            first ? "" : ",\n", name, event->phase, event->timestamp, event->value, event->task);
+    }
+    return writer(ctx, line);
+}
+
+/**
+ * @brief Writes thread name metadata of tasks that still exist
+ */
+static esp_err_t write_task_names(frame_trace_writer_t writer, void *ctx, bool first){
+#ifdef CONFIG_FREERTOS_USE_TRACE_FACILITY
+    UBaseType_t task_count = uxTaskGetNumberOfTasks() + 2;
+    TaskStatus_t *tasks = (TaskStatus_t *) malloc(task_count * sizeof(TaskStatus_t));
+    if(tasks == NULL){
+        return ESP_OK;
+    }
+    task_count = uxTaskGetSystemState(tasks, task_count, NULL);
+    esp_err_t err = ESP_OK;
+    char line[128];
+    for(unsigned i = 0; (i < task_count) && (err == ESP_OK); i++){
+        snprintf(line, sizeof(line), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+            (first && (i == 0)) ? "" : ",\n", (uint32_t) (uintptr_t) tasks[i].xHandle, tasks[i].pcTaskName);
+        err = writer(ctx, line);
+    }
+    free(tasks);
+    return err;
+#else
+    return ESP_OK;
+#endif
+}
+#endif
+
+esp_err_t frame_trace_write_json(frame_trace_writer_t writer, void *ctx){
+    esp_err_t err = writer(ctx, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    if(err != ESP_OK){
+        return err;
+    }
+#ifdef CONFIG_FRAME_TRACE_ENABLE
+    paused = true;
+    // let writers that passed the pause check finish their slot
+    vTaskDelay(1);
+    uint32_t end = next_index;
+    uint32_t start = (end > CONFIG_FRAME_TRACE_RING_SIZE) ? end - CONFIG_FRAME_TRACE_RING_SIZE : 0;
+    for(uint32_t i = start; (i < end) && (err == ESP_OK); i++){
+        err = write_event(writer, ctx, &ring[i % CONFIG_FRAME_TRACE_RING_SIZE], i == start);
+    }
+    paused = false;
+    if(err == ESP_OK){
+        err = write_task_names(writer, ctx, start == end);
+    }
+#endif
+    if(err != ESP_OK){
+        return err;
+    }
+    return writer(ctx, "\n]}\n");
+}
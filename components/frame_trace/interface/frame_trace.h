@@ -0,0 +1,122 @@
+/**
+ * @file frame_trace.h
+ * @brief Provides lightweight tracing of frame processing stages exported as Chrome trace JSON
+ *
+ * Trace points record events into fixed RAM ring, the oldest events are overwritten.
+ * Synchronous stages are recorded as complete events (start + duration) at their end, so preemption
+ * between tasks can't break begin/end nesting. Time a frame spends in event queue is recorded as async
+ * begin/end pair linked by frame ID.
+ *
+ * Tracing is enabled by CONFIG_FRAME_TRACE_ENABLE. When disabled, trace point macros expand to nothing.
+ *
+ * @see https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU (Trace Event Format)
+ */
+#ifndef FRAME_TRACE_H
+#define FRAME_TRACE_H
+
+#include <stdint.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+
+/**
+ * @brief Traced stages
+ */
+typedef enum {
+    FRAME_TRACE_STAGE_SNIFFER_CALLBACK,     //< promiscuous callback in Wi-Fi task
+    FRAME_TRACE_STAGE_QUEUE_DWELL,          //< frame waiting in event queue
+    FRAME_TRACE_STAGE_ANALYZER_PARSE,       //< frame analyzer parsing and dispatching
+    FRAME_TRACE_STAGE_HANDSHAKE_UPDATE,     //< HCCAPX serializer handshake state update
+    FRAME_TRACE_STAGE_PCAP_APPEND,          //< PCAP serializer append
+    FRAME_TRACE_STAGE_STATUS_APPEND,        //< attack status content append
+    FRAME_TRACE_STAGE_MAX
+} frame_trace_stage_t;
+
+/**
+ * @brief Event phases, values are Chrome trace phase characters
+ */
+typedef enum {
+    FRAME_TRACE_PHASE_COMPLETE = 'X',
+    FRAME_TRACE_PHASE_ASYNC_BEGIN = 'b',
+    FRAME_TRACE_PHASE_ASYNC_END = 'e'
+} frame_trace_phase_t;
+
+/**
+ * @brief Recorded event
+ */
+typedef struct {
+    uint32_t timestamp;     //< us since boot (lower 32 bits)
+    uint32_t value;         //< duration in us for complete events, frame ID for async events
+    uint32_t task;          //< handle of task that recorded the event
+    uint8_t stage;          //< frame_trace_stage_t
+    uint8_t phase;          //< frame_trace_phase_t
+    uint8_t core;
+    uint8_t reserved;
+} frame_trace_event_t;
+
+/**
+ * @brief Writer of exported text
+ *
+ * @param ctx context passed to frame_trace_write_json()
+ * @param text null-terminated chunk of text
+ */
+typedef esp_err_t (*frame_trace_writer_t)(void *ctx, const char *text);
+
+#ifdef CONFIG_FRAME_TRACE_ENABLE
+/**
+ * @brief Returns current timestamp for FRAME_TRACE_BEGIN
+ */
+uint32_t frame_trace_now();
+
+/**
+ * @brief Records complete event of stage that started at \c start and ends now
+ */
+void frame_trace_complete(frame_trace_stage_t stage, uint32_t start);
+
+/**
+ * @brief Records async event
+ *
+ * @param stage
+ * @param phase FRAME_TRACE_PHASE_ASYNC_BEGIN or FRAME_TRACE_PHASE_ASYNC_END
+ * @param id identifies the same frame in begin and end event (e.g. radio timestamp)
+ */
+void frame_trace_async(frame_trace_stage_t stage, frame_trace_phase_t phase, uint32_t id);
+
+/**
+ * @brief Trace point macros
+ *
+ * @code{.c}
+ * FRAME_TRACE_BEGIN(trace_start);
+ * // ... stage ...
+ * FRAME_TRACE_END(FRAME_TRACE_STAGE_PCAP_APPEND, trace_start);
+ * @endcode
+ * @{
+ */
+#define FRAME_TRACE_BEGIN(start) uint32_t start = frame_trace_now()
+#define FRAME_TRACE_END(stage, start) frame_trace_complete((stage), (start))
+#define FRAME_TRACE_ASYNC_BEGIN(stage, id) frame_trace_async((stage), FRAME_TRACE_PHASE_ASYNC_BEGIN, (id))
+#define FRAME_TRACE_ASYNC_END(stage, id) frame_trace_async((stage), FRAME_TRACE_PHASE_ASYNC_END, (id))
+//@}
+#else
+#define FRAME_TRACE_BEGIN(start)
+#define FRAME_TRACE_END(stage, start)
+#define FRAME_TRACE_ASYNC_BEGIN(stage, id)
+#define FRAME_TRACE_ASYNC_END(stage, id)
+#endif
+
+/**
+ * @brief Discards all recorded events.
+ */
+void frame_trace_clear();
+
+/**
+ * @brief Writes recorded events, the oldest first, as Chrome trace JSON object.
+ *
+ * Recording is paused while the ring is being written. If tracing is disabled, empty trace is written.
+ *
+ * @param writer
+ * @param ctx context passed to writer
+ * @return esp_err_t ESP_OK or first error returned by writer
+ */
+esp_err_t frame_trace_write_json(frame_trace_writer_t writer, void *ctx);
+
+#endif
@@ -0,0 +1,255 @@
+/**
+ * @file gzip_stream.c
+ * @brief Implements streaming gzip compressor (LZ77 + fixed Huffman DEFLATE block)
+ */
+#include "gzip_stream.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "crc32.h"
+
+/**
+ * @brief DEFLATE constants
+ *
+ * @see Ref: RFC 1951 [3.2.5, 3.2.6]
+ */
+//@{
+#define MIN_MATCH 3
+#define MAX_MATCH 258
+#define END_OF_BLOCK 256
+#define BTYPE_FIXED_HUFFMAN 1
+
+static const uint16_t length_base[] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t length_extra_bits[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t distance_base[] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769,
+    1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t distance_extra_bits[] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+//@}
+
+/**
+ * @brief gzip header: magic, deflate method, no flags, no mtime, no extra flags, unknown OS
+ *
+ * @see Ref: RFC 1952 [2.3]
+ */
+static const uint8_t gzip_header[] = { 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff };
+
+#define WINDOW_SIZE CONFIG_GZIP_STREAM_WINDOW_SIZE
+#define NO_POSITION 0xffff
+
+static unsigned hash(const uint8_t *data){
+    uint32_t value = (data[0] << 16) | (data[1] << 8) | data[2];
+    return (value * 2654435761u) >> (32 - GZIP_STREAM_HASH_BITS);
+}
+
+static esp_err_t put_byte(gzip_stream_t *stream, uint8_t byte){
+    stream->output[stream->output_length++] = byte;
+    if(stream->output_length < GZIP_STREAM_OUTPUT_SIZE){
+        return ESP_OK;
+    }
+    stream->output_length = 0;
+    return stream->writer(stream->ctx, stream->output, GZIP_STREAM_OUTPUT_SIZE);
+}
+
+/**
+ * @brief Writes bits LSB first as required for DEFLATE data elements other than Huffman codes
+ */
+static esp_err_t put_bits(gzip_stream_t *stream, uint32_t value, unsigned count){
+    stream->bits |= value << stream->bit_count;
+    stream->bit_count += count;
+    while(stream->bit_count >= 8){
+        esp_err_t err = put_byte(stream, stream->bits & 0xff);
+        stream->bits >>= 8;
+        stream->bit_count -= 8;
+        if(err != ESP_OK){
+            return err;
+        }
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Writes Huffman code MSB first
+ */
+static esp_err_t put_code(gzip_stream_t *stream, uint32_t code, unsigned length){
+    uint32_t reversed = 0;
+    for(unsigned i = 0; i < length; i++){
+        reversed = (reversed << 1) | ((code >> i) & 1);
+    }
+    return put_bits(stream, reversed, length);
+}
+
+/**
+ * @brief Writes literal/length symbol using fixed Huffman code
+ *
+ * @see Ref: RFC 1951 [3.2.6]
+ */
+static esp_err_t put_symbol(gzip_stream_t *stream, unsigned symbol){
+    if(symbol < 144){
+        return put_code(stream, 0x30 + symbol, 8);
+    }
+    if(symbol < 256){
+        return put_code(stream, 0x190 + symbol - 144, 9);
+    }
+    if(symbol < 280){
+        return put_code(stream, symbol - 256, 7);
+    }
+    return put_code(stream, 0xc0 + symbol - 280, 8);
+}
+
+static esp_err_t put_match(gzip_stream_t *stream, unsigned length, unsigned distance){
+    unsigned length_code = sizeof(length_base) / sizeof(length_base[0]) - 1;
+    while(length_base[length_code] > length){
+        length_code--;
+    }
+    unsigned distance_code = sizeof(distance_base) / sizeof(distance_base[0]) - 1;
+    while(distance_base[distance_code] > distance){
+        distance_code--;
+    }
+    esp_err_t err;
+    if(((err = put_symbol(stream, 257 + length_code)) != ESP_OK)
+        || ((err = put_bits(stream, length - length_base[length_code], length_extra_bits[length_code])) != ESP_OK)
+        || ((err = put_code(stream, distance_code, 5)) != ESP_OK)){
+        return err;
+    }
+    return put_bits(stream, distance - distance_base[distance_code], distance_extra_bits[distance_code]);
+}
+
+/**
+ * @brief Encodes buffered data
+ *
+ * @param stream
+ * @param flush encode all data, otherwise MAX_MATCH bytes of lookahead are kept for next call
+ */
+static esp_err_t compress(gzip_stream_t *stream, bool flush){
+    unsigned limit = flush ? stream->fill : ((stream->fill > MAX_MATCH) ? stream->fill - MAX_MATCH : 0);
+    while(stream->position < limit){
+        unsigned position = stream->position;
+        unsigned available = stream->fill - position;
+        unsigned length = 0;
+        unsigned distance = 0;
+        if(available >= MIN_MATCH){
+            uint16_t *head = &stream->head[hash(&stream->window[position])];
+            unsigned candidate = *head;
+            *head = position;
+            if(candidate != NO_POSITION){
+                unsigned max_length = (available < MAX_MATCH) ? available : MAX_MATCH;
+                while((length < max_length) && (stream->window[candidate + length] == stream->window[position + length])){
+                    length++;
+                }
+                distance = position - candidate;
+            }
+        }
+
+        esp_err_t err;
+        if(length >= MIN_MATCH){
+            err = put_match(stream, length, distance);
+            // keep hash table up to date for positions inside the match
+            for(unsigned i = position + 1; (i < position + length) && (i + MIN_MATCH <= stream->fill); i++){
+                stream->head[hash(&stream->window[i])] = i;
+            }
+            stream->position += length;
+        }
+        else {
+            err = put_symbol(stream, stream->window[position]);
+            stream->position++;
+        }
+        if(err != ESP_OK){
+            return err;
+        }
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Drops the oldest half of window to make room for new data
+ */
+static void slide(gzip_stream_t *stream){
+    memmove(stream->window, &stream->window[WINDOW_SIZE], stream->fill - WINDOW_SIZE);
+    stream->fill -= WINDOW_SIZE;
+    stream->position -= WINDOW_SIZE;
+    for(unsigned i = 0; i < (1 << GZIP_STREAM_HASH_BITS); i++){
+        stream->head[i] = ((stream->head[i] != NO_POSITION) && (stream->head[i] >= WINDOW_SIZE)) ? stream->head[i] - WINDOW_SIZE : NO_POSITION;
+    }
+}
+
+void gzip_stream_init(gzip_stream_t *stream, gzip_stream_writer_t writer, void *ctx){
+    stream->writer = writer;
+    stream->ctx = ctx;
+    memset(stream->head, 0xff, sizeof(stream->head));
+    stream->position = 0;
+    stream->fill = 0;
+    stream->crc = 0;
+    stream->size = 0;
+    stream->bits = 0;
+    stream->bit_count = 0;
+    memcpy(stream->output, gzip_header, sizeof(gzip_header));
+    stream->output_length = sizeof(gzip_header);
+    // whole stream is one block with fixed Huffman codes, BFINAL is set on empty block written by gzip_stream_finish()
+    put_bits(stream, 0, 1);
+    put_bits(stream, BTYPE_FIXED_HUFFMAN, 2);
+}
+
+esp_err_t gzip_stream_write(gzip_stream_t *stream, const uint8_t *data, unsigned length){
+    stream->crc = crc32_update(stream->crc, data, length);
+    stream->size += length;
+    while(length > 0){
+        if(stream->fill == sizeof(stream->window)){
+            // lookahead is less than MAX_MATCH, so all bytes before the upper half were encoded already
+            slide(stream);
+        }
+        unsigned chunk = sizeof(stream->window) - stream->fill;
+        if(chunk > length){
+            chunk = length;
+        }
+        memcpy(&stream->window[stream->fill], data, chunk);
+        stream->fill += chunk;
+        data += chunk;
+        length -= chunk;
+        esp_err_t err = compress(stream, false);
+        if(err != ESP_OK){
+            return err;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t gzip_stream_finish(gzip_stream_t *stream){
+    esp_err_t err;
+    if(((err = compress(stream, true)) != ESP_OK)
+        || ((err = put_symbol(stream, END_OF_BLOCK)) != ESP_OK)
+        // empty final block
+        || ((err = put_bits(stream, 1, 1)) != ESP_OK)
+        || ((err = put_bits(stream, BTYPE_FIXED_HUFFMAN, 2)) != ESP_OK)
+        || ((err = put_symbol(stream, END_OF_BLOCK)) != ESP_OK)){
+        return err;
+    }
+    if((stream->bit_count > 0) && ((err = put_bits(stream, 0, 8 - stream->bit_count)) != ESP_OK)){
+        return err;
+    }
+    // trailer: CRC32 and size of uncompressed data in little endian
+    for(unsigned i = 0; i < 4; i++){
+        if((err = put_byte(stream, stream->crc >> (8 * i))) != ESP_OK){
+            return err;
+        }
+    }
+    for(unsigned i = 0; i < 4; i++){
+        if((err = put_byte(stream, stream->size >> (8 * i))) != ESP_OK){
+            return err;
+        }
+    }
+    if(stream->output_length == 0){
+        return ESP_OK;
+    }
+    unsigned output_length = stream->output_length;
+    stream->output_length = 0;
+    return stream->writer(stream->ctx, stream->output, output_length);
+}
@@ -0,0 +1,83 @@
+/**
+ * @file gzip_stream.h
+ * @brief Provides streaming gzip compressor with constant memory usage
+ *
+ * Data are compressed by greedy LZ77 with single-entry hash table and small window and encoded
+ * into one DEFLATE block with fixed Huffman codes wrapped in gzip container (RFC 1951, RFC 1952).
+ * Compressor never allocates memory, all state is in gzip_stream_t.
+ */
+#ifndef GZIP_STREAM_H
+#define GZIP_STREAM_H
+
+#include <stdint.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+
+/**
+ * @brief Number of bits of LZ77 hash table index
+ */
+#define GZIP_STREAM_HASH_BITS 10
+
+/**
+ * @brief Size of output buffer. Compressed data are passed to writer in blocks of this size.
+ */
+#define GZIP_STREAM_OUTPUT_SIZE 512
+
+/**
+ * @brief Callback that consumes compressed data
+ *
+ * @param ctx context passed to gzip_stream_init()
+ * @param data
+ * @param length
+ * @return esp_err_t error is returned from gzip_stream_write() or gzip_stream_finish()
+ */
+typedef esp_err_t (*gzip_stream_writer_t)(void *ctx, const uint8_t *data, unsigned length);
+
+/**
+ * @brief Compressor state. Treat as opaque.
+ */
+typedef struct {
+    gzip_stream_writer_t writer;
+    void *ctx;
+    uint8_t window[2 * CONFIG_GZIP_STREAM_WINDOW_SIZE];    //< history followed by lookahead
+    uint16_t head[1 << GZIP_STREAM_HASH_BITS];              //< last position of every hash in window
+    unsigned position;                                      //< next byte to encode
+    unsigned fill;                                          //< bytes in window
+    uint32_t crc;
+    uint32_t size;
+    uint32_t bits;
+    unsigned bit_count;
+    uint8_t output[GZIP_STREAM_OUTPUT_SIZE];
+    unsigned output_length;
+} gzip_stream_t;
+
+/**
+ * @brief Starts new gzip stream and writes gzip header.
+ *
+ * @param stream
+ * @param writer consumer of compressed data
+ * @param ctx context passed to writer
+ */
+void gzip_stream_init(gzip_stream_t *stream, gzip_stream_writer_t writer, void *ctx);
+
+/**
+ * @brief Compresses next block of data.
+ *
+ * Data are buffered, so writer may not be called on every call.
+ *
+ * @param stream
+ * @param data
+ * @param length
+ * @return esp_err_t ESP_OK or error returned by writer
+ */
+esp_err_t gzip_stream_write(gzip_stream_t *stream, const uint8_t *data, unsigned length);
+
+/**
+ * @brief Compresses remaining data, writes gzip trailer and flushes everything to writer.
+ *
+ * @param stream
+ * @return esp_err_t ESP_OK or error returned by writer
+ */
+esp_err_t gzip_stream_finish(gzip_stream_t *stream);
+
+#endif
@@ -9,13 +9,19 @@
 #include "hccapx_serializer.h"
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
-#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#include "arpa/inet.h"
+#define LOG_LOCAL_LEVEL CONFIG_HCCAPX_SERIALIZER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "frame_analyzer.h"
 #include "frame_analyzer_types.h"
 #include "frame_analyzer_parser.h"
+#include "mac_address.h"
+#include "metrics.h"
 
 /**
  * @brief Constants based on reference
@@ -27,33 +33,139 @@
 #define HCCAPX_VERSION 4
 #define HCCAPX_KEYVER_WPA 1
 #define HCCAPX_KEYVER_WPA2 2
+#define HCCAPX_KEYVER_WPA2_CMAC 3
 #define HCCAPX_MAX_EAPOL_SIZE 256
 //@}
 
+/**
+ * @brief Weights of pair score components. Components are ordered by importance, 
+ * lower bits hold inverted time delta between messages in ms.
+ */
+//@{
+#define SCORE_REPLAY_COUNTER_MATCH (1 << 18)
+#define SCORE_NONCE_CONSISTENT (1 << 17)
+#define SCORE_AUTHORIZED (1 << 16)
+#define SCORE_MAX_DELTA_MS 0xffff
+//@}
+
 static char *TAG = "hccapx_serializer";
 
 /**
- * @brief Default values for hccapx buffer
+ * @brief One captured handshake message kept as candidate for pairing
  */
-static hccapx_t hccapx = { 
-    .signature = HCCAPX_SIGNATURE, 
-    .version = 4, 
-    .message_pair = 255,
-    .keyver = HCCAPX_KEYVER_WPA2
+typedef struct {
+    uint8_t message;            //< number of handshake message (1-4)
+    uint8_t keyver;             //< HCCAPX keyver derived from key descriptor version
+    uint64_t replay_counter;
+    uint32_t timestamp;         //< capture timestamp in microseconds
+    uint8_t nonce[32];
+    uint8_t mic[16];
+    uint16_t eapol_len;         //< only messages from STA keep EAPoL, since only they are used as EAPoL source
+    uint8_t eapol[HCCAPX_MAX_EAPOL_SIZE];
+} handshake_message_t;
+
+/**
+ * @brief Handshake session between one AP and one STA with all candidate messages
+ */
+typedef struct {
+    uint8_t mac_ap[6];
+    uint8_t mac_sta[6];
+    hccapx_handshake_state_t state;         //< progress of current handshake exchange
+    hccapx_handshake_state_t best_state;    //< furthest progress of any exchange in this session
+    uint64_t replay_counter;                //< replay counter of message that caused last transition
+    unsigned count;
+    handshake_message_t messages[CONFIG_HCCAPX_MAX_CANDIDATES];
+} handshake_session_t;
+
+/**
+ * @brief Replay counter condition of state transition
+ */
+typedef enum {
+    RC_NO_TRANSITION,   //< message doesn't move the state machine
+    RC_ANY,             //< transition with any replay counter (new exchange)
+    RC_SAME,            //< reply with the same replay counter as last message
+    RC_NEXT             //< next request with replay counter incremented by one
+} replay_counter_check_t;
+
+typedef struct {
+    uint8_t next_state;
+    uint8_t replay_counter_check;
+} handshake_transition_t;
+
+/**
+ * @brief Transition table of handshake state machine indexed by [state][message - 1].
+ * 
+ * M1 always starts new exchange. Other messages move the state only if they continue 
+ * current exchange, i.e. their replay counter matches. Messages that don't move the state
+ * are still kept as candidates for pairing.
+ */
+static const handshake_transition_t transitions[HCCAPX_HANDSHAKE_STATE_MAX][4] = {
+    //                                    M1                            M2                                  M3                                   M4
+    [HCCAPX_HANDSHAKE_NONE] =       { { HCCAPX_HANDSHAKE_M1, RC_ANY }, { 0, RC_NO_TRANSITION },             { 0, RC_NO_TRANSITION },              { 0, RC_NO_TRANSITION } },
+    [HCCAPX_HANDSHAKE_M1] =         { { HCCAPX_HANDSHAKE_M1, RC_ANY }, { HCCAPX_HANDSHAKE_CHALLENGE, RC_SAME }, { 0, RC_NO_TRANSITION },           { 0, RC_NO_TRANSITION } },
+    [HCCAPX_HANDSHAKE_CHALLENGE] =  { { HCCAPX_HANDSHAKE_M1, RC_ANY }, { 0, RC_NO_TRANSITION },             { HCCAPX_HANDSHAKE_AUTHORIZED, RC_NEXT }, { 0, RC_NO_TRANSITION } },
+    [HCCAPX_HANDSHAKE_AUTHORIZED] = { { HCCAPX_HANDSHAKE_M1, RC_ANY }, { 0, RC_NO_TRANSITION },             { 0, RC_NO_TRANSITION },              { HCCAPX_HANDSHAKE_COMPLETE, RC_SAME } },
+    [HCCAPX_HANDSHAKE_COMPLETE] =   { { HCCAPX_HANDSHAKE_M1, RC_ANY }, { 0, RC_NO_TRANSITION },             { 0, RC_NO_TRANSITION },              { 0, RC_NO_TRANSITION } },
 };
 
 /**
- * @brief Stores last processed message
+ * @brief Candidate pair of messages that can be exported as HCCAPX
  */
-//@{
-static unsigned message_ap = 0;
-static unsigned message_sta = 0;
+typedef struct {
+    uint8_t ap;             //< index of AP message (M1 or M3)
+    uint8_t sta;            //< index of STA message (M2 or M4), EAPoL source
+    uint8_t snonce;         //< index of message with SNonce
+    uint8_t message_pair;
+    uint32_t score;
+} handshake_pair_t;
+
+/**
+ * @brief Session, its ranking and ESSID are guarded by session lock.
+ *
+ * Frames are added from event loop while pairs are read by webserver and orchestrator.
+ * @{
+ */
+static handshake_session_t session;
+static handshake_pair_t ranked_pairs[CONFIG_HCCAPX_MAX_PAIRS];
+static unsigned ranked_pairs_count = 0;
+static bool ranking_dirty = false;
+static SemaphoreHandle_t lock = NULL;
+static portMUX_TYPE lock_create_lock = portMUX_INITIALIZER_UNLOCKED;
 //@}
 
 /**
- * @brief Stores number of message from which was the EAPoL packet saved.  
+ * @brief Metrics of handshake message processing
+ * @{
  */
-static unsigned eapol_source = 0;
+METRICS_COUNTER_DEFINE(metric_messages, "hccapx_serializer_messages_total", NULL, "4-way handshake messages accepted as pair candidates");
+METRICS_COUNTER_DEFINE(metric_rejected, "hccapx_serializer_rejected_frames_total", NULL, "EAPoL-Key frames rejected as malformed, unsupported or not matching session");
+//@}
+
+static uint8_t essid[32];
+static uint8_t essid_len = 0;
+
+/**
+ * @brief Takes session lock, creating it on first use by any task
+ */
+static void session_lock(){
+    if(lock == NULL){
+        SemaphoreHandle_t created = xSemaphoreCreateMutex();
+        portENTER_CRITICAL(&lock_create_lock);
+        if(lock == NULL){
+            lock = created;
+            created = NULL;
+        }
+        portEXIT_CRITICAL(&lock_create_lock);
+        if(created != NULL){
+            vSemaphoreDelete(created);
+        }
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+}
+
+static void session_unlock(){
+    xSemaphoreGive(lock);
+}
 
 /**
  * @brief Says whether array contains only zero values or not
@@ -63,7 +175,7 @@ static unsigned eapol_source = 0;
  * @return true all values are zero
  * @return false some value is different from zero
  */
-static bool is_array_zero(uint8_t *array, unsigned size){
+static bool is_array_zero(const uint8_t *array, unsigned size){
     for(unsigned i = 0; i < size; i++){
         if(array[i] != 0){
             return false;
@@ -72,201 +184,414 @@ static bool is_array_zero(uint8_t *array, unsigned size){
     return true;
 }
 
-void hccapx_serializer_init(const uint8_t *ssid, unsigned size){
-    hccapx.essid_len = size;
-    memcpy(hccapx.essid, ssid, size);
-    hccapx.message_pair = 255;
+/**
+ * @brief Maps key descriptor version to HCCAPX keyver
+ * 
+ * @param descriptor_version 
+ * @return uint8_t HCCAPX keyver or 0 if handshake cannot be cracked from HCCAPX (AKM-defined descriptor, e.g. SAE)
+ */
+static uint8_t hccapx_keyver(uint8_t descriptor_version){
+    switch(descriptor_version){
+        case KEY_DESCRIPTOR_VERSION_HMAC_MD5_RC4:
+            return HCCAPX_KEYVER_WPA;
+        case KEY_DESCRIPTOR_VERSION_HMAC_SHA1_AES:
+            return HCCAPX_KEYVER_WPA2;
+        case KEY_DESCRIPTOR_VERSION_AES_128_CMAC:
+            return HCCAPX_KEYVER_WPA2_CMAC;
+        default:
+            return 0;
+    }
+}
+
+static uint64_t replay_counter_value(const eapol_key_packet_t *eapol_key_packet){
+    uint64_t value = 0;
+    for(unsigned i = 0; i < 8; i++){
+        value = (value << 8) | eapol_key_packet->key_replay_counter[i];
+    }
+    return value;
 }
 
-hccapx_t *hccapx_serializer_get(){
-    if(hccapx.message_pair == 255){
-        return NULL;
+void hccapx_serializer_init(const uint8_t *ssid, unsigned size){
+    if(size > sizeof(essid)){
+        size = sizeof(essid);
     }
-    
-    return &hccapx;
+    session_lock();
+    essid_len = size;
+    memcpy(essid, ssid, size);
+    memset(session.mac_ap, 0, 6);
+    memset(session.mac_sta, 0, 6);
+    session.state = HCCAPX_HANDSHAKE_NONE;
+    session.best_state = HCCAPX_HANDSHAKE_NONE;
+    session.replay_counter = 0;
+    session.count = 0;
+    ranked_pairs_count = 0;
+    ranking_dirty = false;
+    session_unlock();
+    metrics_register(&metric_messages);
+    metrics_register(&metric_rejected);
 }
 
 /**
- * @brief Saves EAPoL-Key frame into HCCAPX buffer
+ * @brief Checks whether ANonce of given AP message is not contradicted by other AP message of the same handshake.
  * 
- * Also sets Key MIC value to the one present in the given EAPoL-Key packet
+ * M1 and M3 of one handshake carry the same ANonce and M3 has replay counter incremented by one.
  * 
- * @param eapol_packet EAPoL packet to be saved that includes also EAPoL header
- * @param eapol_key_packet EAPoL-Key parsed to get key MIC from it
- * @return unsigned
- * @return 1 if error occured
- * @return 0 if successfully saved
+ * @param ap_message 
+ * @return true if no other message of the same handshake carries different ANonce
  */
-static unsigned save_eapol(eapol_packet_t *eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    unsigned eapol_len = 0;
-    eapol_len = sizeof(eapol_packet_header_t) + ntohs(eapol_packet->header.packet_body_length);
-    if(eapol_len > HCCAPX_MAX_EAPOL_SIZE){
-        ESP_LOGW(TAG, "EAPoL is too long (%u/%u)", eapol_len, HCCAPX_MAX_EAPOL_SIZE);
-        return 1;
-    }
-    hccapx.eapol_len = eapol_len;
-    memcpy(hccapx.eapol, eapol_packet, hccapx.eapol_len);
-    memcpy(hccapx.keymic, eapol_key_packet->key_mic, 16);
-    // Clear key MIC from EAPoL packet so hashcat can calulate MIC without preprocessing.
-    // This is not documented in HCCAPX reference.
-    // But it's based on 802.11i-2004 [8.5.2/h] and by analysing behaviour of cap2hccapx tool
-    // MIC key on 77 bytes offset inside EAPoL-Key + 4 bytes EAPoL header.
-    memset(&hccapx.eapol[81], 0x0, 16);
-    return 0;
+static bool is_anonce_consistent(const handshake_message_t *ap_message){
+    for(unsigned i = 0; i < session.count; i++){
+        const handshake_message_t *other = &session.messages[i];
+        bool same_handshake = ((other->message == 1) && (ap_message->message == 3) && (other->replay_counter + 1 == ap_message->replay_counter))
+            || ((other->message == 3) && (ap_message->message == 1) && (other->replay_counter == ap_message->replay_counter + 1));
+        if(same_handshake && (memcmp(other->nonce, ap_message->nonce, 32) != 0)){
+            return false;
+        }
+    }
+    return true;
 }
 
 /**
- * @brief Handles first message of WPA handshake - from AP to STA
+ * @brief Finds message carrying SNonce for given STA message.
  * 
- * This message is from AP. It always contains ANonce.
+ * M2 carries SNonce. M4 usually has empty nonce, so SNonce is taken from M2 of the same handshake.
  * 
- * @param eapol_key_packet parsed EAPoL-Key packet
+ * @param sta index of STA message
+ * @return int index of message with SNonce or -1 if there is none
  */
-static void ap_message_m1(eapol_key_packet_t *eapol_key_packet){
-    ESP_LOGD(TAG, "From AP M1");
-    message_ap = 1;
-    memcpy(hccapx.nonce_ap, eapol_key_packet->key_nonce, 32);
+static int find_snonce(unsigned sta){
+    const handshake_message_t *sta_message = &session.messages[sta];
+    if(!is_array_zero(sta_message->nonce, 32)){
+        return sta;
+    }
+    for(unsigned i = 0; i < session.count; i++){
+        const handshake_message_t *m2 = &session.messages[i];
+        if((m2->message == 2) && (m2->replay_counter + 1 == sta_message->replay_counter)){
+            return i;
+        }
+    }
+    return -1;
 }
 
 /**
- * @brief Handles third message of WPA handshake - from AP to STA
+ * @brief Scores pair of AP and STA message
  * 
- * @param eapol_packet 
- * @param eapol_key_packet 
+ * Score is composed from (ordered by importance):
+ * - replay counter match - STA message replies to this AP message
+ * - nonce consistency - ANonce is not contradicted by other AP message of the same handshake
+ * - authorization - pair contains M3 or M4, so AP accepted MIC and PSK is guaranteed to be correct
+ * - time delta between messages - shorter is better
+ * 
+ * @param ap index of AP message
+ * @param sta index of STA message
+ * @param pair output pair
+ * @return true if messages can form a pair
  */
-static void ap_message_m3(eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    ESP_LOGD(TAG, "From AP M3");
-    message_ap = 3;
-    if(message_ap == 0){
-        // No AP message was processed yet. ANonce has to be copied into HCCAPX buffer.
-        memcpy(hccapx.nonce_ap, eapol_key_packet->key_nonce, 32);
-    }
-    if(eapol_source == 2){
-        // EAPoL packet was already saved from message #2. No need to resave it.
-        hccapx.message_pair = 2;
-        return;
+static bool score_pair(unsigned ap, unsigned sta, handshake_pair_t *pair){
+    const handshake_message_t *ap_message = &session.messages[ap];
+    const handshake_message_t *sta_message = &session.messages[sta];
+    if(ap_message->keyver != sta_message->keyver){
+        return false;
     }
-    if(save_eapol(eapol_packet, eapol_key_packet) != 0){
-        return;
+    int snonce = find_snonce(sta);
+    if(snonce < 0){
+        return false;
     }
-    eapol_source = 3;
-    if(message_sta == 2){
-        hccapx.message_pair = 3;
+    pair->ap = ap;
+    pair->sta = sta;
+    pair->snonce = snonce;
+    pair->score = 0;
+
+    // STA replies to M1 with the same replay counter, M3 carries counter incremented by one
+    uint64_t expected_replay_counter = ap_message->replay_counter;
+    if(ap_message->message == 1){
+        pair->message_pair = (sta_message->message == 2) ? HCCAPX_MESSAGE_PAIR_M12E2 : HCCAPX_MESSAGE_PAIR_M14E4;
+        if(sta_message->message == 4){
+            expected_replay_counter++;
+        }
+    } 
+    else {
+        pair->message_pair = (sta_message->message == 2) ? HCCAPX_MESSAGE_PAIR_M32E2 : HCCAPX_MESSAGE_PAIR_M34E4;
+        if(sta_message->message == 2){
+            expected_replay_counter--;
+        }
+    }
+    if(sta_message->replay_counter == expected_replay_counter){
+        pair->score += SCORE_REPLAY_COUNTER_MATCH;
+    }
+    else {
+        pair->message_pair |= HCCAPX_MESSAGE_PAIR_RC_NOT_MATCHING;
     }
+    if(is_anonce_consistent(ap_message)){
+        pair->score += SCORE_NONCE_CONSISTENT;
+    }
+    if(pair->message_pair != HCCAPX_MESSAGE_PAIR_M12E2){
+        pair->score += SCORE_AUTHORIZED;
+    }
+    uint32_t delta_ms = abs((int32_t) (sta_message->timestamp - ap_message->timestamp)) / 1000;
+    if(delta_ms > SCORE_MAX_DELTA_MS){
+        delta_ms = SCORE_MAX_DELTA_MS;
+    }
+    pair->score += SCORE_MAX_DELTA_MS - delta_ms;
+    return true;
 }
 
 /**
- * @brief Handles messages from AP - handshake M1 and M3.
- * 
- * @param frame 
- * @param eapol_packet 
- * @param eapol_key_packet 
+ * @brief Scores all possible pairs and keeps the best CONFIG_HCCAPX_MAX_PAIRS sorted by score.
  */
-static void ap_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    if((!is_array_zero(hccapx.mac_sta, 6)) && (memcmp(frame->mac_header.addr1, hccapx.mac_sta, 6) != 0)){
-        ESP_LOGE(TAG, "Different STA");
-        return;
+static void rank_pairs(){
+    ranked_pairs_count = 0;
+    for(unsigned ap = 0; ap < session.count; ap++){
+        if((session.messages[ap].message != 1) && (session.messages[ap].message != 3)){
+            continue;
+        }
+        for(unsigned sta = 0; sta < session.count; sta++){
+            if((session.messages[sta].message != 2) && (session.messages[sta].message != 4)){
+                continue;
+            }
+            handshake_pair_t pair;
+            if(!score_pair(ap, sta, &pair)){
+                continue;
+            }
+            // insertion into sorted array
+            unsigned position = ranked_pairs_count;
+            while((position > 0) && (ranked_pairs[position - 1].score < pair.score)){
+                if(position < CONFIG_HCCAPX_MAX_PAIRS){
+                    ranked_pairs[position] = ranked_pairs[position - 1];
+                }
+                position--;
+            }
+            if(position < CONFIG_HCCAPX_MAX_PAIRS){
+                ranked_pairs[position] = pair;
+                if(ranked_pairs_count < CONFIG_HCCAPX_MAX_PAIRS){
+                    ranked_pairs_count++;
+                }
+            }
+        }
     }
-    if(message_ap == 0){
-        memcpy(hccapx.mac_ap, frame->mac_header.addr2, 6);
+    ranking_dirty = false;
+}
+
+/**
+ * @brief Ranks pairs if messages changed since last ranking. Session lock has to be held.
+ */
+static void rank_pairs_if_dirty(){
+    if(ranking_dirty){
+        rank_pairs();
     }
-    // Determine which message this is by Key MIC
-    // Key MIC is always empty in M1 and always present in M3
-    // Ref: 802.11i-2004 [8.5.3]
-    if(is_array_zero(eapol_key_packet->key_mic, 16)){
-        ap_message_m1(eapol_key_packet);
-    } 
-    else {
-        ap_message_m3(eapol_packet, eapol_key_packet);
+}
+
+/**
+ * @brief Fills HCCAPX record of ranked pair. Session lock has to be held.
+ */
+static void fill_hccapx(const handshake_pair_t *pair, hccapx_t *hccapx){
+    const handshake_message_t *ap_message = &session.messages[pair->ap];
+    const handshake_message_t *sta_message = &session.messages[pair->sta];
+
+    hccapx->signature = HCCAPX_SIGNATURE;
+    hccapx->version = HCCAPX_VERSION;
+    hccapx->message_pair = pair->message_pair;
+    hccapx->keyver = sta_message->keyver;
+    hccapx->essid_len = essid_len;
+    memcpy(hccapx->essid, essid, sizeof(essid));
+    memcpy(hccapx->keymic, sta_message->mic, 16);
+    memcpy(hccapx->mac_ap, session.mac_ap, 6);
+    memcpy(hccapx->nonce_ap, ap_message->nonce, 32);
+    memcpy(hccapx->mac_sta, session.mac_sta, 6);
+    memcpy(hccapx->nonce_sta, session.messages[pair->snonce].nonce, 32);
+    hccapx->eapol_len = sta_message->eapol_len;
+    memcpy(hccapx->eapol, sta_message->eapol, sta_message->eapol_len);
+    memset(&hccapx->eapol[sta_message->eapol_len], 0, HCCAPX_MAX_EAPOL_SIZE - sta_message->eapol_len);
+}
+
+unsigned hccapx_serializer_get_pair_count(){
+    session_lock();
+    rank_pairs_if_dirty();
+    unsigned count = ranked_pairs_count;
+    session_unlock();
+    return count;
+}
+
+bool hccapx_serializer_get_pair(unsigned rank, hccapx_t *hccapx){
+    session_lock();
+    rank_pairs_if_dirty();
+    bool found = rank < ranked_pairs_count;
+    if(found){
+        fill_hccapx(&ranked_pairs[rank], hccapx);
+    }
+    session_unlock();
+    return found;
+}
+
+bool hccapx_serializer_get(hccapx_t *hccapx){
+    return hccapx_serializer_get_pair(0, hccapx);
+}
+
+unsigned hccapx_serializer_get_pairs(hccapx_t *pairs, unsigned max){
+    session_lock();
+    rank_pairs_if_dirty();
+    unsigned count = (ranked_pairs_count < max) ? ranked_pairs_count : max;
+    for(unsigned rank = 0; rank < count; rank++){
+        fill_hccapx(&ranked_pairs[rank], &pairs[rank]);
     }
+    session_unlock();
+    return count;
 }
 
 /**
- * @brief Handles second message of handshake - from STA to AP.
+ * @brief Chooses slot for new candidate message.
  * 
- * Saves EAPoL packet as this is the first time key MIC is present.
- * Saves SNonce.
+ * If session is full, the oldest message of the same type is replaced, 
+ * or the oldest message at all if there is no message of the same type.
  * 
- * @param eapol_packet 
- * @param eapol_key_packet 
+ * @param message number of handshake message
+ * @return unsigned index of slot
  */
-static void sta_message_m2(eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    ESP_LOGD(TAG, "From STA M2");
-    message_sta = 2;
-    memcpy(hccapx.nonce_sta, eapol_key_packet->key_nonce, 32);
-    if(save_eapol(eapol_packet, eapol_key_packet) != 0){
-        return;
+static unsigned candidate_slot(uint8_t message){
+    if(session.count < CONFIG_HCCAPX_MAX_CANDIDATES){
+        return session.count++;
     }
-    eapol_source = 2;
-    if(message_ap == 1){
-        hccapx.message_pair = 0;
-        return;
+    int oldest_same = -1;
+    unsigned oldest = 0;
+    for(unsigned i = 0; i < session.count; i++){
+        const handshake_message_t *candidate = &session.messages[i];
+        if((int32_t) (candidate->timestamp - session.messages[oldest].timestamp) < 0){
+            oldest = i;
+        }
+        if((candidate->message == message) && 
+            ((oldest_same < 0) || ((int32_t) (candidate->timestamp - session.messages[oldest_same].timestamp) < 0))){
+            oldest_same = i;
+        }
     }
+    return (oldest_same >= 0) ? oldest_same : oldest;
 }
 
 /**
- * @brief Handles fourth message of the handshake. From STA to AP.
- * 
+ * @brief Stores handshake message as new candidate, unless it's retransmission of already stored message.
  * 
+ * @param message number of handshake message (1-4)
  * @param eapol_packet 
- * @param eapol_key_packet 
+ * @param layout resolved layout of EAPoL-Key packet
+ * @param timestamp 
  */
-static void sta_message_m4(eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    ESP_LOGD(TAG, "From STA M4");
-    if((message_sta == 2) && (eapol_source != 0)){
-        // If message 2 was already fully processed, there is no need to process M4 again 
-        ESP_LOGD(TAG, "Already have M2, not worth");
-        return;
+static void add_candidate(uint8_t message, eapol_packet_t *eapol_packet, const eapol_key_layout_t *layout, uint32_t timestamp){
+    const eapol_key_packet_t *eapol_key_packet = layout->packet;
+    uint64_t replay_counter = replay_counter_value(eapol_key_packet);
+    for(unsigned i = 0; i < session.count; i++){
+        const handshake_message_t *candidate = &session.messages[i];
+        if((candidate->message == message) && (candidate->replay_counter == replay_counter) 
+            && (memcmp(candidate->nonce, eapol_key_packet->key_nonce, 32) == 0)
+            && (memcmp(candidate->mic, layout->mic, 16) == 0)){
+            ESP_LOGD(TAG, "Retransmitted M%u, skipping", message);
+            return;
+        }
     }
-    if(message_ap == 0){
-        // If there was no AP message processed yet, ANonce will be always missing.
-        ESP_LOGE(TAG, "Not enought handshake messages received.");
-        return;
+
+    unsigned eapol_len = 0;
+    if((message == 2) || (message == 4)){
+        eapol_len = sizeof(eapol_packet_header_t) + ntohs(eapol_packet->header.packet_body_length);
+        if(eapol_len > HCCAPX_MAX_EAPOL_SIZE){
+            ESP_LOGW(TAG, "EAPoL is too long (%u/%u)", eapol_len, HCCAPX_MAX_EAPOL_SIZE);
+            return;
+        }
     }
-    if(eapol_source == 3){
-        hccapx.message_pair = 4;
-        return;
+
+    handshake_message_t *candidate = &session.messages[candidate_slot(message)];
+    candidate->message = message;
+    candidate->keyver = hccapx_keyver(layout->descriptor_version);
+    candidate->replay_counter = replay_counter;
+    candidate->timestamp = timestamp;
+    memcpy(candidate->nonce, eapol_key_packet->key_nonce, 32);
+    memcpy(candidate->mic, layout->mic, 16);
+    candidate->eapol_len = eapol_len;
+    if(eapol_len > 0){
+        memcpy(candidate->eapol, eapol_packet, eapol_len);
+        // Clear key MIC from EAPoL packet so hashcat can calulate MIC without preprocessing.
+        // This is not documented in HCCAPX reference.
+        // But it's based on 802.11i-2004 [8.5.2/h] and by analysing behaviour of cap2hccapx tool
+        memset(&candidate->eapol[sizeof(eapol_packet_header_t) + EAPOL_KEY_MIC_OFFSET], 0x0, layout->mic_length);
     }
-    if(save_eapol(eapol_packet, eapol_key_packet) != 0){
-        return;
+    ranking_dirty = true;
+    ESP_LOGD(TAG, "Stored M%u as candidate (%u/%u)", message, session.count, CONFIG_HCCAPX_MAX_CANDIDATES);
+}
+
+hccapx_handshake_state_t hccapx_serializer_get_state(){
+    session_lock();
+    hccapx_handshake_state_t state = session.best_state;
+    session_unlock();
+    return state;
+}
+
+/**
+ * @brief Classifies EAPoL-Key packet as message of 4-way handshake by Key Information bits
+ * 
+ * @code{.unparsed}
+ *     Ack  MIC  Install  Secure
+ * M1   1    0      0       0
+ * M2   0    1      0       0
+ * M3   1    1      1       1 (WPA1: 0)
+ * M4   0    1      0       1 (WPA1: 0)
+ * @endcode
+ * WPA1 M4 has Secure bit clear, so it's distinguished from M2 only by empty nonce.
+ * 
+ * @see Ref: 802.11-2016 [12.7.6]
+ * @param eapol_key_packet 
+ * @return uint8_t number of message (1-4) or 0 if packet is not part of pairwise 4-way handshake
+ */
+static uint8_t classify_message(const eapol_key_packet_t *eapol_key_packet){
+    const key_information_t *key_information = &eapol_key_packet->key_information;
+    if((key_information->key_type != KEY_TYPE_PAIRWISE) || key_information->request || key_information->error){
+        return 0;
+    }
+    if(key_information->key_ack){
+        if(!key_information->key_mic){
+            return 1;
+        }
+        return key_information->install ? 3 : 0;
     }
-    eapol_source = 4;
-    if(message_ap == 1){
-        hccapx.message_pair = 1;
+    if(!key_information->key_mic){
+        return 0;
     }
-    if(message_ap == 3){
-        hccapx.message_pair = 5;
+    if(key_information->secure){
+        return 4;
     }
+    return is_array_zero(eapol_key_packet->key_nonce, 32) ? 4 : 2;
 }
 
 /**
- * @brief Handles messages from STA - M2 and M4
+ * @brief Moves handshake state machine of the session by given message
  * 
- * @param frame 
- * @param eapol_packet 
- * @param eapol_key_packet 
+ * @param message number of handshake message (1-4)
+ * @param replay_counter 
  */
-static void sta_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    if(is_array_zero(hccapx.mac_sta, 6)){
-        memcpy(hccapx.mac_sta, frame->mac_header.addr2, 6);
-    }
-    else if(memcmp(frame->mac_header.addr2, hccapx.mac_sta, 6) != 0){
-        ESP_LOGE(TAG, "Different STA");
-        return;
+static void update_state(uint8_t message, uint64_t replay_counter){
+    const handshake_transition_t *transition = &transitions[session.state][message - 1];
+    switch(transition->replay_counter_check){
+        case RC_NO_TRANSITION:
+            return;
+        case RC_SAME:
+            if(replay_counter != session.replay_counter){
+                return;
+            }
+            break;
+        case RC_NEXT:
+            if(replay_counter != session.replay_counter + 1){
+                return;
+            }
+            break;
     }
-    // Determine which message this is by SNonce
-    // SNonce is present in M2, empty in M4
-    // Ref: 802.11i-2004 [8.5.3]
-    if(!is_array_zero(eapol_key_packet->key_nonce, 16)){
-        sta_message_m2(eapol_packet, eapol_key_packet);
-    } 
-    else {
-        sta_message_m4(eapol_packet, eapol_key_packet);
+    session.state = transition->next_state;
+    session.replay_counter = replay_counter;
+    if(session.state > session.best_state){
+        session.best_state = session.state;
+        ESP_LOGI(TAG, "Handshake progressed to state %u", session.best_state);
     }
 }
 
 /**
- * @detail This component is a state machine, so this function can be used without knowing current state from outside.
+ * @detail Every handshake message of the session is kept as candidate. Pairs are formed and ranked 
+ * only when HCCAPX is requested, so late or mismatched messages never overwrite a good pair.
+ * Progress of the handshake is tracked by table-driven state machine (see transitions).
  * WPA handshake pseudo-diagram:
  * @code{.unparsed}
  * AP           STA
@@ -277,18 +602,58 @@ static void sta_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol
  * @endcode
  * 
  * @param frame 
+ * @param length 
+ * @param timestamp 
  */
-void hccapx_serializer_add_frame(data_frame_t *frame){
+void hccapx_serializer_add_frame(data_frame_t *frame, unsigned length, uint32_t timestamp){
     eapol_packet_t *eapol_packet = parse_eapol_packet(frame);
-    eapol_key_packet_t *eapol_key_packet = parse_eapol_key_packet(eapol_packet);
-    // Determine direction of the frame by comparing BSSID (addr3) with source address (addr2)
-    if(memcmp(frame->mac_header.addr2, frame->mac_header.addr3, 6) == 0){
-        ap_message(frame, eapol_packet, eapol_key_packet);
-    } 
-    else if(memcmp(frame->mac_header.addr1, frame->mac_header.addr3, 6) == 0){
-        sta_message(frame, eapol_packet, eapol_key_packet);
-    } 
-    else {
-        ESP_LOGE(TAG, "Unknown frame format. BSSID is not source nor destionation.");
+    if(eapol_packet == NULL){
+        return;
+    }
+    unsigned eapol_length = eapol_captured_length(frame, length, eapol_packet);
+    eapol_key_layout_t layout;
+    if((eapol_length == 0) || !parse_eapol_key_layout(eapol_packet, eapol_length, &layout)){
+        ESP_LOGD(TAG, "Malformed or truncated EAPoL-Key packet");
+        metrics_counter_inc(&metric_rejected);
+        return;
+    }
+    const eapol_key_packet_t *eapol_key_packet = layout.packet;
+    if(hccapx_keyver(layout.descriptor_version) == 0){
+        // Hashcat can't crack these from HCCAPX (e.g. SAE, OWE, FILS)
+        ESP_LOGW(TAG, "Unsupported key descriptor version %u (AKM-defined)", layout.descriptor_version);
+        metrics_counter_inc(&metric_rejected);
+        return;
+    }
+    uint8_t message = classify_message(eapol_key_packet);
+    if(message == 0){
+        ESP_LOGD(TAG, "Not a 4-way handshake message");
+        return;
+    }
+    // M1 and M3 are sent by AP (addr2 = BSSID), M2 and M4 by STA (addr1 = BSSID)
+    bool from_ap = (message == 1) || (message == 3);
+    mac_t bssid = mac_load(frame->mac_header.addr3);
+    const uint8_t *addr_sta = from_ap ? frame->mac_header.addr1 : frame->mac_header.addr2;
+    const uint8_t *addr_ap = from_ap ? frame->mac_header.addr2 : frame->mac_header.addr1;
+    if(mac_load(addr_ap) != bssid){
+        ESP_LOGE(TAG, "Unknown frame format. M%u direction doesn't match BSSID.", message);
+        metrics_counter_inc(&metric_rejected);
+        return;
+    }
+    session_lock();
+    mac_t mac_sta = mac_load(session.mac_sta);
+    if(mac_is_zero(mac_sta)){
+        memcpy(session.mac_sta, addr_sta, 6);
+        memcpy(session.mac_ap, addr_ap, 6);
+    }
+    else if(mac_load(addr_sta) != mac_sta){
+        session_unlock();
+        ESP_LOGE(TAG, "Different STA");
+        metrics_counter_inc(&metric_rejected);
+        return;
     }
+    ESP_LOGD(TAG, "%s M%u", from_ap ? "From AP" : "From STA", message);
+    metrics_counter_inc(&metric_messages);
+    add_candidate(message, eapol_packet, &layout, timestamp);
+    update_state(message, replay_counter_value(eapol_key_packet));
+    session_unlock();
 }
\ No newline at end of file
@@ -9,10 +9,25 @@
 #ifndef HCCAPX_SERIALIZER_H
 #define HCCAPX_SERIALIZER_H
 
+#include <stdbool.h>
 #include <stdint.h>
+#include "sdkconfig.h"
 
 #include "frame_analyzer_types.h"
 
+/**
+ * @brief Values of hccapx_t message_pair field
+ * 
+ * @see Ref: https://hashcat.net/wiki/doku.php?id=hccapx
+ */
+//@{
+#define HCCAPX_MESSAGE_PAIR_M12E2 0
+#define HCCAPX_MESSAGE_PAIR_M14E4 1
+#define HCCAPX_MESSAGE_PAIR_M32E2 2
+#define HCCAPX_MESSAGE_PAIR_M34E4 5
+#define HCCAPX_MESSAGE_PAIR_RC_NOT_MATCHING 0x80    ///< flag set if replay counters of messages don't match
+//@}
+
 /**
  * @brief HCCAPX structure according to reference
  * 
@@ -34,31 +49,88 @@ typedef struct __attribute__((__packed__)){
     uint8_t eapol[256];
 } hccapx_t;
 
+/**
+ * @brief Progress of 4-way handshake within session
+ */
+typedef enum {
+    HCCAPX_HANDSHAKE_NONE,          ///< no usable message yet
+    HCCAPX_HANDSHAKE_M1,            ///< M1 captured, ANonce known
+    HCCAPX_HANDSHAKE_CHALLENGE,     ///< M2 replying to M1 captured, crackable challenge pair
+    HCCAPX_HANDSHAKE_AUTHORIZED,    ///< M3 following M2 captured, AP accepted MIC
+    HCCAPX_HANDSHAKE_COMPLETE,      ///< M4 replying to M3 captured
+    HCCAPX_HANDSHAKE_STATE_MAX
+} hccapx_handshake_state_t;
+
 /**
  * @brief Creates new HCCAPX buffer for given SSID.
  * 
- * This will clear any previous HCCAPX. If you want to save it, first call hccapx_serializer_get() and copy buffer somewhere else.
+ * This will clear any previous session. If you want to save its pairs, first call hccapx_serializer_get_pairs().
  * @param ssid SSID of AP from which the handshake frames will be comming.
  * @param size length of SSID string (including \0)
  */
 void hccapx_serializer_init(const uint8_t *ssid, unsigned size);
 
 /**
- * @brief Returns pointer to buffer with HCCAPX formatted binary data 
+ * @brief Fills HCCAPX record of the best message pair
+ * 
+ * Same as hccapx_serializer_get_pair(0, hccapx).
+ * @param[out] hccapx
+ * @return true if record was filled
+ * @return false if no pair can be formed from captured messages
+ */
+bool hccapx_serializer_get(hccapx_t *hccapx);
+
+/**
+ * @brief Returns number of ranked message pairs (at most CONFIG_HCCAPX_MAX_PAIRS)
+ * 
+ * @return unsigned 
+ */
+unsigned hccapx_serializer_get_pair_count();
+
+/**
+ * @brief Fills HCCAPX record of message pair with given rank. Rank 0 is the best pair, others are alternates.
+ * 
+ * Pairs are ranked by replay counter match, nonce consistency, authorization (M3/M4 present) 
+ * and time delta between messages.
  * 
- * @return hccapx_t* 
+ * @param rank 
+ * @param[out] hccapx
+ * @return true if record was filled
+ * @return false if there is no pair with given rank
  */
-hccapx_t *hccapx_serializer_get();
+bool hccapx_serializer_get_pair(unsigned rank, hccapx_t *hccapx);
 
 /**
- * @brief Adds new handshake frames into current HCCAPX.
+ * @brief Fills HCCAPX records of ranked pairs, the best first, from single consistent ranking
  * 
- * This function will process given frames and extract data that are relevant.
+ * Use this when records have to match each other, e.g. when checksum is computed before they are sent.
+ * @param[out] pairs array of at least max records
+ * @param max 
+ * @return unsigned number of filled records
+ */
+unsigned hccapx_serializer_get_pairs(hccapx_t *pairs, unsigned max);
+
+/**
+ * @brief Returns furthest progress of any handshake exchange captured in current session
+ * 
+ * @return hccapx_handshake_state_t 
+ */
+hccapx_handshake_state_t hccapx_serializer_get_state();
+
+/**
+ * @brief Adds new handshake frame into current session.
+ * 
+ * Every handshake message is kept as a candidate for pairing. 
  * If frame contains handshake from another STA than the one that was already added before,
  * frame will be skipped and error message will be printed.
  * 
+ * Handshakes with key descriptor versions 1 (WPA), 2 (WPA2) and 3 (WPA2 AES-128-CMAC, e.g. 802.11w) are supported
+ * and keyver of HCCAPX is set accordingly. Frames with AKM-defined descriptor version (e.g. SAE) are skipped with warning.
+ * 
  * @param frame data frame with EAPoL-Key packet
+ * @param length number of captured bytes of frame
+ * @param timestamp capture timestamp of frame in microseconds
  */
-void hccapx_serializer_add_frame(data_frame_t *frame);
+void hccapx_serializer_add_frame(data_frame_t *frame, unsigned length, uint32_t timestamp);
 
 #endif
\ No newline at end of file
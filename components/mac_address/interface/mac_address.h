@@ -0,0 +1,196 @@
+/**
+ * @file mac_address.h
+ * @brief Provides packed 48-bit MAC address type with fast compare/hash and fixed-size MAC set/map containers
+ */
+#ifndef MAC_ADDRESS_H
+#define MAC_ADDRESS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief MAC address packed into 48 lower bits.
+ * 
+ * Bytes are kept in the same order as in memory (first byte of MAC is the lowest byte),
+ * so packing is a single unaligned load on little endian CPU.
+ * 
+ * @note MAC 00:00:00:00:00:00 is reserved as empty key in containers.
+ */
+typedef uint64_t mac_t;
+
+#define MAC_NONE ((mac_t) 0)
+#define MAC_BROADCAST ((mac_t) 0xffffffffffffULL)
+
+/**
+ * @brief Packs 6 bytes MAC address from buffer
+ * 
+ * @param bytes buffer with MAC address (no alignment required)
+ * @return mac_t 
+ */
+static inline mac_t mac_load(const uint8_t *bytes){
+    mac_t mac = 0;
+    memcpy(&mac, bytes, 6);
+    return mac;
+}
+
+/**
+ * @brief Unpacks MAC address into 6 bytes buffer
+ * 
+ * @param mac 
+ * @param bytes output buffer of at least 6 bytes
+ */
+static inline void mac_store(mac_t mac, uint8_t *bytes){
+    memcpy(bytes, &mac, 6);
+}
+
+/**
+ * @brief Compares two MAC addresses stored in buffers
+ * 
+ * @return true if addresses are equal
+ */
+static inline bool mac_bytes_equal(const uint8_t *a, const uint8_t *b){
+    return mac_load(a) == mac_load(b);
+}
+
+/**
+ * @return true if MAC is 00:00:00:00:00:00
+ */
+static inline bool mac_is_zero(mac_t mac){
+    return mac == MAC_NONE;
+}
+
+/**
+ * @return true if MAC is group (multicast or broadcast) address
+ */
+static inline bool mac_is_group(mac_t mac){
+    return (mac & 0x01) != 0;
+}
+
+/**
+ * @brief Returns OUI (first 3 bytes) of MAC address as number, e.g. 0x000FAC for 00:0f:ac:xx:xx:xx
+ * 
+ * @param mac 
+ * @return uint32_t 
+ */
+static inline uint32_t mac_oui(mac_t mac){
+    return ((mac & 0xff) << 16) | (mac & 0xff00) | ((mac >> 16) & 0xff);
+}
+
+/**
+ * @brief Hashes MAC address
+ * 
+ * Both OUI and device specific part are mixed in, so addresses from the same vendor are spread evenly.
+ * Uses only 32-bit arithmetic (murmur3 finalizer).
+ * 
+ * @param mac 
+ * @return uint32_t 
+ */
+static inline uint32_t mac_hash(mac_t mac){
+    uint32_t h = (uint32_t) mac ^ ((uint32_t) (mac >> 32) * 0x9E3779B1u);
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/**
+ * @brief Set of MAC addresses with capacity fixed at compile time
+ * 
+ * Open-addressing hash table with linear probing. Use MAC_SET_DEFINE() to create one.
+ * Set accepts new addresses until it's 7/8 full.
+ */
+typedef struct {
+    mac_t *keys;
+    unsigned capacity;
+    unsigned count;
+} mac_set_t;
+
+/**
+ * @brief Map from MAC address to fixed size value with capacity fixed at compile time
+ * 
+ * Open-addressing hash table with linear probing. Use MAC_MAP_DEFINE() to create one.
+ * Map accepts new addresses until it's 7/8 full.
+ */
+typedef struct {
+    mac_t *keys;
+    void *values;
+    size_t value_size;
+    unsigned capacity;
+    unsigned count;
+} mac_map_t;
+
+/**
+ * @brief Defines static MAC set with given name and capacity
+ */
+#define MAC_SET_DEFINE(name, cap) \
+    static mac_t name##_keys[cap]; \
+    static mac_set_t name = { .keys = name##_keys, .capacity = (cap), .count = 0 }
+
+/**
+ * @brief Defines static MAC map with given name, value type and capacity
+ */
+#define MAC_MAP_DEFINE(name, value_type, cap) \
+    static mac_t name##_keys[cap]; \
+    static value_type name##_values[cap]; \
+    static mac_map_t name = { .keys = name##_keys, .values = name##_values, .value_size = sizeof(value_type), .capacity = (cap), .count = 0 }
+
+/**
+ * @brief Removes all addresses from set
+ */
+void mac_set_clear(mac_set_t *set);
+
+/**
+ * @brief Adds address into set
+ * 
+ * @param set 
+ * @param mac non-zero MAC address
+ * @return true if address was added
+ * @return false if address already was in the set, set is full or address is MAC_NONE
+ */
+bool mac_set_insert(mac_set_t *set, mac_t mac);
+
+/**
+ * @return true if address is in the set, never for MAC_NONE
+ */
+bool mac_set_contains(const mac_set_t *set, mac_t mac);
+
+/**
+ * @brief Removes all entries from map. Values are zeroed.
+ */
+void mac_map_clear(mac_map_t *map);
+
+/**
+ * @brief Finds value for given address
+ * 
+ * @return void* pointer to value
+ * @return \c NULL if address is not in map or is MAC_NONE
+ */
+void *mac_map_get(const mac_map_t *map, mac_t mac);
+
+/**
+ * @brief Finds value for given address or creates new zeroed entry
+ * 
+ * @param map 
+ * @param mac non-zero MAC address
+ * @param created output parameter, set to true if new entry was created (optional)
+ * @return void* pointer to value
+ * @return \c NULL if address is not in the map and map is full, or address is MAC_NONE
+ */
+void *mac_map_get_or_insert(mac_map_t *map, mac_t mac, bool *created);
+
+/**
+ * @brief Returns entry in given slot of map. Useful for iterating all entries.
+ * 
+ * @param map 
+ * @param slot slot index in range 0 to capacity - 1
+ * @param mac output parameter for address of the entry (optional)
+ * @return void* pointer to value
+ * @return \c NULL if slot is empty
+ */
+void *mac_map_at(const mac_map_t *map, unsigned slot, mac_t *mac);
+
+#endif
@@ -0,0 +1,112 @@
+/**
+ * @file mac_address.c
+ * @brief Implements fixed-size MAC set/map containers
+ */
+#include "mac_address.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief Finds slot of given address or empty slot where it should be inserted
+ * 
+ * Containers are never completely full, so empty slot always terminates probing.
+ * 
+ * @param keys 
+ * @param capacity 
+ * @param mac 
+ * @return unsigned slot index
+ */
+static unsigned find_slot(const mac_t *keys, unsigned capacity, mac_t mac){
+    unsigned slot = mac_hash(mac) % capacity;
+    while((keys[slot] != MAC_NONE) && (keys[slot] != mac)){
+        slot = (slot + 1) % capacity;
+    }
+    return slot;
+}
+
+/**
+ * @return true if container with given capacity and count can accept new key
+ */
+static inline bool has_space(unsigned capacity, unsigned count){
+    unsigned reserve = capacity / 8;
+    // At least one slot has to stay empty to terminate probing
+    return count < capacity - ((reserve > 0) ? reserve : 1);
+}
+
+void mac_set_clear(mac_set_t *set){
+    memset(set->keys, 0, set->capacity * sizeof(mac_t));
+    set->count = 0;
+}
+
+bool mac_set_insert(mac_set_t *set, mac_t mac){
+    if(mac == MAC_NONE){
+        return false;
+    }
+    unsigned slot = find_slot(set->keys, set->capacity, mac);
+    if(set->keys[slot] == mac){
+        return false;
+    }
+    if(!has_space(set->capacity, set->count)){
+        return false;
+    }
+    set->keys[slot] = mac;
+    set->count++;
+    return true;
+}
+
+bool mac_set_contains(const mac_set_t *set, mac_t mac){
+    // MAC_NONE marks empty slots, so probing for it would stop at the first empty slot and report a match
+    if(mac == MAC_NONE){
+        return false;
+    }
+    return set->keys[find_slot(set->keys, set->capacity, mac)] == mac;
+}
+
+void mac_map_clear(mac_map_t *map){
+    memset(map->keys, 0, map->capacity * sizeof(mac_t));
+    memset(map->values, 0, map->capacity * map->value_size);
+    map->count = 0;
+}
+
+void *mac_map_get(const mac_map_t *map, mac_t mac){
+    if(mac == MAC_NONE){
+        return NULL;
+    }
+    unsigned slot = find_slot(map->keys, map->capacity, mac);
+    if(map->keys[slot] != mac){
+        return NULL;
+    }
+    return (uint8_t *) map->values + slot * map->value_size;
+}
+
+void *mac_map_get_or_insert(mac_map_t *map, mac_t mac, bool *created){
+    if(created != NULL){
+        *created = false;
+    }
+    if(mac == MAC_NONE){
+        return NULL;
+    }
+    unsigned slot = find_slot(map->keys, map->capacity, mac);
+    if(map->keys[slot] != mac){
+        if(!has_space(map->capacity, map->count)){
+            return NULL;
+        }
+        map->keys[slot] = mac;
+        map->count++;
+        if(created != NULL){
+            *created = true;
+        }
+    }
+    return (uint8_t *) map->values + slot * map->value_size;
+}
+
+void *mac_map_at(const mac_map_t *map, unsigned slot, mac_t *mac){
+    if((slot >= map->capacity) || (map->keys[slot] == MAC_NONE)){
+        return NULL;
+    }
+    if(mac != NULL){
+        *mac = map->keys[slot];
+    }
+    return (uint8_t *) map->values + slot * map->value_size;
+}
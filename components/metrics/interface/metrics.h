@@ -0,0 +1,124 @@
+/**
+ * @file metrics.h
+ * @brief Provides low-overhead registry of counters, gauges and histograms exported in Prometheus text format
+ *
+ * Metrics are statically allocated by METRICS_*_DEFINE macros in module that owns them and registered once
+ * by metrics_register(). Updates are lock-free, except histograms that take short critical section.
+ * Counters keep one slot per CPU core, so both cores can count the same event without contention.
+ */
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+/**
+ * @brief Maximum number of finite buckets of histogram
+ */
+#define METRICS_HISTOGRAM_MAX_BUCKETS 10
+
+typedef enum {
+    METRICS_TYPE_COUNTER,
+    METRICS_TYPE_GAUGE,
+    METRICS_TYPE_HISTOGRAM
+} metrics_type_t;
+
+typedef struct {
+    portMUX_TYPE lock;
+    const uint32_t *bounds;                                 //< ascending upper bounds of finite buckets
+    unsigned bound_count;
+    uint32_t buckets[METRICS_HISTOGRAM_MAX_BUCKETS + 1];    //< non-cumulative, the last one is +Inf
+    uint64_t sum;
+} metrics_histogram_t;
+
+/**
+ * @brief Single metric. Metrics with the same name (differing only by labels) should be registered consecutively.
+ */
+typedef struct metrics_metric {
+    struct metrics_metric *next;
+    const char *name;
+    const char *labels;         //< e.g. type="data", NULL if metric has no labels
+    const char *help;
+    metrics_type_t type;
+    union {
+        uint32_t counter[portNUM_PROCESSORS];
+        int32_t gauge;
+        metrics_histogram_t histogram;
+    };
+} metrics_metric_t;
+
+/**
+ * @brief Writer of exported text
+ *
+ * @param ctx context passed to metrics_write()
+ * @param text null-terminated chunk of text
+ */
+typedef esp_err_t (*metrics_writer_t)(void *ctx, const char *text);
+
+/**
+ * @brief Define metric variables
+ *
+ * @param var name of variable
+ * @param name_ metric name
+ * @param labels_ label set without braces or NULL
+ * @param help_ description
+ * @{
+ */
+#define METRICS_COUNTER_DEFINE(var, name_, labels_, help_) \
+    static metrics_metric_t var = { .name = name_, .labels = labels_, .help = help_, .type = METRICS_TYPE_COUNTER }
+
+#define METRICS_GAUGE_DEFINE(var, name_, labels_, help_) \
+    static metrics_metric_t var = { .name = name_, .labels = labels_, .help = help_, .type = METRICS_TYPE_GAUGE }
+
+/** @param bounds_ static array of ascending bucket upper bounds, at most METRICS_HISTOGRAM_MAX_BUCKETS items */
+#define METRICS_HISTOGRAM_DEFINE(var, name_, labels_, help_, bounds_) \
+    static metrics_metric_t var = { .name = name_, .labels = labels_, .help = help_, .type = METRICS_TYPE_HISTOGRAM, \
+        .histogram = { .lock = portMUX_INITIALIZER_UNLOCKED, .bounds = bounds_, .bound_count = sizeof(bounds_) / sizeof(bounds_[0]) } }
+//@}
+
+/**
+ * @brief Adds metric to registry. Registering already registered metric does nothing.
+ *
+ * @param metric statically allocated metric
+ */
+void metrics_register(metrics_metric_t *metric);
+
+/**
+ * @brief Adds value to counter
+ */
+static inline void metrics_counter_add(metrics_metric_t *metric, uint32_t value){
+    __atomic_fetch_add(&metric->counter[xPortGetCoreID()], value, __ATOMIC_RELAXED);
+}
+
+static inline void metrics_counter_inc(metrics_metric_t *metric){
+    metrics_counter_add(metric, 1);
+}
+
+static inline void metrics_gauge_set(metrics_metric_t *metric, int32_t value){
+    __atomic_store_n(&metric->gauge, value, __ATOMIC_RELAXED);
+}
+
+static inline void metrics_gauge_add(metrics_metric_t *metric, int32_t value){
+    __atomic_fetch_add(&metric->gauge, value, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Records one observation into histogram
+ *
+ * @param metric
+ * @param value e.g. duration in microseconds
+ */
+void metrics_histogram_observe(metrics_metric_t *metric, uint32_t value);
+
+/**
+ * @brief Writes all registered metrics followed by system metrics (heap and task stacks) in Prometheus text format.
+ *
+ * @param writer
+ * @param ctx context passed to writer
+ * @return esp_err_t ESP_OK or first error returned by writer
+ */
+esp_err_t metrics_write(metrics_writer_t writer, void *ctx);
+
+#endif
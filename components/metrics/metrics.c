@@ -0,0 +1,197 @@
+/**
+ * @file metrics.c
+ * @brief Implements metrics registry and Prometheus text exposition
+ */
+#include "metrics.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "esp_system.h"
+#include "esp_heap_caps.h"
+#include "freertos/task.h"
+
+static portMUX_TYPE registry_lock = portMUX_INITIALIZER_UNLOCKED;
+static metrics_metric_t *first = NULL;
+static metrics_metric_t *last = NULL;
+
+void metrics_register(metrics_metric_t *metric){
+    portENTER_CRITICAL(&registry_lock);
+    if((metric->next == NULL) && (metric != last)){
+        if(last == NULL){
+            first = metric;
+        }
+        else {
+            last->next = metric;
+        }
+        last = metric;
+    }
+    portEXIT_CRITICAL(&registry_lock);
+}
+
+void metrics_histogram_observe(metrics_metric_t *metric, uint32_t value){
+    metrics_histogram_t *histogram = &metric->histogram;
+    unsigned bucket = 0;
+    while((bucket < histogram->bound_count) && (value > histogram->bounds[bucket])){
+        bucket++;
+    }
+    portENTER_CRITICAL(&histogram->lock);
+    histogram->buckets[bucket]++;
+    histogram->sum += value;
+    portEXIT_CRITICAL(&histogram->lock);
+}
+
+/**
+ * @brief Writes HELP and TYPE lines
+ */
+static esp_err_t write_header(metrics_writer_t writer, void *ctx, const char *name, const char *help, const char *type){
+    char line[160];
+    snprintf(line, sizeof(line), "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+    return writer(ctx, line);
+}
+
+/**
+ * @brief Writes sample line
+ *
+ * @param suffix appended to metric name (e.g. _bucket)
+ * @param labels label set of metric or NULL
+ * @param extra_label additional label (e.g. le="10") or NULL
+ * @param value formatted value
+ */
+static esp_err_t write_sample(metrics_writer_t writer, void *ctx, const char *name, const char *suffix, const char *labels,
+    const char *extra_label, const char *value){
+    char line[160];
+    if((labels == NULL) && (extra_label == NULL)){
+        snprintf(line, sizeof(line), "%s%s %s\n", name, suffix, value);
+    }
+    else {
+        snprintf(line, sizeof(line), "%s%s{%s%s%s} %s\n", name, suffix, (labels != NULL) ? labels : "",
+            ((labels != NULL) && (extra_label != NULL)) ? "," : "", (extra_label != NULL) ? extra_label : "", value);
+    }
+    return writer(ctx, line);
+}
+
+static esp_err_t write_histogram(metrics_writer_t writer, void *ctx, metrics_metric_t *metric){
+    metrics_histogram_t snapshot;
+    portENTER_CRITICAL(&metric->histogram.lock);
+    snapshot = metric->histogram;
+    portEXIT_CRITICAL(&metric->histogram.lock);
+
+    esp_err_t err;
+    char label[24];
+    char value[24];
+    uint32_t cumulative = 0;
+    for(unsigned i = 0; i <= snapshot.bound_count; i++){
+        cumulative += snapshot.buckets[i];
+        if(i < snapshot.bound_count){
+            snprintf(label, sizeof(label), "le=\"%u\"", snapshot.bounds[i]);
+        }
+        else {
+            snprintf(label, sizeof(label), "le=\"+Inf\"");
+        }
+        snprintf(value, sizeof(value), "%u", cumulative);
+        if((err = write_sample(writer, ctx, metric->name, "_bucket", metric->labels, label, value)) != ESP_OK){
+            return err;
+        }
+    }
+    snprintf(value, sizeof(value), "%llu", (unsigned long long) snapshot.sum);
+    if((err = write_sample(writer, ctx, metric->name, "_sum", metric->labels, NULL, value)) != ESP_OK){
+        return err;
+    }
+    snprintf(value, sizeof(value), "%u", cumulative);
+    return write_sample(writer, ctx, metric->name, "_count", metric->labels, NULL, value);
+}
+
+static esp_err_t write_metric(metrics_writer_t writer, void *ctx, metrics_metric_t *metric){
+    char value[24];
+    switch(metric->type){
+        case METRICS_TYPE_COUNTER: {
+            uint32_t total = 0;
+            for(unsigned core = 0; core < portNUM_PROCESSORS; core++){
+                total += __atomic_load_n(&metric->counter[core], __ATOMIC_RELAXED);
+            }
+            snprintf(value, sizeof(value), "%u", total);
+            return write_sample(writer, ctx, metric->name, "", metric->labels, NULL, value);
+        }
+        case METRICS_TYPE_GAUGE:
+            snprintf(value, sizeof(value), "%d", __atomic_load_n(&metric->gauge, __ATOMIC_RELAXED));
+            return write_sample(writer, ctx, metric->name, "", metric->labels, NULL, value);
+        case METRICS_TYPE_HISTOGRAM:
+            return write_histogram(writer, ctx, metric);
+        default:
+            return ESP_OK;
+    }
+}
+
+/**
+ * @brief Writes heap and task stack metrics collected at the time of export
+ */
+static esp_err_t write_system_metrics(metrics_writer_t writer, void *ctx){
+    esp_err_t err;
+    char value[24];
+    char label[48];
+    const struct {
+        const char *name;
+        const char *help;
+        uint32_t value;
+    } heap_metrics[] = {
+        { "heap_free_bytes", "Currently free heap", esp_get_free_heap_size() },
+        { "heap_min_free_bytes", "Minimum free heap since boot", esp_get_minimum_free_heap_size() },
+        { "heap_largest_free_block_bytes", "Largest free 8-bit capable heap block", heap_caps_get_largest_free_block(MALLOC_CAP_8BIT) }
+    };
+    for(unsigned i = 0; i < sizeof(heap_metrics) / sizeof(heap_metrics[0]); i++){
+        snprintf(value, sizeof(value), "%u", heap_metrics[i].value);
+        if(((err = write_header(writer, ctx, heap_metrics[i].name, heap_metrics[i].help, "gauge")) != ESP_OK)
+            || ((err = write_sample(writer, ctx, heap_metrics[i].name, "", NULL, NULL, value)) != ESP_OK)){
+            return err;
+        }
+    }
+
+#ifdef CONFIG_FREERTOS_USE_TRACE_FACILITY
+    // tasks may be created meanwhile, so leave some room
+    UBaseType_t task_count = uxTaskGetNumberOfTasks() + 2;
+    TaskStatus_t *tasks = (TaskStatus_t *) malloc(task_count * sizeof(TaskStatus_t));
+    if(tasks == NULL){
+        return ESP_OK;
+    }
+    task_count = uxTaskGetSystemState(tasks, task_count, NULL);
+    err = write_header(writer, ctx, "task_stack_high_water_mark_bytes", "Minimum free stack space of task since its start", "gauge");
+    for(unsigned i = 0; (i < task_count) && (err == ESP_OK); i++){
+        snprintf(label, sizeof(label), "task=\"%s\"", tasks[i].pcTaskName);
+        snprintf(value, sizeof(value), "%u", (unsigned) tasks[i].usStackHighWaterMark);
+        err = write_sample(writer, ctx, "task_stack_high_water_mark_bytes", "", NULL, label, value);
+    }
+    free(tasks);
+    return err;
+#else
+    snprintf(label, sizeof(label), "task=\"%s\"", pcTaskGetTaskName(NULL));
+    snprintf(value, sizeof(value), "%u", (unsigned) uxTaskGetStackHighWaterMark(NULL));
+    if((err = write_header(writer, ctx, "task_stack_high_water_mark_bytes", "Minimum free stack space of task since its start", "gauge")) != ESP_OK){
+        return err;
+    }
+    return write_sample(writer, ctx, "task_stack_high_water_mark_bytes", "", NULL, label, value);
+#endif
+}
+
+esp_err_t metrics_write(metrics_writer_t writer, void *ctx){
+    static const char *type_names[] = { "counter", "gauge", "histogram" };
+    esp_err_t err;
+    const char *previous_name = NULL;
+    portENTER_CRITICAL(&registry_lock);
+    metrics_metric_t *metric = first;
+    portEXIT_CRITICAL(&registry_lock);
+    // registered metrics are never removed, so the list can be walked without lock
+    for(; metric != NULL; metric = metric->next){
+        if((previous_name == NULL) || (strcmp(previous_name, metric->name) != 0)){
+            if((err = write_header(writer, ctx, metric->name, metric->help, type_names[metric->type])) != ESP_OK){
+                return err;
+            }
+            previous_name = metric->name;
+        }
+        if((err = write_metric(writer, ctx, metric)) != ESP_OK){
+            return err;
+        }
+    }
+    return write_system_metrics(writer, ctx);
+}
@@ -10,6 +10,7 @@
 #define PCAP_SERIALIZER_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /**
  * @brief PCAP global header
@@ -38,6 +39,58 @@ typedef struct {
         uint32_t orig_len;       /* actual length of packet */
 } pcap_record_header_t;
 
+/**
+ * @brief Radiotap header prepended to every frame (LINKTYPE_IEEE802_11_RADIOTAP)
+ * 
+ * Contains Flags, Channel and Antenna signal fields.
+ * @see Ref: https://www.radiotap.org/
+ */
+typedef struct __attribute__((__packed__)) {
+    uint8_t version;            /* always 0 */
+    uint8_t pad;
+    uint16_t length;            /* length of whole radiotap header */
+    uint32_t present;           /* bitmask of present fields */
+    uint8_t flags;              /* e.g. frame includes FCS */
+    uint8_t pad_channel;        /* channel field is 2 bytes aligned */
+    uint16_t channel_frequency; /* MHz */
+    uint16_t channel_flags;
+    int8_t antenna_signal;      /* dBm */
+} pcap_radiotap_header_t;
+
+/**
+ * @brief Metadata of captured frame stored in radiotap header
+ */
+typedef struct {
+    uint8_t channel;    //< channel frame was captured on, 0 if unknown
+    int8_t rssi;        //< signal strength in dBm
+    bool fcs;           //< frame buffer ends with 4 bytes of FCS
+} pcap_frame_info_t;
+
+/**
+ * @brief Size of PCAP record header followed by radiotap header that precedes every frame
+ */
+#define PCAP_SERIALIZER_RECORD_HEADER_SIZE (sizeof(pcap_record_header_t) + sizeof(pcap_radiotap_header_t))
+
+/**
+ * @brief Fills PCAP global header.
+ * 
+ * Together with pcap_serializer_write_record_header() it allows to stream PCAP file 
+ * (e.g. from persistent storage) without PCAP buffer.
+ * @param header output header
+ */
+void pcap_serializer_write_global_header(pcap_global_header_t *header);
+
+/**
+ * @brief Writes PCAP record header and radiotap header of one frame.
+ * 
+ * @param header output buffer of PCAP_SERIALIZER_RECORD_HEADER_SIZE bytes
+ * @param size size of frame
+ * @param ts_usec timestamp of captured frame in microseconds
+ * @param info metadata of frame stored in radiotap header
+ * @return unsigned number of frame bytes that should follow the header (frame may be truncated to snaplen)
+ */
+unsigned pcap_serializer_write_record_header(uint8_t *header, unsigned size, unsigned ts_usec, const pcap_frame_info_t *info);
+
 /**
  * @brief Prepares new empty buffer for PCAP formatted binary data. 
  * 
@@ -54,8 +107,9 @@ uint8_t *pcap_serializer_init();
  * @param buffer frame buffer that should be appended to PCAP
  * @param size size of frame buffer
  * @param ts_usec timestamp of captured frame in microseconds
+ * @param info metadata of frame stored in radiotap header
  */
-void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, unsigned ts_usec);
+void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, unsigned ts_usec, const pcap_frame_info_t *info);
 
 /**
  * @brief Frees PCAP buffer and resets all values.
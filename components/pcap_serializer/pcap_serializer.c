@@ -10,12 +10,22 @@
 
 #include <stdint.h>
 #include <string.h>
-#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#define LOG_LOCAL_LEVEL CONFIG_PCAP_SERIALIZER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
+#include "metrics.h"
 
 static const char *TAG = "pcap_serializer";
 
+/**
+ * @brief Metrics of PCAP buffer
+ * @{
+ */
+METRICS_COUNTER_DEFINE(metric_frames, "pcap_serializer_frames_total", NULL, "Frames appended to PCAP buffer");
+METRICS_COUNTER_DEFINE(metric_dropped_frames, "pcap_serializer_dropped_frames_total", NULL, "Frames lost because PCAP buffer couldn't grow");
+METRICS_GAUGE_DEFINE(metric_size, "pcap_serializer_size_bytes", NULL, "Current size of PCAP buffer");
+//@}
+
 
 /**
  * @brief Constanst according to reference
@@ -30,66 +40,107 @@ static const char *TAG = "pcap_serializer";
 /**
  * @brief Constanst according to reference
  * 
- * @see Ref: http://www.tcpdump.org/linktypes.html (LINKTYPE_IEEE802_11)
+ * @see Ref: http://www.tcpdump.org/linktypes.html (LINKTYPE_IEEE802_11_RADIOTAP)
+ */
+#define LINKTYPE_IEEE802_11_RADIOTAP 127
+
+/**
+ * @brief Constanst according to reference
+ * 
+ * @see Ref: https://www.radiotap.org/fields/defined
  */
-#define LINKTYPE_IEEE802_11 105
+//@{
+#define RADIOTAP_PRESENT_FLAGS (1 << 1)
+#define RADIOTAP_PRESENT_CHANNEL (1 << 3)
+#define RADIOTAP_PRESENT_ANTENNA_SIGNAL (1 << 5)
+#define RADIOTAP_FLAGS_FCS 0x10
+#define RADIOTAP_CHANNEL_FLAGS_2GHZ 0x0080
+//@}
 
 static unsigned pcap_size = 0;
 static uint8_t *pcap_buffer = NULL;
 
+void pcap_serializer_write_global_header(pcap_global_header_t *header){
+    // Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#global-header
+    header->magic_number = PCAP_MAGIC_NUMBER;
+    header->version_major = 2;
+    header->version_minor = 4;
+    header->thiszone = 0;
+    header->sigfigs = 0;
+    header->snaplen = SNAPLEN;
+    header->network = LINKTYPE_IEEE802_11_RADIOTAP;
+}
+
+unsigned pcap_serializer_write_record_header(uint8_t *header, unsigned size, unsigned ts_usec, const pcap_frame_info_t *info){
+    // Ref: https://www.radiotap.org/
+    pcap_radiotap_header_t radiotap_header = {
+        .version = 0,
+        .length = sizeof(pcap_radiotap_header_t),
+        .present = RADIOTAP_PRESENT_FLAGS | RADIOTAP_PRESENT_CHANNEL | RADIOTAP_PRESENT_ANTENNA_SIGNAL,
+        .flags = info->fcs ? RADIOTAP_FLAGS_FCS : 0,
+        .channel_frequency = (info->channel == 14) ? 2484 : ((info->channel == 0) ? 0 : 2407 + 5 * info->channel),
+        .channel_flags = RADIOTAP_CHANNEL_FLAGS_2GHZ,
+        .antenna_signal = info->rssi
+    };
+    // Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#record-packet-header
+    // Stored packet/frame cannot be larger than SNAPLEN, original length is kept
+    unsigned orig_size = size;
+    if(size > SNAPLEN - sizeof(pcap_radiotap_header_t)){
+        size = SNAPLEN - sizeof(pcap_radiotap_header_t);
+    }
+    pcap_record_header_t pcap_record_header = {
+        .ts_sec = ts_usec / 1000000,
+        .ts_usec = ts_usec % 1000000,
+        .incl_len = sizeof(pcap_radiotap_header_t) + size,
+        .orig_len = sizeof(pcap_radiotap_header_t) + orig_size,
+    };
+    memcpy(header, &pcap_record_header, sizeof(pcap_record_header_t));
+    memcpy(&header[sizeof(pcap_record_header_t)], &radiotap_header, sizeof(pcap_radiotap_header_t));
+    return size;
+}
+
 uint8_t *pcap_serializer_init(){
     // Make sure memory from previous attack is freed
     free(pcap_buffer);
-    // Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#global-header
-    pcap_global_header_t pcap_global_header = {
-        .magic_number = PCAP_MAGIC_NUMBER,
-        .version_major = 2,
-        .version_minor = 4,
-        .thiszone = 0,
-        .sigfigs = 0,
-        .snaplen = SNAPLEN,
-        .network = LINKTYPE_IEEE802_11
-    };
     pcap_buffer = (uint8_t *)malloc(sizeof(pcap_global_header_t));
     pcap_size = sizeof(pcap_global_header_t);
-    memcpy(pcap_buffer, &pcap_global_header, sizeof(pcap_global_header_t));
+    pcap_serializer_write_global_header((pcap_global_header_t *) pcap_buffer);
+    metrics_register(&metric_frames);
+    metrics_register(&metric_dropped_frames);
+    metrics_register(&metric_size);
+    metrics_gauge_set(&metric_size, pcap_size);
     return pcap_buffer;
 }
 
-void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, unsigned ts_usec){
+void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, unsigned ts_usec, const pcap_frame_info_t *info){
     if(size == 0){
         ESP_LOGD(TAG, "Frame size is 0. Not appending anything.");
         return;
     }
-    // Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#record-packet-header
-    pcap_record_header_t pcap_record_header = {
-        .ts_sec = ts_usec / 1000000,
-        .ts_usec = ts_usec % 1000000,
-        .incl_len = size,
-        .orig_len = size,
-    };
-    // Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#record-packet-header
-    // Stored packet/frame cannot be larger than SNAPLEN
-    if(size > SNAPLEN){
-        size = SNAPLEN;
-        pcap_record_header.incl_len = SNAPLEN;
-    }
+    uint8_t record_header[PCAP_SERIALIZER_RECORD_HEADER_SIZE];
+    size = pcap_serializer_write_record_header(record_header, size, ts_usec, info);
 
-    uint8_t *reallocated_pcap_buffer = realloc(pcap_buffer, pcap_size + sizeof(pcap_record_header_t) + size);
+    unsigned record_size = PCAP_SERIALIZER_RECORD_HEADER_SIZE + size;
+    uint8_t *reallocated_pcap_buffer = realloc(pcap_buffer, pcap_size + record_size);
     if(reallocated_pcap_buffer == NULL){
         ESP_LOGE(TAG, "Error reallocating PCAP buffer! PCAP buffer may not be complete.");
+        metrics_counter_inc(&metric_dropped_frames);
         return;
     }
-    memcpy(&reallocated_pcap_buffer[pcap_size], &pcap_record_header, sizeof(pcap_record_header_t));
-    memcpy(&reallocated_pcap_buffer[pcap_size + sizeof(pcap_record_header_t)], buffer, size);
+    uint8_t *record = &reallocated_pcap_buffer[pcap_size];
+    memcpy(record, record_header, PCAP_SERIALIZER_RECORD_HEADER_SIZE);
+    memcpy(&record[PCAP_SERIALIZER_RECORD_HEADER_SIZE], buffer, size);
     pcap_buffer = reallocated_pcap_buffer;
-    pcap_size += sizeof(pcap_record_header_t) + size;
+    pcap_size += record_size;
+    metrics_counter_inc(&metric_frames);
+    metrics_gauge_set(&metric_size, pcap_size);
 }
 
 void pcap_serializer_deinit(){
     free(pcap_buffer);
     pcap_buffer = NULL;
     pcap_size = 0;
+    metrics_gauge_set(&metric_size, 0);
 }
 
 unsigned pcap_serializer_get_size(){
@@ -0,0 +1,162 @@
+/**
+ * @file result_history.h
+ * @brief Provides bounded in-memory history of finished attack sessions and their results
+ *
+ * Session is built in two steps. Writer first fills pending session using result_history_begin() and
+ * result_history_append() and then publishes it by result_history_commit(). Committed sessions are read-only
+ * and reference counted, so readers can stream them without blocking writer.
+ * History is bounded by number of sessions and by total size of payloads, the oldest sessions are evicted first.
+ */
+#ifndef RESULT_HISTORY_H
+#define RESULT_HISTORY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+
+/**
+ * @brief Payload kinds stored with session
+ */
+typedef enum {
+    RESULT_HISTORY_PAYLOAD_PCAP,    //< PCAP file
+    RESULT_HISTORY_PAYLOAD_HCCAPX,  //< array of hccapx_t, the best pair first
+    RESULT_HISTORY_PAYLOAD_PMKID,   //< array of pmkid_record_t
+    RESULT_HISTORY_PAYLOAD_MAX
+} result_history_payload_t;
+
+/**
+ * @brief Session flag set when payload of given kind didn't fit into memory budget and was dropped
+ *
+ * Payloads are never stored partially, missing payload has zero size.
+ */
+#define RESULT_HISTORY_MISSING(payload) (1 << (payload))
+
+/**
+ * @brief Number of attack milestones kept with session (attack_milestone_t of main component)
+ */
+#define RESULT_HISTORY_MILESTONES 10
+
+/**
+ * @brief Metadata of one session
+ */
+typedef struct {
+    uint16_t id;                //< assigned on commit
+    uint8_t flags;              //< RESULT_HISTORY_MISSING() flags
+    uint8_t attack_type;
+    uint8_t attack_method;
+    uint8_t outcome;            //< attack state the session ended with
+    uint8_t channel;
+    uint8_t bssid[6];
+    uint8_t ssid_length;
+    uint8_t ssid[32];
+    uint32_t start_time;        //< ms since boot
+    uint32_t end_time;          //< ms since boot
+    uint16_t frames;            //< data frames captured from target
+    uint16_t handshakes;        //< HCCAPX message pairs
+    uint16_t pmkids;            //< unique PMKIDs
+    uint16_t log_session_id;    //< ID of session in persistent capture log, 0 if not logged
+    uint32_t milestones[RESULT_HISTORY_MILESTONES];  //< ms since start_time, UINT32_MAX if milestone was not reached
+} result_history_meta_t;
+
+/**
+ * @brief Session with metadata and payloads
+ */
+typedef struct {
+    result_history_meta_t meta;
+    uint8_t *payloads[RESULT_HISTORY_PAYLOAD_MAX];
+    unsigned payload_sizes[RESULT_HISTORY_PAYLOAD_MAX];
+} result_history_session_t;
+
+/**
+ * @brief Initialises history lock. Has to be called before any other function.
+ */
+void result_history_init();
+
+/**
+ * @brief Starts pending session. Previous uncommitted session is discarded.
+ *
+ * @param meta metadata of session, counts and end time can be updated until commit via result_history_pending_meta()
+ */
+void result_history_begin(const result_history_meta_t *meta);
+
+/**
+ * @brief Returns metadata of pending session, so writer can update it before commit.
+ *
+ * @return result_history_meta_t* \c NULL if there is no pending session
+ */
+result_history_meta_t *result_history_pending_meta();
+
+/**
+ * @brief Appends data to payload of pending session.
+ *
+ * @param payload kind of payload
+ * @param data
+ * @param length
+ * @return esp_err_t
+ *  - ESP_OK on success
+ *  - ESP_ERR_INVALID_STATE if there is no pending session
+ *  - ESP_ERR_NO_MEM if data would exceed memory budget or allocation failed, whole payload is dropped
+ *    and marked by RESULT_HISTORY_MISSING() flag
+ */
+esp_err_t result_history_append(result_history_payload_t payload, const void *data, unsigned length);
+
+/**
+ * @brief Publishes pending session. The oldest sessions are evicted to stay within limits.
+ *
+ * @return uint16_t ID of committed session, 0 if there was no pending session or allocation failed
+ */
+uint16_t result_history_commit();
+
+/**
+ * @brief Locks history for reading. Sessions returned by getters stay valid until result_history_unlock().
+ *
+ * Keep the lock short, result_history_commit() waits for it. Use result_history_acquire() for slow readers.
+ */
+void result_history_lock();
+
+/**
+ * @brief Unlocks history after reading.
+ */
+void result_history_unlock();
+
+/**
+ * @brief Returns number of committed sessions. Call with history locked.
+ *
+ * @return unsigned
+ */
+unsigned result_history_count();
+
+/**
+ * @brief Returns committed session by index, the newest session has index 0. Call with history locked.
+ *
+ * @param index
+ * @return const result_history_session_t* \c NULL if index is out of range
+ */
+const result_history_session_t *result_history_get(unsigned index);
+
+/**
+ * @brief Returns committed session by ID. Call with history locked.
+ *
+ * @param id
+ * @return const result_history_session_t* \c NULL if session is not in history
+ */
+const result_history_session_t *result_history_find(uint16_t id);
+
+/**
+ * @brief Takes reference to committed session by ID. Call without history locked.
+ *
+ * Session stays valid until result_history_release(), even if it is evicted from history meanwhile.
+ * @param id
+ * @return const result_history_session_t* \c NULL if session is not in history
+ */
+const result_history_session_t *result_history_acquire(uint16_t id);
+
+/**
+ * @brief Releases session reference taken by result_history_acquire(). Call without history locked.
+ *
+ * @param session may be \c NULL
+ */
+void result_history_release(const result_history_session_t *session);
+
+#endif
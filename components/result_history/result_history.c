@@ -0,0 +1,200 @@
+/**
+ * @file result_history.c
+ * @brief Implements bounded in-memory history of attack sessions
+ */
+#include "result_history.h"
+
+#include <stdlib.h>
+#include <string.h>
+#define LOG_LOCAL_LEVEL CONFIG_RESULT_HISTORY_LOG_LEVEL
+#include "esp_log.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+static const char *TAG = "result_history";
+
+static SemaphoreHandle_t lock = NULL;
+
+/**
+ * @brief Committed session with reference count
+ */
+typedef struct {
+    result_history_session_t session;   //< first member, so session pointer can be converted back to entry
+    uint32_t refs;                      //< one reference is held while in history, one by every reader
+} session_entry_t;
+
+/**
+ * @brief Committed sessions, the oldest first
+ */
+//@{
+static session_entry_t *sessions[CONFIG_RESULT_HISTORY_MAX_SESSIONS];
+static unsigned sessions_count = 0;
+static unsigned used_bytes = 0;
+static uint16_t next_id = 1;
+//@}
+
+static result_history_session_t pending;
+static bool pending_active = false;
+
+static unsigned session_size(const result_history_session_t *session){
+    unsigned size = 0;
+    for(unsigned i = 0; i < RESULT_HISTORY_PAYLOAD_MAX; i++){
+        size += session->payload_sizes[i];
+    }
+    return size;
+}
+
+static void session_free(result_history_session_t *session){
+    for(unsigned i = 0; i < RESULT_HISTORY_PAYLOAD_MAX; i++){
+        free(session->payloads[i]);
+        session->payloads[i] = NULL;
+        session->payload_sizes[i] = 0;
+    }
+}
+
+/**
+ * @brief Drops reference to committed session and frees it when it was the last one. Call with history locked.
+ *
+ * @param entry
+ */
+static void entry_release(session_entry_t *entry){
+    if(--entry->refs == 0){
+        session_free(&entry->session);
+        free(entry);
+    }
+}
+
+void result_history_init(){
+    if(lock == NULL){
+        lock = xSemaphoreCreateMutex();
+    }
+}
+
+void result_history_begin(const result_history_meta_t *meta){
+    if(pending_active){
+        session_free(&pending);
+    }
+    memset(&pending, 0, sizeof(pending));
+    pending.meta = *meta;
+    pending.meta.flags = 0;
+    pending_active = true;
+}
+
+result_history_meta_t *result_history_pending_meta(){
+    return pending_active ? &pending.meta : NULL;
+}
+
+esp_err_t result_history_append(result_history_payload_t payload, const void *data, unsigned length){
+    if(!pending_active || (payload >= RESULT_HISTORY_PAYLOAD_MAX)){
+        return ESP_ERR_INVALID_STATE;
+    }
+    if(pending.meta.flags & RESULT_HISTORY_MISSING(payload)){
+        return ESP_ERR_NO_MEM;
+    }
+    if(length == 0){
+        return ESP_OK;
+    }
+    uint8_t *reallocated = NULL;
+    if(session_size(&pending) + length > CONFIG_RESULT_HISTORY_MEMORY_BUDGET){
+        ESP_LOGW(TAG, "Session exceeds memory budget, payload %d dropped", payload);
+    }
+    else {
+        reallocated = realloc(pending.payloads[payload], pending.payload_sizes[payload] + length);
+        if(reallocated == NULL){
+            ESP_LOGE(TAG, "Error reallocating payload %d, payload dropped", payload);
+        }
+    }
+    if(reallocated == NULL){
+        // part of payload is useless (e.g. PCAP cut in the middle of record), so whole payload is dropped
+        free(pending.payloads[payload]);
+        pending.payloads[payload] = NULL;
+        pending.payload_sizes[payload] = 0;
+        pending.meta.flags |= RESULT_HISTORY_MISSING(payload);
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(&reallocated[pending.payload_sizes[payload]], data, length);
+    pending.payloads[payload] = reallocated;
+    pending.payload_sizes[payload] += length;
+    return ESP_OK;
+}
+
+uint16_t result_history_commit(){
+    if(!pending_active){
+        return 0;
+    }
+    pending_active = false;
+    session_entry_t *entry = malloc(sizeof(session_entry_t));
+    if(entry == NULL){
+        ESP_LOGE(TAG, "Error allocating session!");
+        session_free(&pending);
+        return 0;
+    }
+    unsigned size = session_size(&pending);
+    xSemaphoreTake(lock, portMAX_DELAY);
+    while((sessions_count > 0) && ((sessions_count >= CONFIG_RESULT_HISTORY_MAX_SESSIONS) || (used_bytes + size > CONFIG_RESULT_HISTORY_MEMORY_BUDGET))){
+        ESP_LOGD(TAG, "Evicting session %u", sessions[0]->session.meta.id);
+        used_bytes -= session_size(&sessions[0]->session);
+        // session acquired by reader is freed by the last result_history_release()
+        entry_release(sessions[0]);
+        sessions_count--;
+        memmove(&sessions[0], &sessions[1], sessions_count * sizeof(session_entry_t *));
+    }
+    pending.meta.id = next_id;
+    next_id = (next_id == UINT16_MAX) ? 1 : next_id + 1;
+    entry->session = pending;
+    entry->refs = 1;
+    sessions[sessions_count++] = entry;
+    used_bytes += size;
+    xSemaphoreGive(lock);
+
+    ESP_LOGI(TAG, "Session %u saved (%u B, %u/%u B used)", pending.meta.id, size, used_bytes, CONFIG_RESULT_HISTORY_MEMORY_BUDGET);
+    return pending.meta.id;
+}
+
+void result_history_lock(){
+    xSemaphoreTake(lock, portMAX_DELAY);
+}
+
+void result_history_unlock(){
+    xSemaphoreGive(lock);
+}
+
+unsigned result_history_count(){
+    return sessions_count;
+}
+
+const result_history_session_t *result_history_get(unsigned index){
+    if(index >= sessions_count){
+        return NULL;
+    }
+    return &sessions[sessions_count - 1 - index]->session;
+}
+
+const result_history_session_t *result_history_find(uint16_t id){
+    for(unsigned i = 0; i < sessions_count; i++){
+        if(sessions[i]->session.meta.id == id){
+            return &sessions[i]->session;
+        }
+    }
+    return NULL;
+}
+
+const result_history_session_t *result_history_acquire(uint16_t id){
+    xSemaphoreTake(lock, portMAX_DELAY);
+    const result_history_session_t *session = result_history_find(id);
+    if(session != NULL){
+        ((session_entry_t *) session)->refs++;
+    }
+    xSemaphoreGive(lock);
+    return session;
+}
+
+void result_history_release(const result_history_session_t *session){
+    if(session == NULL){
+        return;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    entry_release((session_entry_t *) session);
+    xSemaphoreGive(lock);
+}
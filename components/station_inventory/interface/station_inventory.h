@@ -0,0 +1,95 @@
+/**
+ * @file station_inventory.h
+ * @brief Provides interface for inventory of stations (clients) seen in target BSS
+ */
+#ifndef STATION_INVENTORY_H
+#define STATION_INVENTORY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "mac_address.h"
+
+/**
+ * @brief Single station record
+ */
+typedef struct {
+    mac_t mac;              ///< MAC address of station
+    uint8_t bssid[6];       ///< BSSID station is associated with
+    int16_t rssi_ewma;      ///< exponentially weighted moving average of RSSI in 1/16 dBm, valid if rssi_known
+    bool rssi_known;        ///< frame transmitted by station was seen, RSSI of frames sent to station is AP's
+    uint32_t frames;        ///< number of frames from/to station
+    uint32_t bytes;         ///< number of bytes from/to station
+    uint32_t first_seen;    ///< time of first frame in ms since boot
+    uint32_t last_seen;     ///< time of last frame in ms since boot
+    bool eapol_seen;        ///< EAPoL frame from/to this station was observed
+} station_entry_t;
+
+/**
+ * @brief Clears all stations from inventory.
+ */
+void station_inventory_reset();
+
+/**
+ * @brief Updates inventory with frame that was sent from or to the station.
+ * 
+ * Station is added into inventory if it's not there yet and there is still space.
+ * 
+ * @param mac_sta MAC address of station
+ * @param bssid BSSID of the frame
+ * @param rssi RSSI of the frame
+ * @param rssi_valid true if station is the transmitter of the frame, so RSSI belongs to the station
+ * @param size size of the frame in bytes
+ * @param eapol true if frame carries EAPoL packet
+ */
+void station_inventory_update(const uint8_t *mac_sta, const uint8_t *bssid, int8_t rssi, bool rssi_valid, unsigned size, bool eapol);
+
+/**
+ * @brief Returns number of stations in inventory
+ * 
+ * @return unsigned 
+ */
+unsigned station_inventory_count();
+
+/**
+ * @brief Returns capacity of inventory. Use this as upper bound for station_inventory_get().
+ * 
+ * @return unsigned 
+ */
+unsigned station_inventory_capacity();
+
+/**
+ * @brief Copies station in given slot of inventory.
+ * 
+ * Inventory is updated concurrently, so station is copied out under lock instead of returning pointer into inventory.
+ * 
+ * @param slot slot index in range 0 to station_inventory_capacity() - 1
+ * @param station output copy of station
+ * @return true if slot holds station
+ * @return false if slot is empty
+ */
+bool station_inventory_get(unsigned slot, station_entry_t *station);
+
+/**
+ * @brief Copies station with the strongest average signal
+ * 
+ * Stations that were seen only as receivers have unknown RSSI and are not ranked.
+ * 
+ * @param station output copy of station
+ * @return true if station was found
+ * @return false if no station with known RSSI is in inventory
+ */
+bool station_inventory_get_strongest(station_entry_t *station);
+
+/**
+ * @brief Returns RSSI of station in dBm
+ * 
+ * @param station 
+ * @return int8_t 0 if RSSI is not known yet
+ */
+static inline int8_t station_inventory_rssi(const station_entry_t *station){
+    // rounds to nearest dBm
+    return station->rssi_known ? (station->rssi_ewma + ((station->rssi_ewma < 0) ? -8 : 8)) / 16 : 0;
+}
+
+#endif
@@ -0,0 +1,113 @@
+/**
+ * @file station_inventory.c
+ * @brief Implements station inventory on top of fixed-capacity MAC map
+ */
+#include "station_inventory.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#define LOG_LOCAL_LEVEL CONFIG_STATION_INVENTORY_LOG_LEVEL
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+static const char *TAG = "station_inventory";
+
+/**
+ * @brief Weight of new RSSI sample is 1/STATION_RSSI_EWMA_DIVISOR
+ */
+#define STATION_RSSI_EWMA_DIVISOR 8
+
+MAC_MAP_DEFINE(stations, station_entry_t, CONFIG_STATION_INVENTORY_SIZE);
+/**
+ * @brief Guards stations. Updates come from event loop, reset from orchestrator and reads from httpd and display UI.
+ */
+static portMUX_TYPE stations_lock = portMUX_INITIALIZER_UNLOCKED;
+
+void station_inventory_reset(){
+    portENTER_CRITICAL(&stations_lock);
+    mac_map_clear(&stations);
+    portEXIT_CRITICAL(&stations_lock);
+}
+
+void station_inventory_update(const uint8_t *mac_sta, const uint8_t *bssid, int8_t rssi, bool rssi_valid, unsigned size, bool eapol){
+    mac_t mac = mac_load(mac_sta);
+    if(mac_is_group(mac) || mac_is_zero(mac)){
+        return;
+    }
+    uint32_t now = esp_timer_get_time() / 1000;
+    bool created;
+    portENTER_CRITICAL(&stations_lock);
+    station_entry_t *station = mac_map_get_or_insert(&stations, mac, &created);
+    if(station == NULL){
+        // Inventory full
+        portEXIT_CRITICAL(&stations_lock);
+        return;
+    }
+
+    if(created){
+        station->mac = mac;
+        memcpy(station->bssid, bssid, 6);
+        station->rssi_known = false;
+        station->first_seen = now;
+    }
+    if(rssi_valid){
+        if(station->rssi_known){
+            // difference is mostly negative, so it's divided (rounding to nearest) rather than shifted
+            int32_t delta = (rssi * 16) - station->rssi_ewma;
+            station->rssi_ewma += (delta + ((delta < 0) ? -STATION_RSSI_EWMA_DIVISOR / 2 : STATION_RSSI_EWMA_DIVISOR / 2)) / STATION_RSSI_EWMA_DIVISOR;
+        } else {
+            // average starts from the first frame transmitted by station
+            station->rssi_ewma = rssi * 16;
+            station->rssi_known = true;
+        }
+    }
+
+    station->frames++;
+    station->bytes += size;
+    station->last_seen = now;
+    station->eapol_seen |= eapol;
+    portEXIT_CRITICAL(&stations_lock);
+    if(created){
+        ESP_LOGD(TAG, "New station %02x:%02x:%02x:%02x:%02x:%02x", 
+            mac_sta[0], mac_sta[1], mac_sta[2], mac_sta[3], mac_sta[4], mac_sta[5]);
+    }
+}
+
+unsigned station_inventory_count(){
+    return stations.count;
+}
+
+unsigned station_inventory_capacity(){
+    return stations.capacity;
+}
+
+bool station_inventory_get(unsigned slot, station_entry_t *station){
+    portENTER_CRITICAL(&stations_lock);
+    const station_entry_t *entry = mac_map_at(&stations, slot, NULL);
+    if(entry != NULL){
+        *station = *entry;
+    }
+    portEXIT_CRITICAL(&stations_lock);
+    return entry != NULL;
+}
+
+bool station_inventory_get_strongest(station_entry_t *station){
+    const station_entry_t *strongest = NULL;
+    portENTER_CRITICAL(&stations_lock);
+    for(unsigned i = 0; i < stations.capacity; i++){
+        const station_entry_t *entry = mac_map_at(&stations, i, NULL);
+        if((entry == NULL) || !entry->rssi_known){
+            continue;
+        }
+        if((strongest == NULL) || (entry->rssi_ewma > strongest->rssi_ewma)){
+            strongest = entry;
+        }
+    }
+    if(strongest != NULL){
+        *station = *strongest;
+    }
+    portEXIT_CRITICAL(&stations_lock);
+    return strongest != NULL;
+}
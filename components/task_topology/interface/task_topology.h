@@ -0,0 +1,83 @@
+/**
+ * @file task_topology.h
+ * @brief Defines placement, priorities and stack sizes of all tasks in one place
+ *
+ * Capture pipeline runs on PRO CPU (core 0):
+ * | Task              | Priority | Work                                                        |
+ * |-------------------|----------|-------------------------------------------------------------|
+ * | wifi              | 23       | promiscuous callback, capture filter, post to event loop    |
+ * | esp_timer         | 22       | attack timeout, deauth and PMKID rotation timers            |
+ * | sys_evt           | 20       | frame analysis, handshake/PMKID handlers, PCAP/HCCAPX append |
+ *
+ * These tasks are created by ESP-IDF. Wi-Fi task core is set by CONFIG_ESP32_WIFI_TASK_PINNED_TO_CORE_0,
+ * default event loop and esp_timer tasks are always pinned to PRO CPU.
+ *
+ * Application tasks run on APP CPU (core 1) if CONFIG_TASK_TOPOLOGY_PIN_APPLICATION is set:
+ * | Task              | Priority                                  | Work                                   |
+ * |-------------------|-------------------------------------------|----------------------------------------|
+ * | attack            | CONFIG_TASK_TOPOLOGY_ATTACK_PRIORITY      | attack lifecycle, Wi-Fi control calls  |
+ * | httpd             | CONFIG_TASK_TOPOLOGY_HTTPD_PRIORITY       | HTTP requests, serialization, gzip     |
+ * | display_ui        | CONFIG_TASK_TOPOLOGY_DISPLAY_UI_PRIORITY  | buttons, menu state, drawing frames    |
+ * | display           | CONFIG_TASK_TOPOLOGY_DISPLAY_PRIORITY     | I2C flushes of the latest frame        |
+ */
+#ifndef TASK_TOPOLOGY_H
+#define TASK_TOPOLOGY_H
+
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+
+#if defined(CONFIG_ESP32_WIFI_TASK_PINNED_TO_CORE_1) && !defined(CONFIG_FREERTOS_UNICORE)
+#warning "Wi-Fi task is pinned to APP CPU, capture pipeline will share core with application tasks"
+#endif
+
+/**
+ * @brief Core of capture pipeline (Wi-Fi task, default event loop)
+ */
+#define TASK_TOPOLOGY_CAPTURE_CORE 0
+
+/**
+ * @brief Core of application tasks (HTTP server, display UI)
+ */
+#ifdef CONFIG_TASK_TOPOLOGY_PIN_APPLICATION
+#define TASK_TOPOLOGY_APPLICATION_CORE 1
+#else
+#define TASK_TOPOLOGY_APPLICATION_CORE tskNO_AFFINITY
+#endif
+
+/**
+ * @brief Attack orchestrator task
+ * @{
+ */
+#define TASK_TOPOLOGY_ATTACK_CORE TASK_TOPOLOGY_APPLICATION_CORE
+#define TASK_TOPOLOGY_ATTACK_PRIORITY CONFIG_TASK_TOPOLOGY_ATTACK_PRIORITY
+#define TASK_TOPOLOGY_ATTACK_STACK_SIZE CONFIG_TASK_TOPOLOGY_ATTACK_STACK_SIZE
+//@}
+
+/**
+ * @brief HTTP server task
+ * @{
+ */
+#define TASK_TOPOLOGY_HTTPD_CORE TASK_TOPOLOGY_APPLICATION_CORE
+#define TASK_TOPOLOGY_HTTPD_PRIORITY CONFIG_TASK_TOPOLOGY_HTTPD_PRIORITY
+#define TASK_TOPOLOGY_HTTPD_STACK_SIZE CONFIG_TASK_TOPOLOGY_HTTPD_STACK_SIZE
+//@}
+
+/**
+ * @brief Display UI task
+ * @{
+ */
+#define TASK_TOPOLOGY_DISPLAY_UI_CORE TASK_TOPOLOGY_APPLICATION_CORE
+#define TASK_TOPOLOGY_DISPLAY_UI_PRIORITY CONFIG_TASK_TOPOLOGY_DISPLAY_UI_PRIORITY
+#define TASK_TOPOLOGY_DISPLAY_UI_STACK_SIZE CONFIG_TASK_TOPOLOGY_DISPLAY_UI_STACK_SIZE
+//@}
+
+/**
+ * @brief Display flush task
+ * @{
+ */
+#define TASK_TOPOLOGY_DISPLAY_CORE TASK_TOPOLOGY_APPLICATION_CORE
+#define TASK_TOPOLOGY_DISPLAY_PRIORITY CONFIG_TASK_TOPOLOGY_DISPLAY_PRIORITY
+#define TASK_TOPOLOGY_DISPLAY_STACK_SIZE CONFIG_TASK_TOPOLOGY_DISPLAY_STACK_SIZE
+//@}
+
+#endif
@@ -3,289 +3,423 @@
 
 // This file was generated using xxd
 unsigned char page_index[] = {
-  0X1F, 0X8B, 0X08, 0X08, 0X17, 0X11, 0X2B, 0X61, 0X02, 0X03, 0X69, 0X6E,
-  0X64, 0X65, 0X78, 0X2E, 0X68, 0X74, 0X6D, 0X6C, 0X00, 0XC5, 0X1B, 0X6B,
-  0X53, 0XE3, 0XB6, 0XF6, 0X7B, 0X7F, 0X85, 0XEA, 0X3B, 0X77, 0XEA, 0X14,
-  0XE2, 0X24, 0XEC, 0X2E, 0XD3, 0X86, 0X24, 0X33, 0X21, 0XA4, 0X85, 0X59,
-  0X08, 0X0C, 0X09, 0X6D, 0X77, 0XF6, 0XEE, 0X64, 0X9C, 0X58, 0XC1, 0X2E,
-  0X8E, 0XED, 0XDA, 0X32, 0X90, 0XBB, 0XC3, 0X7F, 0XBF, 0X47, 0X92, 0X1F,
-  0X92, 0X2D, 0X07, 0X87, 0X85, 0XBD, 0X3B, 0XD3, 0X12, 0X4B, 0X47, 0XE7,
-  0XA5, 0XA3, 0XF3, 0X92, 0XDD, 0XFB, 0XF1, 0XE4, 0X72, 0X34, 0XFB, 0X74,
-  0X35, 0X46, 0X36, 0X59, 0XBB, 0X83, 0X1F, 0X7A, 0XE9, 0X1F, 0X6C, 0X5A,
-  0X83, 0X1F, 0X10, 0XFC, 0XEB, 0XAD, 0X31, 0X31, 0X91, 0X67, 0XAE, 0X71,
-  0X5F, 0XBB, 0X77, 0XF0, 0X43, 0XE0, 0X87, 0X44, 0X43, 0X4B, 0XDF, 0X23,
-  0XD8, 0X23, 0X7D, 0XED, 0XC1, 0XB1, 0X88, 0XDD, 0XB7, 0XF0, 0XBD, 0XB3,
-  0XC4, 0X4D, 0XF6, 0XB0, 0XEF, 0X78, 0X0E, 0X71, 0X4C, 0XB7, 0X19, 0X2D,
-  0X4D, 0X17, 0XF7, 0X3B, 0X5A, 0X82, 0X87, 0X38, 0XC4, 0XC5, 0X83, 0XF1,
-  0XF4, 0XEA, 0XDD, 0X01, 0XBA, 0X30, 0X3D, 0XF3, 0X16, 0XAF, 0X01, 0X03,
-  0X1A, 0X5E, 0XF5, 0X5A, 0X7C, 0X8A, 0X83, 0X45, 0X64, 0X93, 0XFE, 0XA6,
-  0XFF, 0X16, 0XBE, 0XB5, 0X41, 0X5F, 0XB3, 0X47, 0XFA, 0X8F, 0X51, 0XE9,
-  0XA2, 0X95, 0X43, 0X9A, 0X09, 0X1B, 0X47, 0XD9, 0XFC, 0X53, 0XF6, 0X8B,
-  0X98, 0X0B, 0X17, 0XEF, 0X23, 0X12, 0XC2, 0X7F, 0X76, 0X01, 0XC3, 0XC2,
-  0X0F, 0X2D, 0X1C, 0X76, 0X51, 0X27, 0X78, 0X44, 0X91, 0XEF, 0X3A, 0XD6,
-  0X91, 0X62, 0X1A, 0X90, 0XBB, 0XAE, 0X19, 0X44, 0XB8, 0X8B, 0XD2, 0X5F,
-  0X32, 0X18, 0XC1, 0X8F, 0XA4, 0X69, 0XBA, 0XCE, 0XAD, 0X07, 0X10, 0XC0,
-  0X05, 0X0E, 0X95, 0X7C, 0XD8, 0XC0, 0X80, 0X55, 0X60, 0X20, 0X30, 0X2D,
-  0XCB, 0XF1, 0X6E, 0XBB, 0X9D, 0X76, 0XF0, 0XA8, 0X5C, 0X14, 0X76, 0X6D,
-  0XFF, 0X1E, 0X53, 0XDE, 0X43, 0X23, 0XC2, 0X2E, 0X5E, 0X12, 0X5C, 0XC4,
-  0XB1, 0X30, 0X97, 0X77, 0XB7, 0XA1, 0X1F, 0X7B, 0X16, 0XE5, 0XD4, 0X07,
-  0X71, 0X80, 0X15, 0X9B, 0X2C, 0XDC, 0XB8, 0XC0, 0XE7, 0X32, 0X0E, 0X23,
-  0X98, 0X0E, 0X7C, 0X47, 0XC5, 0X63, 0XAF, 0X95, 0X68, 0XBC, 0XD7, 0XE2,
-  0X9B, 0XDE, 0X63, 0X2A, 0XF7, 0XBD, 0X73, 0XDF, 0XB4, 0XFA, 0XDA, 0X2D,
-  0X26, 0X53, 0X62, 0X92, 0X38, 0XD2, 0X1B, 0XE9, 0X46, 0XDA, 0X9D, 0X64,
-  0X17, 0XFF, 0X74, 0X9A, 0XBF, 0X39, 0XE8, 0X0A, 0X7B, 0X98, 0X84, 0X26,
-  0X71, 0X7C, 0X0F, 0XCD, 0X7C, 0XDF, 0X05, 0X3C, 0X9D, 0X74, 0X2F, 0X81,
-  0X6F, 0X3A, 0XEC, 0X00, 0X22, 0X1C, 0X86, 0X7E, 0X18, 0X69, 0X03, 0XA0,
-  0XC7, 0X47, 0X15, 0X30, 0X2E, 0X90, 0X04, 0XB5, 0X68, 0X83, 0X73, 0XFE,
-  0XC3, 0X30, 0X0C, 0X74, 0XE5, 0X62, 0X33, 0XC2, 0XE8, 0XC1, 0X74, 0XC8,
-  0XB6, 0XA5, 0X21, 0XF0, 0XBE, 0XD1, 0X10, 0X93, 0XA5, 0XAF, 0X59, 0X4E,
-  0X14, 0XB8, 0XE6, 0XA6, 0X8B, 0X3C, 0XDF, 0XC3, 0X47, 0X5A, 0X6E, 0X4E,
-  0X3D, 0XFB, 0X60, 0X30, 0X24, 0X04, 0X54, 0X47, 0X4D, 0X78, 0XE5, 0XDC,
-  0XC6, 0X9C, 0X73, 0X60, 0XFA, 0X40, 0X80, 0X5A, 0XF9, 0XE1, 0X1A, 0X54,
-  0X30, 0X8D, 0X17, 0X6B, 0X07, 0X8C, 0X3C, 0X8C, 0X3D, 0XBE, 0X48, 0X6F,
-  0X1C, 0XA1, 0X10, 0X93, 0X38, 0XF4, 0XD0, 0XCA, 0X74, 0X23, 0X09, 0X35,
-  0X5F, 0XE8, 0X60, 0XD7, 0X8A, 0X30, 0X91, 0X87, 0XD9, 0X94, 0X8B, 0X6F,
-  0XB1, 0X67, 0X0D, 0XA6, 0X6C, 0X37, 0XC1, 0X3C, 0X43, 0X50, 0X6D, 0XAF,
-  0X95, 0X8C, 0X96, 0XC1, 0X99, 0XFD, 0X32, 0XD1, 0XCC, 0XA0, 0XE9, 0X3A,
-  0X11, 0XA1, 0XAA, 0X63, 0X83, 0X0A, 0XE0, 0XA0, 0X3C, 0XC6, 0XC6, 0X17,
-  0X31, 0X21, 0XA0, 0X20, 0XB2, 0X09, 0X40, 0X29, 0XFC, 0X41, 0X03, 0XB9,
-  0X46, 0XAE, 0XB3, 0XBC, 0XA3, 0X3A, 0X5B, 0X85, 0X38, 0XB2, 0X87, 0X01,
-  0XDB, 0XDC, 0X6B, 0XFE, 0XD4, 0X6B, 0X71, 0X38, 0X05, 0X95, 0X56, 0X81,
-  0X4C, 0XAF, 0XA5, 0X16, 0XB7, 0X86, 0X16, 0XD4, 0X7B, 0X50, 0XA9, 0X8C,
-  0X2A, 0XF9, 0X5C, 0X73, 0X81, 0X5D, 0X04, 0XBB, 0X05, 0X5A, 0X62, 0X18,
-  0XE7, 0X54, 0X54, 0X2D, 0X45, 0X4F, 0X1F, 0XBA, 0X80, 0X96, 0X42, 0X55,
-  0X60, 0XE0, 0X87, 0X8B, 0XEB, 0X59, 0XC0, 0X40, 0X95, 0X64, 0X9B, 0XDE,
-  0X2D, 0XA8, 0X2D, 0X0E, 0X2C, 0X93, 0XE0, 0X51, 0XCA, 0X29, 0X6C, 0XC0,
-  0X6F, 0X4C, 0X3C, 0X9D, 0XD8, 0X4E, 0XD4, 0XD0, 0XC0, 0X1E, 0XFE, 0X89,
-  0X9D, 0X10, 0X5B, 0X6A, 0X02, 0X8C, 0X88, 0X1F, 0X30, 0X3B, 0XBD, 0X37,
-  0XE1, 0X6C, 0XF6, 0XB5, 0XB6, 0X86, 0X98, 0XC3, 0XEB, 0X6B, 0X33, 0XC0,
-  0XC0, 0X98, 0X44, 0XF0, 0XD7, 0XF3, 0X81, 0X8D, 0X75, 0XE0, 0X32, 0XB7,
-  0X08, 0XA7, 0X7D, 0X83, 0X89, 0XA1, 0X21, 0XB0, 0X64, 0X4A, 0X12, 0X34,
-  0X36, 0X9B, 0X0D, 0X47, 0X1F, 0XE7, 0XD4, 0X57, 0XCF, 0XAF, 0X86, 0XD3,
-  0XE9, 0XD9, 0X1F, 0XE3, 0X5E, 0X8B, 0X23, 0XAE, 0X4D, 0X19, 0X7C, 0XB1,
-  0X88, 0XE6, 0X74, 0X38, 0X39, 0X99, 0X9E, 0X0E, 0X3F, 0XEE, 0X8E, 0XE8,
-  0X00, 0X4E, 0X5A, 0XE2, 0X95, 0X64, 0XC6, 0X2E, 0X3E, 0X9E, 0X9D, 0XEC,
-  0X8C, 0XED, 0X9D, 0XCC, 0XD6, 0XC9, 0XE5, 0X74, 0X3B, 0X0A, 0XEA, 0X07,
-  0X28, 0XF1, 0X1A, 0X26, 0XBA, 0XA3, 0XF5, 0X40, 0XAC, 0XB3, 0X7D, 0X2B,
-  0XB3, 0X1F, 0XFE, 0XB8, 0XB3, 0X05, 0X25, 0X58, 0X32, 0XCB, 0XC8, 0X37,
-  0XB1, 0XAE, 0X46, 0X72, 0XF5, 0X66, 0X6B, 0X91, 0XED, 0X58, 0X16, 0XF6,
-  0X06, 0X93, 0XCB, 0X19, 0X1A, 0XFE, 0X31, 0X3C, 0X3B, 0X1F, 0X1E, 0X9F,
-  0X8F, 0XFF, 0X5F, 0X7A, 0X22, 0XCE, 0X1A, 0XFB, 0X31, 0XC9, 0X0F, 0X1A,
-  0X7F, 0X46, 0X3A, 0XB8, 0X64, 0XDF, 0XB3, 0XA2, 0XC6, 0X33, 0X3A, 0X73,
-  0XBC, 0X00, 0XA0, 0XB9, 0X5B, 0XF2, 0XE2, 0XF5, 0X02, 0X87, 0X1A, 0X5A,
-  0X3B, 0X1E, 0X3B, 0X1B, 0X6B, 0XF3, 0X11, 0X0C, 0XEC, 0XC3, 0X07, 0X4D,
-  0X3A, 0X94, 0X09, 0XC1, 0X5C, 0X41, 0XA9, 0X72, 0X5B, 0XDF, 0X2A, 0X5D,
-  0XE2, 0XEE, 0XB8, 0X24, 0XDF, 0XE8, 0XFD, 0X60, 0X0C, 0X22, 0XC7, 0X20,
-  0X0D, 0XAC, 0XD5, 0XD1, 0X2A, 0XF6, 0X3C, 0X1A, 0XE8, 0X9E, 0X8D, 0X57,
-  0X33, 0X90, 0X1B, 0X61, 0X96, 0X7C, 0X58, 0X5D, 0XC0, 0X11, 0X98, 0X12,
-  0X82, 0X66, 0X10, 0XFA, 0XB7, 0XE0, 0XB5, 0X79, 0X5C, 0X85, 0XC9, 0X1A,
-  0XA4, 0X71, 0X14, 0XBB, 0XA4, 0X46, 0XA4, 0XB4, 0X9C, 0X7B, 0X61, 0X41,
-  0X93, 0XA6, 0X81, 0X59, 0X60, 0X46, 0X7C, 0XB0, 0X18, 0X9E, 0X61, 0X49,
-  0X35, 0X82, 0X24, 0X57, 0XA3, 0X9C, 0XCA, 0X70, 0XCF, 0X05, 0X29, 0XD0,
-  0X70, 0X1A, 0X7D, 0XB5, 0XC1, 0X04, 0X3F, 0X20, 0X53, 0XB1, 0X55, 0X25,
-  0X91, 0X97, 0XA1, 0X13, 0X24, 0X3B, 0X73, 0X6F, 0X86, 0X88, 0X63, 0XA0,
-  0XA9, 0X0C, 0X1E, 0X83, 0XC5, 0XA1, 0X3E, 0XFA, 0X8A, 0XAE, 0XC7, 0XC3,
-  0X93, 0X4F, 0X5D, 0XD4, 0XDE, 0X47, 0XD7, 0X37, 0X93, 0XC9, 0XD9, 0XE4,
-  0X77, 0XC8, 0X08, 0XF7, 0XD1, 0X6F, 0X67, 0X93, 0XB3, 0XE9, 0XE9, 0XF8,
-  0XA4, 0X8B, 0X0E, 0XF6, 0XD1, 0XEC, 0XEC, 0X62, 0X7C, 0X79, 0X33, 0XEB,
-  0XA2, 0X77, 0X4F, 0X47, 0X05, 0X5C, 0X33, 0XE0, 0X37, 0X43, 0XA5, 0XF0,
-  0XCE, 0X0C, 0XB1, 0XD2, 0XDD, 0X32, 0X32, 0X25, 0XB7, 0XC9, 0XE8, 0X15,
-  0XFC, 0XA0, 0X4C, 0X37, 0XF5, 0X09, 0XC3, 0X60, 0XCC, 0XA3, 0X04, 0X90,
-  0X6E, 0X76, 0XF2, 0XF9, 0X00, 0XD2, 0X54, 0XF9, 0X69, 0XCE, 0X52, 0X3E,
-  0X38, 0X33, 0X00, 0XD9, 0X69, 0XB7, 0XDB, 0XF9, 0X6C, 0X62, 0X40, 0X73,
-  0X79, 0X8D, 0X38, 0X5A, 0XBD, 0X56, 0X3E, 0X93, 0X30, 0X2D, 0XCC, 0XD1,
-  0XC1, 0X79, 0X62, 0XB0, 0XF2, 0X8C, 0X85, 0X57, 0X26, 0XD8, 0XC1, 0X35,
-  0XB3, 0X86, 0X11, 0X37, 0X06, 0X80, 0XB0, 0XFC, 0X65, 0X4C, 0X65, 0X31,
-  0X20, 0X1D, 0X4A, 0XC4, 0X3A, 0XDE, 0X9C, 0X59, 0X7A, 0X6A, 0XA8, 0X0D,
-  0XC3, 0XF1, 0X3C, 0X1C, 0X9E, 0XCE, 0X2E, 0XCE, 0X4B, 0XB8, 0XF8, 0X46,
-  0X5C, 0X30, 0X77, 0X1B, 0X6D, 0XC3, 0X25, 0X3B, 0XE6, 0X86, 0X01, 0X6C,
-  0X8B, 0X28, 0X57, 0XB1, 0XC7, 0X0F, 0X88, 0X90, 0XED, 0X0A, 0XD9, 0X36,
-  0XA5, 0XE8, 0X5F, 0XE3, 0X7F, 0X80, 0X82, 0X07, 0XE6, 0XF7, 0XD7, 0XC5,
-  0XF9, 0X29, 0X21, 0X01, 0X0C, 0XC4, 0X38, 0X22, 0X90, 0X12, 0X66, 0X80,
-  0X14, 0XC8, 0XF0, 0X3D, 0X9A, 0XC6, 0X02, 0X6C, 0X8A, 0X55, 0XC2, 0X95,
-  0XE9, 0X30, 0X0C, 0XCD, 0XCD, 0X71, 0XBC, 0X5A, 0XE1, 0X10, 0X40, 0XD9,
-  0X42, 0X10, 0X38, 0XF0, 0XBD, 0X62, 0X95, 0XE1, 0XAC, 0X74, 0X01, 0XB6,
-  0X88, 0XAA, 0XB0, 0X25, 0X11, 0XB5, 0X6F, 0XC0, 0X17, 0X98, 0X61, 0X84,
-  0XCF, 0X3C, 0XA2, 0X53, 0X7E, 0X6F, 0X60, 0X23, 0X7F, 0X19, 0X52, 0X1C,
-  0X22, 0XA6, 0X7D, 0X6A, 0X9E, 0X9D, 0X46, 0XE3, 0X68, 0X1B, 0X3E, 0X96,
-  0X9B, 0XD4, 0X44, 0XD7, 0X79, 0X1E, 0X5D, 0XE2, 0X02, 0XE6, 0X91, 0XF3,
-  0X5F, 0X25, 0XDA, 0XCE, 0XA1, 0X02, 0XEF, 0X41, 0X6D, 0XBC, 0XC9, 0XFE,
-  0X54, 0X31, 0XF8, 0X5E, 0X81, 0X04, 0X56, 0X42, 0X01, 0X88, 0X0D, 0XD7,
-  0XBF, 0XCD, 0XAC, 0X84, 0X29, 0XB1, 0XAF, 0XA1, 0X3D, 0X59, 0XAB, 0X7B,
-  0X48, 0X3B, 0X12, 0XF5, 0X22, 0X42, 0X30, 0X3D, 0X89, 0X00, 0X4B, 0XA8,
-  0XCB, 0XB8, 0X9C, 0X22, 0X98, 0X28, 0X7F, 0X85, 0X44, 0X11, 0X33, 0X3F,
-  0X90, 0X44, 0X1B, 0X5F, 0X5F, 0X5F, 0X5E, 0X77, 0XD1, 0XC8, 0XF4, 0X68,
-  0X66, 0XC8, 0X74, 0X95, 0XE0, 0X61, 0X40, 0XD8, 0XD0, 0XCA, 0X18, 0X20,
-  0X47, 0XC0, 0X43, 0XD7, 0X9D, 0X72, 0X57, 0X18, 0XE9, 0X0A, 0X22, 0XD1,
-  0X83, 0X43, 0X96, 0XB6, 0X2E, 0X8A, 0XA6, 0X32, 0X2A, 0XA6, 0X1C, 0XEA,
-  0XD9, 0X0B, 0X8E, 0XD3, 0XE0, 0X4E, 0XB3, 0X32, 0X91, 0X89, 0X6C, 0XFF,
-  0X81, 0X2F, 0XE1, 0X19, 0XB3, 0X8A, 0X85, 0XAC, 0X82, 0X85, 0XA2, 0XED,
-  0XEE, 0X68, 0X07, 0XD2, 0X89, 0X97, 0XDE, 0X4A, 0XFC, 0X9A, 0XBB, 0XB0,
-  0X6D, 0X74, 0XA5, 0X4D, 0XBF, 0X02, 0X57, 0XA7, 0X6D, 0X01, 0X86, 0XE8,
-  0X33, 0XE3, 0X8E, 0X4E, 0XCF, 0XBC, 0XC3, 0XBE, 0XEC, 0X5C, 0X5F, 0X51,
-  0XC4, 0X2C, 0XF8, 0X6C, 0X97, 0X91, 0XB9, 0X46, 0X5D, 0X4B, 0XA1, 0XB5,
-  0X7D, 0XD1, 0X10, 0XF7, 0X55, 0XE6, 0X56, 0X1C, 0X7C, 0X45, 0X9E, 0XD3,
-  0X18, 0X59, 0X8B, 0XE5, 0X04, 0XF8, 0XBB, 0X71, 0X9C, 0X44, 0X8A, 0X6A,
-  0XE6, 0X2A, 0X63, 0X46, 0XD2, 0XB0, 0X10, 0XE2, 0X0F, 0X3B, 0X95, 0X74,
-  0X14, 0X25, 0X8D, 0X0A, 0XF1, 0X3C, 0XC6, 0XD1, 0X8F, 0XE8, 0XC6, 0XBB,
-  0XF3, 0XFC, 0X07, 0XAF, 0XFA, 0X7C, 0X3E, 0X95, 0X46, 0X78, 0X37, 0XA1,
-  0X0C, 0XF9, 0X83, 0X7A, 0XD9, 0X53, 0X29, 0XD8, 0X30, 0X36, 0XB7, 0X45,
-  0X1B, 0XC9, 0XDA, 0X93, 0XA0, 0X85, 0XD8, 0XAA, 0XA2, 0XD9, 0XEF, 0XA8,
-  0X8A, 0XC4, 0X33, 0X81, 0XEE, 0X97, 0X36, 0X62, 0X1D, 0X21, 0X03, 0X8D,
-  0X6C, 0X4C, 0XCB, 0X01, 0XDB, 0X24, 0X68, 0XE3, 0XC7, 0X10, 0XE5, 0X30,
-  0XA5, 0XEF, 0XF1, 0X52, 0X86, 0XF8, 0X90, 0XDC, 0X0B, 0X8D, 0X3F, 0X03,
-  0X7D, 0X02, 0X98, 0X35, 0XED, 0X5A, 0XD1, 0XC8, 0X4B, 0X4B, 0X9D, 0X1C,
-  0XD8, 0X8A, 0XC3, 0X5C, 0XC3, 0X45, 0X5D, 0X0A, 0X71, 0XFA, 0X68, 0X8B,
-  0X6E, 0XF2, 0X0C, 0X65, 0X37, 0XED, 0XA4, 0XD5, 0X46, 0XA3, 0X9A, 0XAA,
-  0XB0, 0X43, 0X25, 0XBA, 0X01, 0XF6, 0X74, 0XED, 0XF7, 0X31, 0X35, 0X72,
-  0XCD, 0X86, 0X4C, 0XA1, 0XDB, 0X6A, 0X75, 0X7E, 0X3D, 0X30, 0X3A, 0X87,
-  0XBF, 0X18, 0XEF, 0X8D, 0X4E, 0X8B, 0X5B, 0X8B, 0X46, 0X7B, 0X7B, 0X31,
-  0X2E, 0X66, 0X0F, 0X69, 0X12, 0X30, 0XE3, 0X91, 0X57, 0X63, 0X11, 0X6C,
-  0XC1, 0X22, 0X98, 0X56, 0X00, 0X8D, 0XB0, 0X67, 0XA5, 0XF2, 0X3F, 0XC9,
-  0X79, 0X4C, 0X29, 0X0E, 0XE4, 0X42, 0X43, 0X81, 0XA2, 0XBB, 0XA0, 0XEC,
-  0XB4, 0X26, 0XF0, 0X57, 0XAA, 0X7D, 0X8F, 0X8E, 0X37, 0X33, 0XF3, 0X76,
-  0X62, 0XAE, 0XB1, 0XAE, 0X25, 0X90, 0X5A, 0XA3, 0X21, 0XAB, 0X2E, 0X19,
-  0X37, 0X58, 0X25, 0X61, 0X24, 0X85, 0X04, 0XE5, 0X99, 0X96, 0X12, 0X5A,
-  0X69, 0X5F, 0X0A, 0X2C, 0X4A, 0XBE, 0X3A, 0X47, 0XBC, 0X25, 0X82, 0X55,
-  0X67, 0X8A, 0X49, 0X35, 0XD5, 0X28, 0XB3, 0XB2, 0X70, 0XFD, 0XE5, 0X9D,
-  0XA6, 0X64, 0X80, 0X85, 0XE8, 0XAB, 0XA4, 0X7E, 0X12, 0X59, 0X80, 0X8C,
-  0X4B, 0XCA, 0X62, 0X07, 0XFD, 0X42, 0XC6, 0X5B, 0XD0, 0XC3, 0X8E, 0XC7,
-  0X26, 0XA9, 0X98, 0X42, 0X9C, 0XD8, 0X7A, 0XE9, 0X58, 0X68, 0XBB, 0X9E,
-  0XCA, 0XAD, 0X52, 0X67, 0X86, 0X0E, 0X64, 0XC3, 0XB3, 0X24, 0X62, 0XE9,
-  0X62, 0XA2, 0XDF, 0X50, 0X75, 0XA0, 0X9F, 0X53, 0X76, 0X5E, 0X79, 0XCA,
-  0XE2, 0X49, 0X9A, 0X83, 0X8C, 0XA8, 0X25, 0X66, 0X49, 0XC9, 0X71, 0X84,
-  0XE1, 0X48, 0XE0, 0X4E, 0X5C, 0XB2, 0XB7, 0X57, 0X69, 0X2C, 0X72, 0X56,
-  0XF1, 0XB5, 0X06, 0XA7, 0XAC, 0X25, 0X5C, 0X43, 0X3D, 0X62, 0X1F, 0XB4,
-  0XDA, 0X56, 0X79, 0X00, 0X8B, 0X92, 0X04, 0X60, 0XE7, 0XE8, 0X55, 0XCB,
-  0XC4, 0XE5, 0X4D, 0X2A, 0X6C, 0XCE, 0X0E, 0X95, 0X12, 0XAD, 0X85, 0X14,
-  0XE5, 0XD6, 0X2E, 0XB8, 0X9E, 0XD5, 0XDA, 0X33, 0X28, 0X78, 0XC3, 0X40,
-  0XE6, 0X29, 0X49, 0X6E, 0X61, 0XFF, 0X7B, 0X8B, 0X70, 0X20, 0X9A, 0X40,
-  0XE2, 0XED, 0XB6, 0XE4, 0XBC, 0X14, 0X44, 0X0C, 0X03, 0X72, 0X1E, 0X4B,
-  0X67, 0X4B, 0XAE, 0X3D, 0X4F, 0X56, 0XD2, 0X5A, 0XDD, 0X50, 0XD5, 0XE9,
-  0XA5, 0XD8, 0X9B, 0X72, 0XA3, 0X00, 0X56, 0XC4, 0X74, 0X45, 0XF2, 0XF1,
-  0X1C, 0XE5, 0XBC, 0X13, 0X50, 0X8B, 0X76, 0X06, 0XAE, 0XA0, 0XCE, 0X95,
-  0X7D, 0X6A, 0X7A, 0X56, 0X64, 0X9B, 0X77, 0X58, 0X97, 0XAD, 0X6E, 0XBF,
-  0X66, 0XE5, 0XF1, 0X02, 0X19, 0X78, 0XCF, 0XA2, 0X9E, 0XEE, 0X28, 0X68,
-  0X25, 0XEF, 0X57, 0XEB, 0X3B, 0XC7, 0XFA, 0X7E, 0X7C, 0XD3, 0XAE, 0X4A,
-  0X2D, 0XAE, 0X01, 0XB0, 0XDE, 0X6E, 0X57, 0XA6, 0X98, 0X29, 0XD6, 0X9B,
-  0XC9, 0XC7, 0XC9, 0XE5, 0X9F, 0X13, 0X6D, 0X37, 0X3F, 0X5B, 0X71, 0X8A,
-  0XF6, 0XFA, 0X28, 0XAD, 0X36, 0X85, 0X43, 0X54, 0X70, 0X58, 0XA2, 0X47,
-  0X43, 0X35, 0X5C, 0X65, 0X7A, 0XC5, 0X54, 0X08, 0X55, 0X69, 0XB7, 0X8F,
-  0X5D, 0X75, 0X40, 0X90, 0XDA, 0X20, 0X02, 0X36, 0X86, 0X4C, 0XF4, 0X60,
-  0X3B, 0X2E, 0X6E, 0X18, 0X86, 0X78, 0X20, 0X5F, 0XBB, 0X4B, 0XB2, 0X2B,
-  0XB3, 0X3D, 0X62, 0X0F, 0XE0, 0X8C, 0X9E, 0XF4, 0X5A, 0XF0, 0X83, 0X3E,
-  0X1C, 0X4B, 0X4F, 0XD7, 0XF0, 0XC4, 0X1E, 0X0A, 0X9B, 0XFA, 0X06, 0XCD,
-  0X98, 0XC5, 0X86, 0X60, 0XD6, 0X7F, 0XD8, 0XDA, 0X90, 0X50, 0X98, 0X33,
-  0XE4, 0X66, 0X08, 0XB1, 0XEC, 0XCC, 0X61, 0XBD, 0X33, 0XF8, 0XD3, 0XCB,
-  0XB1, 0X19, 0XF4, 0XD7, 0X39, 0XF6, 0X6E, 0X89, 0X7D, 0XC4, 0X00, 0X1C,
-  0X30, 0X82, 0XF7, 0XED, 0XAA, 0XEA, 0X9D, 0X75, 0XE3, 0X42, 0XB1, 0X2B,
-  0XB6, 0X04, 0XDB, 0X85, 0X9A, 0X8D, 0XEB, 0X52, 0XFF, 0X89, 0X84, 0X3F,
-  0X55, 0XD4, 0X54, 0XEC, 0XD2, 0X99, 0X76, 0XD7, 0X42, 0X67, 0X11, 0X13,
-  0X48, 0X01, 0X1D, 0X0B, 0XD2, 0X55, 0X07, 0XB5, 0X28, 0XB9, 0X9A, 0X4B,
-  0X92, 0X06, 0X2E, 0XCD, 0X81, 0X79, 0XDF, 0X72, 0X18, 0X24, 0X37, 0X66,
-  0X15, 0X18, 0X18, 0XBF, 0XD6, 0X3C, 0X8A, 0X1C, 0X6B, 0X1B, 0XD3, 0XD6,
-  0X4F, 0XDB, 0XD7, 0X87, 0X80, 0XE0, 0X5B, 0XD6, 0X2F, 0X5E, 0XCC, 0X40,
-  0XC2, 0XBC, 0X64, 0X95, 0X74, 0XFB, 0X67, 0XF8, 0X91, 0X9C, 0X40, 0XB6,
-  0X67, 0XE1, 0X50, 0XD7, 0X62, 0XB2, 0X6A, 0XFE, 0X02, 0XA6, 0X6B, 0XB1,
-  0X01, 0X3D, 0XDF, 0XDC, 0X28, 0X5E, 0X30, 0XE3, 0XD0, 0XE9, 0XAE, 0XB6,
-  0XF7, 0XD9, 0XE6, 0XBE, 0X3B, 0X68, 0X54, 0XAB, 0XDB, 0X0C, 0XA0, 0XCE,
-  0XB0, 0X46, 0X70, 0X12, 0X2D, 0X3D, 0X21, 0X5D, 0X01, 0X9C, 0XA6, 0XFC,
-  0X7F, 0X73, 0XA3, 0XFA, 0X1B, 0X8C, 0XEA, 0X10, 0XFE, 0XEC, 0XED, 0X35,
-  0XBE, 0X56, 0X96, 0XC5, 0XA9, 0X26, 0X64, 0XCF, 0X13, 0X53, 0X4B, 0X9E,
-  0XF9, 0XA7, 0XF8, 0X31, 0XE7, 0XFC, 0X33, 0XE3, 0XF4, 0X1D, 0XFC, 0XEF,
-  0XEF, 0X2F, 0X0D, 0XEA, 0X96, 0XBA, 0X9A, 0X9A, 0X8D, 0XA7, 0X9A, 0X92,
-  0X2C, 0XB6, 0X88, 0X92, 0X6C, 0XB0, 0XA4, 0XE3, 0X02, 0X27, 0XBF, 0X7E,
-  0X41, 0X4D, 0X74, 0XF0, 0XE1, 0X43, 0X5D, 0XC5, 0X51, 0X7C, 0X15, 0XD4,
-  0X6A, 0XB8, 0X20, 0X09, 0X99, 0XEA, 0X4C, 0X3F, 0XBD, 0X5E, 0X25, 0XBF,
-  0XAB, 0X47, 0X64, 0XD9, 0X94, 0X76, 0XF4, 0XE2, 0X42, 0X35, 0X45, 0XFB,
-  0X96, 0X95, 0X6A, 0XE6, 0X1B, 0XB0, 0X2B, 0X8A, 0X2B, 0X96, 0XE5, 0XD8,
-  0X35, 0X24, 0X7B, 0X00, 0X27, 0X5C, 0XBE, 0X09, 0XF9, 0X91, 0X5E, 0X85,
-  0X94, 0X0A, 0XD4, 0X02, 0X94, 0XB1, 0X74, 0XCD, 0X28, 0X3A, 0X07, 0X99,
-  0X80, 0XFB, 0XB5, 0X7F, 0XCF, 0X8A, 0X5B, 0X0E, 0XA3, 0X35, 0X14, 0XC1,
-  0XB9, 0X84, 0XA0, 0X8F, 0XDD, 0X9C, 0X0F, 0XE0, 0X2B, 0XC7, 0X67, 0X5A,
-  0X96, 0X88, 0X4C, 0X1D, 0X95, 0XF3, 0XD7, 0X48, 0XD0, 0XD7, 0XED, 0XE2,
-  0XF4, 0X15, 0XE2, 0X48, 0XAD, 0X8A, 0X89, 0X0F, 0X95, 0X62, 0XC6, 0XA0,
-  0X91, 0X64, 0X3C, 0XEC, 0X25, 0X02, 0XC8, 0XB2, 0X43, 0X3A, 0XF6, 0X8D,
-  0XED, 0X9D, 0X3A, 0X14, 0X64, 0X02, 0XC5, 0X5E, 0XD6, 0XD3, 0XF7, 0XA8,
-  0XEA, 0XD5, 0X31, 0X9C, 0XFA, 0XDD, 0X61, 0X3E, 0XA2, 0X8B, 0XBD, 0X7F,
-  0X0A, 0X1D, 0X67, 0X21, 0XB9, 0X6E, 0X8C, 0XCE, 0X57, 0X7C, 0X6E, 0X7F,
-  0X11, 0X2F, 0X2F, 0XCA, 0X56, 0X26, 0X59, 0XAB, 0XB0, 0XAE, 0X23, 0XAD,
-  0X7B, 0XEE, 0XB2, 0X8A, 0XBD, 0X87, 0XD2, 0X30, 0XD8, 0X85, 0XB7, 0X1A,
-  0XDF, 0XC1, 0X4E, 0XF8, 0XB2, 0XCB, 0XAF, 0X2D, 0X18, 0XDF, 0XED, 0XC6,
-  0X61, 0XDA, 0X26, 0X2B, 0XA1, 0XDC, 0X31, 0X17, 0X64, 0X7E, 0XE8, 0XEA,
-  0X72, 0X5A, 0XE5, 0X88, 0XC0, 0X14, 0X9A, 0X9C, 0X66, 0X85, 0X2F, 0X62,
-  0X0E, 0X46, 0XBD, 0X6F, 0XCA, 0X56, 0X61, 0XE9, 0X06, 0XF3, 0X15, 0X64,
-  0X56, 0XDF, 0X7C, 0XB2, 0X73, 0X21, 0X34, 0X5B, 0X68, 0X15, 0X8C, 0X49,
-  0X56, 0XE2, 0X4B, 0X4D, 0XA8, 0X7D, 0XF5, 0XFD, 0X6B, 0X85, 0X33, 0X11,
-  0XEF, 0XC5, 0X6B, 0X35, 0X17, 0XB6, 0X5D, 0XCD, 0XBC, 0X64, 0XC3, 0X4E,
-  0XC7, 0XC3, 0X93, 0XAA, 0X0D, 0XA3, 0XCC, 0X6D, 0XDB, 0XAB, 0X4A, 0X99,
-  0X76, 0X2A, 0X08, 0XE5, 0X2B, 0XDA, 0XB5, 0XB9, 0X9C, 0X9B, 0X01, 0XF5,
-  0X0F, 0X05, 0XD7, 0X40, 0X27, 0XC0, 0X65, 0X29, 0X66, 0X92, 0X5C, 0X4F,
-  0X35, 0X3C, 0XA7, 0XAF, 0X77, 0X2A, 0XE6, 0X02, 0XCA, 0X9D, 0X62, 0XDC,
-  0XF1, 0X2C, 0XFC, 0X28, 0XEF, 0X7B, 0X9A, 0X77, 0X09, 0XC9, 0XFC, 0X61,
-  0X9E, 0XB9, 0X77, 0X8A, 0XE1, 0X3D, 0XE1, 0X5F, 0X4E, 0XB3, 0X64, 0XB1,
-  0X3F, 0X73, 0X2A, 0X7B, 0XC8, 0XF9, 0XA2, 0XEC, 0XDA, 0XA5, 0X4C, 0XA4,
-  0X60, 0X87, 0XDF, 0XC4, 0X0C, 0XD5, 0XD9, 0XF7, 0XE3, 0X46, 0X85, 0XFB,
-  0XCB, 0X16, 0X0E, 0XD9, 0XDE, 0XD5, 0X62, 0XAF, 0X53, 0X64, 0X31, 0X5D,
-  0XCE, 0XF7, 0X18, 0X70, 0X4C, 0X09, 0XBD, 0X6C, 0X30, 0X56, 0XA1, 0XBF,
-  0X1E, 0XD9, 0X66, 0X38, 0XA2, 0XA9, 0X79, 0X5D, 0X64, 0XD5, 0XF2, 0X2A,
-  0X25, 0XA2, 0X28, 0X14, 0X16, 0X35, 0X5F, 0X7A, 0XE4, 0X59, 0XEB, 0X51,
-  0X5D, 0XA3, 0X37, 0X39, 0XB9, 0X2D, 0X8A, 0X82, 0X04, 0X03, 0X8A, 0X8A,
-  0X7F, 0XA3, 0XCE, 0X61, 0X83, 0XE6, 0X15, 0X6D, 0X45, 0XD6, 0XCF, 0X8D,
-  0X7A, 0XAF, 0X5F, 0X6A, 0XCC, 0X29, 0X00, 0X5A, 0XB4, 0X70, 0X19, 0XB0,
-  0X9E, 0X0E, 0XFA, 0X17, 0XED, 0XEE, 0XE6, 0XFC, 0XD3, 0XE4, 0X1F, 0XF5,
-  0XD8, 0X7C, 0X15, 0X0E, 0X0E, 0XD7, 0X17, 0X75, 0X50, 0XCE, 0X92, 0X33,
-  0X6A, 0X2F, 0X36, 0XBD, 0XE7, 0XDA, 0X2A, 0XE9, 0XCB, 0X48, 0X85, 0X9C,
-  0X67, 0X87, 0XF6, 0XA6, 0X0A, 0X03, 0XD5, 0XCF, 0XC5, 0X70, 0X04, 0X79,
-  0X53, 0XA6, 0X06, 0X60, 0X31, 0X3D, 0XD7, 0X99, 0XEE, 0X0A, 0X3A, 0XFE,
-  0X16, 0X4A, 0XD3, 0XD9, 0XB0, 0X48, 0X8A, 0X9D, 0XDA, 0XD7, 0XA6, 0XA5,
-  0X8F, 0X1B, 0XB4, 0X9B, 0X22, 0XD2, 0XE2, 0XE7, 0X2F, 0X23, 0X84, 0XF4,
-  0X74, 0X30, 0X39, 0X55, 0X48, 0X6B, 0XBC, 0X02, 0XE1, 0X9C, 0X5E, 0X62,
-  0X14, 0XAF, 0X2D, 0X19, 0X45, 0X73, 0X6A, 0X46, 0XF6, 0XD2, 0X64, 0X57,
-  0X99, 0XD6, 0X86, 0X1E, 0XBC, 0XB5, 0X49, 0XBA, 0XDA, 0X5B, 0XF0, 0XFE,
-  0XB3, 0X6C, 0X10, 0X3F, 0X8B, 0X9B, 0X96, 0X0D, 0X30, 0XCD, 0XAA, 0X25,
-  0X55, 0X06, 0XCC, 0XDD, 0XBA, 0XBF, 0X5F, 0X5F, 0XF1, 0X90, 0X30, 0XF7,
-  0XB5, 0X34, 0X83, 0XB9, 0XEB, 0X78, 0X77, 0XD5, 0X4D, 0X13, 0XCD, 0X14,
-  0X6B, 0X91, 0X6C, 0X41, 0XA1, 0X63, 0X64, 0X87, 0X78, 0X45, 0XF3, 0X09,
-  0X98, 0X86, 0X3A, 0X02, 0X1B, 0X14, 0X4E, 0XBD, 0X2E, 0X0D, 0XCD, 0X27,
-  0XFE, 0X03, 0X6F, 0X23, 0X5E, 0X8D, 0XA0, 0X54, 0X59, 0X39, 0X2E, 0X2E,
-  0XF0, 0X66, 0X2F, 0X61, 0XCD, 0XE3, 0X4E, 0XDC, 0X09, 0X4B, 0X9E, 0XE1,
-  0X8F, 0X43, 0X56, 0XAD, 0X2D, 0XF1, 0X78, 0X3A, 0X02, 0X26, 0XFF, 0X2A,
-  0X72, 0XF9, 0X62, 0XDB, 0X0A, 0XB8, 0X61, 0X65, 0X3A, 0XC9, 0X5E, 0X69,
-  0XE3, 0X86, 0X13, 0X0C, 0X5E, 0X8F, 0X88, 0X28, 0XD6, 0X36, 0X32, 0X4C,
-  0XE3, 0XA9, 0X2D, 0X46, 0X05, 0X53, 0XA9, 0X17, 0XCE, 0XB6, 0X84, 0X31,
-  0X01, 0XF3, 0XF6, 0XC8, 0X50, 0X8C, 0XF4, 0X10, 0XFF, 0X68, 0XF8, 0XFB,
-  0XD0, 0XA6, 0XD1, 0XEF, 0XFD, 0XAF, 0XAA, 0X7E, 0XA9, 0X8C, 0X5B, 0XFB,
-  0X8F, 0XA7, 0X55, 0X85, 0XA7, 0XA7, 0X57, 0X50, 0X6A, 0X08, 0X47, 0X3A,
-  0X73, 0X0D, 0X22, 0XE9, 0XFC, 0XC4, 0XB7, 0X28, 0X90, 0XFA, 0XCC, 0X0B,
-  0X92, 0XB3, 0X9F, 0XC2, 0X81, 0X4E, 0X3E, 0X4D, 0XD1, 0XB5, 0X76, 0X9B,
-  0XA2, 0X66, 0XD3, 0X06, 0XF1, 0X79, 0X76, 0XA3, 0X43, 0XFC, 0X87, 0X5A,
-  0XDA, 0X75, 0X96, 0X58, 0X6F, 0X1E, 0XA8, 0X13, 0XF0, 0XCA, 0X6F, 0X1D,
-  0XB0, 0X5B, 0XC7, 0X6F, 0X54, 0XBE, 0X66, 0X99, 0XDF, 0X47, 0X4A, 0XAF,
-  0X6C, 0X96, 0X6E, 0XF3, 0XB2, 0X32, 0X0C, 0XBB, 0X49, 0X7D, 0XD5, 0X78,
-  0XA5, 0X3B, 0X3D, 0XF9, 0X9D, 0X2F, 0X0E, 0X25, 0X7F, 0X7E, 0XA2, 0X35,
-  0XDE, 0XFA, 0X6E, 0X4F, 0XE2, 0X21, 0X83, 0X7B, 0X9E, 0X8B, 0X1D, 0X6B,
-  0X52, 0X50, 0XF6, 0X61, 0X5B, 0XF1, 0XE2, 0X1F, 0X96, 0X95, 0XAF, 0X7F,
-  0XD6, 0X4E, 0XC6, 0XC3, 0X9B, 0XD9, 0XE9, 0XFC, 0XFA, 0XF2, 0XF7, 0X9B,
-  0XF1, 0X1C, 0X3C, 0XA8, 0X9E, 0X28, 0XA6, 0X41, 0XDD, 0X5C, 0X32, 0X79,
-  0X7C, 0X7D, 0X39, 0X3C, 0X19, 0X0D, 0XA7, 0X33, 0XA4, 0X0F, 0X47, 0XB3,
-  0X74, 0X12, 0X5C, 0XD9, 0XEC, 0XE6, 0X7A, 0X3C, 0XBF, 0X9C, 0X9C, 0X7F,
-  0X12, 0X96, 0X7D, 0X79, 0XD3, 0XBB, 0X45, 0X79, 0X0F, 0X59, 0X02, 0XFA,
-  0X06, 0XBA, 0XFB, 0XF0, 0X76, 0XD7, 0X8C, 0X92, 0X00, 0X00, 0XF1, 0X16,
-  0XEC, 0X77, 0X0E, 0XDE, 0X7A, 0XEF, 0X93, 0XC9, 0XD1, 0XE5, 0XC5, 0XF1,
-  0XD9, 0X04, 0XD6, 0X9E, 0X9F, 0XD7, 0XDD, 0XF7, 0XCA, 0X9B, 0X52, 0X49,
-  0X31, 0XE9, 0X5B, 0X74, 0XC2, 0XC5, 0X7F, 0X8D, 0XB3, 0XF9, 0XA4, 0XEE,
-  0X2E, 0X17, 0XE4, 0X36, 0XC5, 0X27, 0XD6, 0XF3, 0X7A, 0X89, 0X5F, 0XE3,
-  0XCD, 0X63, 0X21, 0X35, 0X48, 0X3F, 0XD2, 0XD1, 0X4A, 0X3D, 0X26, 0X91,
-  0X94, 0X01, 0X31, 0X70, 0X6C, 0X82, 0X9B, 0XCB, 0X3A, 0XFC, 0X1C, 0XE3,
-  0X3E, 0X2F, 0XE1, 0X0A, 0XAE, 0X8E, 0X06, 0XCB, 0XE4, 0XAB, 0XA0, 0XEA,
-  0XD4, 0X85, 0X03, 0X14, 0XD5, 0XC3, 0X47, 0X33, 0X93, 0XE0, 0X05, 0XA2,
-  0X0A, 0X22, 0X49, 0X52, 0X38, 0X1B, 0X4A, 0X88, 0XEC, 0X3B, 0XA4, 0X3E,
-  0X6B, 0XE6, 0XD4, 0XEC, 0X28, 0X17, 0X15, 0X26, 0XDE, 0X92, 0X70, 0XC4,
-  0X62, 0XD5, 0X26, 0XC5, 0XA2, 0X5E, 0X2B, 0XFD, 0X74, 0XA3, 0XD7, 0XA2,
-  0X5F, 0XA2, 0XB2, 0X0F, 0X53, 0XE9, 0X47, 0XC9, 0XFF, 0X03, 0XCA, 0XDB,
-  0X6A, 0X2E, 0XAB, 0X3C, 0X00, 0X00
+  0X1F, 0X8B, 0X08, 0X08, 0X18, 0X9B, 0XD4, 0X6A, 0X02, 0X03, 0X69, 0X6E,
+  0X64, 0X65, 0X78, 0X2E, 0X68, 0X74, 0X6D, 0X6C, 0X00, 0XED, 0X3C, 0X6B,
+  0X53, 0XDB, 0XC8, 0X96, 0XDF, 0XE7, 0X57, 0X74, 0XB4, 0XB5, 0X33, 0XF2,
+  0X80, 0XE5, 0X07, 0X81, 0X65, 0XC0, 0XF6, 0X2D, 0XC7, 0X38, 0X03, 0X35,
+  0X60, 0X28, 0XEC, 0XCC, 0X9D, 0XA9, 0X4C, 0XCA, 0X25, 0X5B, 0X6D, 0XAC,
+  0X20, 0X4B, 0XBA, 0X92, 0X9C, 0XC0, 0XE6, 0XF2, 0XDF, 0XF7, 0XF4, 0X4B,
+  0X6A, 0X49, 0X2D, 0X5B, 0X02, 0X93, 0XBD, 0XFB, 0X48, 0X55, 0X0A, 0XAB,
+  0X75, 0XFA, 0XBC, 0XFA, 0XF4, 0X79, 0XF4, 0X43, 0X9D, 0X37, 0X67, 0XD7,
+  0X83, 0XC9, 0X9F, 0X37, 0X43, 0XB4, 0X8C, 0X56, 0X4E, 0XEF, 0X87, 0X8E,
+  0XF8, 0X83, 0X4D, 0XAB, 0XF7, 0X03, 0X82, 0X7F, 0X9D, 0X15, 0X8E, 0X4C,
+  0XE4, 0X9A, 0X2B, 0XDC, 0XD5, 0XBE, 0XD8, 0XF8, 0XAB, 0XEF, 0X05, 0X91,
+  0X86, 0XE6, 0X9E, 0X1B, 0X61, 0X37, 0XEA, 0X6A, 0X5F, 0X6D, 0X2B, 0X5A,
+  0X76, 0X2D, 0XFC, 0XC5, 0X9E, 0XE3, 0X3A, 0X7D, 0XD8, 0XB7, 0X5D, 0X3B,
+  0XB2, 0X4D, 0XA7, 0X1E, 0XCE, 0X4D, 0X07, 0X77, 0X5B, 0X1A, 0XC7, 0X13,
+  0XD9, 0X91, 0X83, 0X7B, 0XC3, 0XF1, 0XCD, 0X41, 0X1B, 0X5D, 0X99, 0XAE,
+  0X79, 0X87, 0X57, 0X80, 0X01, 0XF5, 0X6F, 0X3A, 0X0D, 0XF6, 0X8A, 0X81,
+  0X85, 0XD1, 0XA3, 0XF8, 0X4D, 0XFE, 0XCD, 0X3C, 0XEB, 0X11, 0X7D, 0X8B,
+  0X1F, 0XC9, 0X3F, 0X4A, 0XE5, 0X04, 0X2D, 0XEC, 0XA8, 0XCE, 0XD9, 0X38,
+  0X8D, 0XDF, 0X3F, 0XC5, 0XBF, 0X22, 0X73, 0XE6, 0XE0, 0X7D, 0X14, 0X05,
+  0XF0, 0X7F, 0X99, 0XC1, 0X30, 0XF3, 0X02, 0X0B, 0X07, 0X27, 0XA8, 0XE5,
+  0X3F, 0XA0, 0XD0, 0X73, 0X6C, 0XEB, 0X54, 0XF1, 0X1A, 0X90, 0X3B, 0X8E,
+  0XE9, 0X87, 0XF8, 0X04, 0X89, 0X5F, 0X69, 0XB0, 0X08, 0X3F, 0X44, 0X75,
+  0XD3, 0XB1, 0XEF, 0X5C, 0X80, 0X00, 0X2E, 0X70, 0XA0, 0XE4, 0X63, 0X09,
+  0X0C, 0X58, 0X19, 0X06, 0X7C, 0XD3, 0XB2, 0X6C, 0XF7, 0XEE, 0XA4, 0XD5,
+  0XF4, 0X1F, 0X94, 0X9D, 0X82, 0X93, 0XA5, 0XF7, 0X05, 0X13, 0XDE, 0X03,
+  0X23, 0XC4, 0X0E, 0X9E, 0X47, 0X38, 0X8B, 0X63, 0X66, 0XCE, 0XEF, 0XEF,
+  0X02, 0X6F, 0XED, 0X5A, 0X84, 0X53, 0X0F, 0XC4, 0X01, 0X56, 0X96, 0XD1,
+  0XCC, 0X59, 0X67, 0XF8, 0X9C, 0XAF, 0X83, 0X10, 0X5E, 0XFB, 0X9E, 0XAD,
+  0XE2, 0XB1, 0XD3, 0XE0, 0X1A, 0XEF, 0X34, 0XD8, 0XA0, 0X77, 0XA8, 0XCA,
+  0X3D, 0XF7, 0XD2, 0X33, 0XAD, 0XAE, 0X76, 0X87, 0XA3, 0X71, 0X64, 0X46,
+  0XEB, 0X50, 0XAF, 0X89, 0X81, 0X5C, 0XB6, 0XF8, 0X28, 0XFE, 0XDD, 0XAE,
+  0XBF, 0XB7, 0XD1, 0X0D, 0X76, 0X71, 0X14, 0X98, 0X91, 0XED, 0XB9, 0X68,
+  0XE2, 0X79, 0X0E, 0XE0, 0X69, 0X89, 0XB1, 0X04, 0XBE, 0X49, 0XB3, 0X0D,
+  0X88, 0X70, 0X10, 0X78, 0X41, 0XA8, 0XF5, 0X80, 0X1E, 0X6B, 0X55, 0XC0,
+  0X38, 0X40, 0X12, 0XD4, 0XA2, 0XF5, 0X2E, 0XD9, 0X0F, 0XC3, 0X30, 0XD0,
+  0X8D, 0X83, 0XCD, 0X10, 0XA3, 0XAF, 0XA6, 0X1D, 0X6D, 0XEA, 0X1A, 0X00,
+  0XEF, 0X8F, 0X1A, 0XA2, 0XB2, 0X74, 0X35, 0XCB, 0X0E, 0X7D, 0XC7, 0X7C,
+  0X3C, 0X41, 0XAE, 0XE7, 0XE2, 0X53, 0X2D, 0X31, 0XA7, 0XCE, 0XB2, 0XDD,
+  0XEB, 0X47, 0X11, 0XA8, 0X8E, 0X98, 0XF0, 0XC2, 0XBE, 0X5B, 0X33, 0XCE,
+  0X81, 0XE9, 0XB6, 0X04, 0XB5, 0XF0, 0X82, 0X15, 0XA8, 0X60, 0XBC, 0X9E,
+  0XAD, 0X6C, 0X30, 0XF2, 0X60, 0XED, 0XB2, 0X4E, 0X7A, 0XED, 0X14, 0X05,
+  0X38, 0X5A, 0X07, 0X2E, 0X5A, 0X98, 0X4E, 0X98, 0X42, 0XCD, 0X3A, 0XDA,
+  0XD8, 0XB1, 0X42, 0X1C, 0XA5, 0X9B, 0XE9, 0X2B, 0X07, 0XDF, 0X61, 0XD7,
+  0XEA, 0X8D, 0XE9, 0X68, 0X82, 0X79, 0X06, 0XA0, 0XDA, 0X4E, 0X83, 0XB7,
+  0XE6, 0XC1, 0XA9, 0XFD, 0X52, 0XD1, 0X4C, 0XBF, 0XEE, 0XD8, 0X61, 0X44,
+  0X54, 0X47, 0X1B, 0X15, 0XC0, 0X7E, 0XBE, 0X8D, 0XB6, 0XCF, 0XD6, 0X51,
+  0X04, 0X0A, 0X8A, 0X1E, 0X7D, 0X50, 0X0A, 0X7B, 0XD0, 0X40, 0XAE, 0X81,
+  0X63, 0XCF, 0XEF, 0X89, 0XCE, 0X16, 0X01, 0X0E, 0X97, 0X7D, 0X9F, 0X0E,
+  0XEE, 0X2D, 0X7B, 0XEA, 0X34, 0X18, 0X9C, 0X82, 0X4A, 0X23, 0X43, 0XA6,
+  0XD3, 0X50, 0X8B, 0X5B, 0X42, 0X0B, 0XEA, 0X31, 0X28, 0X54, 0X46, 0X91,
+  0X7C, 0X8E, 0X39, 0XC3, 0X0E, 0X82, 0XD1, 0X02, 0X2D, 0X51, 0X8C, 0X53,
+  0X22, 0XAA, 0X26, 0XD0, 0X93, 0X87, 0X13, 0X40, 0X4B, 0XA0, 0X0A, 0X30,
+  0XB0, 0XC9, 0XC5, 0XF4, 0X2C, 0X61, 0X20, 0X4A, 0X5A, 0X9A, 0XEE, 0X1D,
+  0XA8, 0X6D, 0XED, 0X5B, 0X66, 0X84, 0X07, 0X82, 0X53, 0X18, 0X80, 0XF7,
+  0X54, 0X3C, 0X3D, 0X5A, 0XDA, 0X61, 0X4D, 0X03, 0X7B, 0XF8, 0XC7, 0XDA,
+  0X0E, 0XB0, 0XA5, 0X26, 0X40, 0X89, 0X78, 0X3E, 0XB5, 0XD3, 0X2F, 0X26,
+  0XCC, 0XCD, 0XAE, 0XD6, 0XD4, 0X10, 0X75, 0X78, 0X5D, 0X6D, 0X02, 0X18,
+  0X28, 0X93, 0X08, 0XFE, 0XBA, 0X1E, 0XB0, 0XB1, 0XF2, 0X1D, 0XEA, 0X16,
+  0X61, 0XB6, 0X3F, 0XE2, 0XC8, 0XD0, 0X10, 0X58, 0X32, 0X21, 0X09, 0X1A,
+  0X9B, 0X4C, 0XFA, 0X83, 0XDF, 0XA6, 0XC4, 0X57, 0X4F, 0X6F, 0XFA, 0XE3,
+  0XF1, 0XC5, 0XEF, 0XC3, 0X4E, 0X83, 0X21, 0X2E, 0X4D, 0X19, 0X7C, 0XB1,
+  0X8C, 0XE6, 0XBC, 0X3F, 0X3A, 0X1B, 0X9F, 0XF7, 0X7F, 0XAB, 0X8E, 0XA8,
+  0X0D, 0X33, 0X8D, 0X7B, 0XA5, 0X34, 0X63, 0X57, 0XBF, 0X5D, 0X9C, 0X55,
+  0XC6, 0X76, 0X90, 0X66, 0XEB, 0XEC, 0X7A, 0XBC, 0X19, 0X05, 0XF1, 0X03,
+  0X84, 0X78, 0X09, 0X13, 0XAD, 0X68, 0X3D, 0X10, 0XEB, 0X96, 0X9E, 0X15,
+  0XDB, 0X0F, 0X7B, 0XAC, 0X6C, 0X41, 0X1C, 0X4B, 0X6C, 0X19, 0XC9, 0X20,
+  0X96, 0XD5, 0X48, 0XA2, 0XDE, 0XB8, 0X2F, 0X5A, 0XDA, 0X96, 0X85, 0XDD,
+  0XDE, 0XE8, 0X7A, 0X82, 0XFA, 0XBF, 0XF7, 0X2F, 0X2E, 0XFB, 0XEF, 0X2E,
+  0X87, 0XFF, 0X5D, 0X7A, 0X8A, 0XEC, 0X15, 0XF6, 0XD6, 0X51, 0X32, 0XD1,
+  0XD8, 0X33, 0XD2, 0XC1, 0X25, 0X7B, 0XAE, 0X15, 0XD6, 0XB6, 0XE8, 0XCC,
+  0X76, 0X7D, 0X80, 0X66, 0X6E, 0XC9, 0X5D, 0XAF, 0X66, 0X38, 0XD0, 0XD0,
+  0XCA, 0X76, 0XE9, 0XDC, 0X58, 0X99, 0X0F, 0X60, 0X60, 0X87, 0X87, 0X5A,
+  0X6A, 0X52, 0X72, 0X82, 0X89, 0X82, 0X84, 0X72, 0X1B, 0X2F, 0X95, 0X8E,
+  0XBB, 0X3B, 0X26, 0XC9, 0XF7, 0XF1, 0X7E, 0X03, 0XD3, 0X87, 0X18, 0X82,
+  0X21, 0X85, 0X71, 0X20, 0X22, 0X3F, 0XC3, 0XEF, 0XC9, 0XFA, 0X23, 0X69,
+  0X08, 0XD3, 0XD5, 0X9C, 0XA1, 0X9D, 0X32, 0XB4, 0X60, 0X43, 0XF6, 0X7F,
+  0XC2, 0XFB, 0X43, 0XD0, 0X29, 0X04, 0XC3, 0X39, 0X5E, 0X7A, 0X0E, 0XA4,
+  0X35, 0X10, 0X89, 0X8D, 0X3B, 0X03, 0X81, 0X89, 0XE2, 0X00, 0XF9, 0X81,
+  0X17, 0X79, 0X08, 0X9B, 0XBE, 0XE7, 0X20, 0X2F, 0X60, 0XAE, 0X68, 0X75,
+  0XB7, 0X8A, 0X50, 0XB8, 0X9E, 0XD1, 0X87, 0X19, 0X36, 0X61, 0X40, 0XB5,
+  0XC6, 0XB3, 0XE2, 0X0B, 0XE8, 0X80, 0X4B, 0XFA, 0X9E, 0X72, 0X44, 0XA2,
+  0X4C, 0XDF, 0XF7, 0X9D, 0XC7, 0X17, 0X6A, 0X19, 0XDA, 0X20, 0X3E, 0XA7,
+  0X83, 0XFA, 0X18, 0X87, 0X21, 0X99, 0X40, 0XE0, 0X51, 0X23, 0X2F, 0X78,
+  0XCC, 0XC4, 0XF3, 0X24, 0X98, 0X86, 0X0C, 0X2E, 0X54, 0X44, 0XD3, 0XAC,
+  0XB6, 0XCB, 0X45, 0X4F, 0X4E, 0X78, 0X73, 0X08, 0X4D, 0X89, 0X45, 0XD8,
+  0X15, 0X16, 0XE0, 0X78, 0X77, 0X85, 0XAC, 0XF2, 0XE1, 0XAC, 0X03, 0XCC,
+  0XCE, 0XB8, 0XE5, 0X74, 0X2F, 0XBD, 0XBB, 0X72, 0XFC, 0X6E, 0X4C, 0XB9,
+  0XD6, 0XAE, 0X4B, 0XB2, 0XB5, 0XAD, 0X49, 0XD7, 0X04, 0X26, 0X2F, 0XC2,
+  0X34, 0X83, 0XB6, 0X4E, 0X00, 0X87, 0X6F, 0XA6, 0X10, 0XD4, 0XC1, 0X0A,
+  0XEF, 0X80, 0X0F, 0X96, 0X1C, 0XC2, 0XCB, 0X12, 0XA4, 0X71, 0XB8, 0X76,
+  0XA2, 0X12, 0XE9, 0X9E, 0X65, 0X7F, 0X91, 0X3A, 0XD4, 0X49, 0X2D, 0X13,
+  0X67, 0X97, 0X88, 0X35, 0X66, 0X73, 0X4C, 0XE8, 0X52, 0X8C, 0X80, 0X17,
+  0X1C, 0X84, 0XD3, 0X34, 0XDC, 0XF2, 0XA0, 0X47, 0XF2, 0X64, 0X62, 0X09,
+  0X30, 0XA0, 0X07, 0X6A, 0XDB, 0XE3, 0X00, 0XAA, 0XD1, 0XDC, 0X36, 0X7A,
+  0X30, 0X01, 0X44, 0X0A, 0XAA, 0XF5, 0X46, 0XF8, 0X2B, 0X32, 0X15, 0XFE,
+  0X2A, 0XA7, 0XB2, 0X79, 0X60, 0XFB, 0X7C, 0XE2, 0X7C, 0X31, 0X03, 0XC4,
+  0X30, 0X10, 0X3E, 0XF1, 0X10, 0XDC, 0X2E, 0XEA, 0XA2, 0X6F, 0XE8, 0X76,
+  0XD8, 0X3F, 0XFB, 0XF3, 0X04, 0X35, 0XF7, 0XD1, 0XED, 0X87, 0XD1, 0XE8,
+  0X62, 0XF4, 0X2B, 0X94, 0X45, 0XFB, 0XE8, 0XFD, 0XC5, 0XE8, 0X62, 0X7C,
+  0X3E, 0X3C, 0X3B, 0X41, 0XED, 0X7D, 0X34, 0XB9, 0XB8, 0X1A, 0X5E, 0X7F,
+  0X98, 0X9C, 0XA0, 0X83, 0XA7, 0XD3, 0X0C, 0XAE, 0X09, 0XF0, 0X1B, 0XA3,
+  0X52, 0XA4, 0X28, 0X14, 0XB1, 0X32, 0XE7, 0XA0, 0X64, 0X72, 0XB9, 0X03,
+  0XA5, 0X97, 0X49, 0X06, 0XD2, 0X74, 0X45, 0X60, 0XEC, 0XFB, 0X43, 0X96,
+  0X2A, 0X01, 0XE9, 0X7A, 0X2B, 0X79, 0X0F, 0XAE, 0XCC, 0X49, 0X3F, 0X4D,
+  0X69, 0XDD, 0X03, 0X81, 0X03, 0X20, 0X5B, 0XCD, 0X66, 0X33, 0X79, 0XCB,
+  0X0D, 0X70, 0X9A, 0XEE, 0X23, 0XB7, 0X16, 0XF7, 0X4D, 0X07, 0X26, 0X78,
+  0X2D, 0XBD, 0X23, 0X8D, 0X53, 0X6E, 0XF0, 0XE9, 0X37, 0X16, 0X5E, 0X98,
+  0X60, 0X47, 0XB7, 0XD4, 0X9A, 0X06, 0XCC, 0X98, 0X00, 0XC2, 0XF2, 0XE6,
+  0X6B, 0X22, 0X8B, 0X01, 0X35, 0X01, 0X17, 0XEB, 0XDD, 0XE3, 0X85, 0XA5,
+  0X0B, 0X43, 0XAF, 0X19, 0XB6, 0XEB, 0XE2, 0XE0, 0X7C, 0X72, 0X75, 0X99,
+  0XC3, 0XC5, 0X06, 0XE2, 0X8A, 0XE6, 0X1C, 0XE1, 0X26, 0X5C, 0XE9, 0XEC,
+  0XA4, 0X66, 0X00, 0XDB, 0X32, 0XCA, 0XC5, 0XDA, 0X65, 0X13, 0X4C, 0X2A,
+  0XF9, 0XA4, 0X92, 0X93, 0X50, 0XF4, 0X6E, 0XF1, 0X3F, 0X80, 0X82, 0X0B,
+  0XE6, 0XF7, 0XC7, 0XD5, 0XE5, 0X79, 0X14, 0XF9, 0XD0, 0XB0, 0XC6, 0X61,
+  0X04, 0X75, 0X51, 0X0C, 0X48, 0X80, 0X0C, 0XCF, 0X25, 0XB5, 0X1C, 0XC0,
+  0X0A, 0XAC, 0X29, 0X5C, 0XB1, 0X0E, 0X83, 0XC0, 0X7C, 0X7C, 0XB7, 0X5E,
+  0X2C, 0X20, 0X14, 0X75, 0X59, 0X47, 0X10, 0XD8, 0X87, 0X29, 0X92, 0X29,
+  0X61, 0XED, 0X85, 0X2E, 0XC1, 0X66, 0X51, 0X65, 0X86, 0X84, 0X4C, 0X33,
+  0X0C, 0XF8, 0X7C, 0X33, 0X08, 0XF1, 0X85, 0X1B, 0XE9, 0X84, 0XDF, 0X0F,
+  0X30, 0X90, 0XC7, 0X7D, 0X82, 0X43, 0XC6, 0XB4, 0X4F, 0XCC, 0XB3, 0X55,
+  0XAB, 0X9D, 0X6E, 0XC2, 0X47, 0X03, 0X61, 0X49, 0X74, 0XAD, 0XED, 0XE8,
+  0XB8, 0X0B, 0X99, 0X92, 0XE8, 0XAC, 0X42, 0XDB, 0X3A, 0X52, 0XE0, 0X6D,
+  0X97, 0XC6, 0XCB, 0XC7, 0XA7, 0X88, 0XC1, 0XB7, 0X0A, 0X24, 0XD0, 0X33,
+  0XF4, 0X1C, 0X6C, 0X40, 0XA0, 0X89, 0XAD, 0X84, 0X2A, 0XB1, 0XAB, 0XA1,
+  0XBD, 0XB4, 0X56, 0XF7, 0X90, 0X76, 0X2A, 0XEB, 0X45, 0X86, 0XA0, 0X7A,
+  0X92, 0X01, 0XE6, 0XDE, 0X9A, 0XCB, 0X29, 0X83, 0XC9, 0XF2, 0X17, 0X48,
+  0X14, 0X52, 0XF3, 0X03, 0X49, 0XB4, 0XE1, 0XED, 0XED, 0XF5, 0XED, 0X09,
+  0X1A, 0X98, 0X2E, 0X29, 0X8F, 0XA8, 0XAE, 0X38, 0X1E, 0X0A, 0X84, 0X0D,
+  0X2D, 0X8F, 0X01, 0X12, 0X65, 0XDC, 0X77, 0X9C, 0X31, 0X73, 0X85, 0XA1,
+  0XAE, 0X20, 0X12, 0X7E, 0XB5, 0XA3, 0XF9, 0X52, 0X97, 0X45, 0X53, 0X19,
+  0X15, 0X55, 0X0E, 0X89, 0X0C, 0X19, 0XC7, 0X69, 0X30, 0XA7, 0X59, 0X98,
+  0XCD, 0X87, 0X4B, 0XEF, 0X2B, 0XEB, 0XC2, 0XCA, 0X46, 0X15, 0X0B, 0XF1,
+  0X32, 0X4E, 0X80, 0XCD, 0XFB, 0XD3, 0X0A, 0XA4, 0XB9, 0X97, 0XDE, 0X48,
+  0XFC, 0X96, 0XB9, 0XB0, 0X4D, 0X74, 0X53, 0X83, 0X7E, 0X03, 0XAE, 0X4E,
+  0XDB, 0X00, 0X0C, 0XD1, 0X67, 0XC2, 0X1C, 0X9D, 0X1E, 0X7B, 0X87, 0XFD,
+  0XB4, 0X73, 0XDD, 0XA1, 0X88, 0X71, 0XF0, 0XD9, 0X2C, 0X23, 0X75, 0X8D,
+  0XBA, 0X26, 0XA0, 0XB5, 0X7D, 0XD9, 0X10, 0XF7, 0X55, 0XE6, 0X96, 0X6D,
+  0XDC, 0X67, 0X3E, 0X07, 0X44, 0XBA, 0XE5, 0X6E, 0XE7, 0X1C, 0X9B, 0X90,
+  0X23, 0XEB, 0XDA, 0X1F, 0X75, 0XC6, 0X54, 0XFD, 0XCA, 0X76, 0XC0, 0XBF,
+  0X41, 0X5A, 0X11, 0X6A, 0XB5, 0X1D, 0X8A, 0X28, 0X42, 0X6A, 0X29, 0X09,
+  0X39, 0XF0, 0XBF, 0XAA, 0X80, 0X3C, 0X0E, 0X15, 0XCB, 0X52, 0X18, 0X91,
+  0XF8, 0X9A, 0XA0, 0X14, 0XDD, 0XE8, 0X9C, 0X27, 0XAD, 0X88, 0XAF, 0X05,
+  0XCA, 0XB3, 0X7D, 0X1D, 0XBE, 0X41, 0X1F, 0XDC, 0X7B, 0XD7, 0XFB, 0XEA,
+  0X16, 0XCF, 0XFE, 0XA7, 0X5C, 0X0B, 0X5B, 0XB0, 0XCB, 0X43, 0XFE, 0XA0,
+  0XEE, 0XF6, 0X94, 0X0B, 0X65, 0X94, 0XCD, 0X4D, 0XB1, 0X2C, 0X35, 0X97,
+  0X78, 0X48, 0X44, 0XB4, 0X57, 0X76, 0X52, 0X55, 0X54, 0X05, 0XF7, 0X7B,
+  0XA0, 0XFB, 0XF9, 0X12, 0XD1, 0X45, 0X57, 0X03, 0X0D, 0X96, 0X98, 0X54,
+  0XDC, 0X4B, 0X33, 0X42, 0X8F, 0XDE, 0X1A, 0X62, 0X28, 0X26, 0XF4, 0X5D,
+  0XB6, 0X5A, 0X00, 0XD5, 0XDC, 0X4A, 0X5E, 0X5B, 0X37, 0XD0, 0X9F, 0X00,
+  0XB3, 0X22, 0X0B, 0XC3, 0X24, 0XAE, 0X93, 0XD5, 0X84, 0X04, 0XD8, 0X5A,
+  0X07, 0X89, 0X86, 0XB3, 0XBA, 0X94, 0XB2, 0X80, 0XD3, 0X0D, 0XBA, 0X49,
+  0XF2, 0X9F, 0X6A, 0XDA, 0X11, 0X05, 0X7D, 0XAD, 0X98, 0XAA, 0X34, 0X42,
+  0X39, 0XBA, 0X3E, 0X76, 0X75, 0XED, 0XD7, 0X21, 0X99, 0X13, 0XDA, 0X12,
+  0XF2, 0X90, 0X93, 0X46, 0XA3, 0XF5, 0X4B, 0XDB, 0X68, 0X1D, 0X1D, 0X1B,
+  0X6F, 0X8D, 0X56, 0X83, 0X59, 0X8B, 0X46, 0X96, 0XCF, 0XD7, 0X38, 0X9B,
+  0X9B, 0X88, 0X14, 0X63, 0XC2, 0XE2, 0XBA, 0X46, 0XE3, 0XE3, 0X8C, 0XC6,
+  0X47, 0X2D, 0X03, 0X1A, 0X42, 0X59, 0X2E, 0XE4, 0X7F, 0X4A, 0X67, 0X49,
+  0XB9, 0X28, 0X93, 0X08, 0X0D, 0XD5, 0XA9, 0XEE, 0X80, 0XB2, 0X45, 0XC5,
+  0XE2, 0X2D, 0X54, 0XE3, 0X1E, 0XBE, 0X7B, 0X9C, 0X98, 0X77, 0X23, 0X73,
+  0X85, 0X75, 0X8D, 0X43, 0XC2, 0X0C, 0X4C, 0XAB, 0X8E, 0XB7, 0X1B, 0XB4,
+  0XCE, 0X31, 0X78, 0X99, 0X43, 0X78, 0X26, 0X85, 0X8E, 0X96, 0X1B, 0X97,
+  0X0C, 0X8B, 0XA9, 0X48, 0X90, 0X20, 0XDE, 0X10, 0X1F, 0X8B, 0XF3, 0X50,
+  0X5E, 0XEB, 0XD5, 0XF2, 0XAC, 0XCC, 0X1C, 0X6F, 0X7E, 0XAF, 0X29, 0X19,
+  0XA0, 0X09, 0XC0, 0X0D, 0XAF, 0XEE, 0X64, 0X16, 0X20, 0X9F, 0X4B, 0XE5,
+  0XC8, 0XBD, 0X6E, 0X26, 0X9F, 0XCE, 0XE8, 0XA1, 0XE2, 0XB4, 0XE1, 0XF5,
+  0X5C, 0X80, 0XB9, 0XAD, 0XE7, 0XA6, 0X85, 0X56, 0X75, 0X56, 0X6E, 0X94,
+  0X3A, 0X36, 0X74, 0X20, 0X1B, 0X5C, 0XF0, 0X78, 0XA8, 0XCB, 0X65, 0X44,
+  0X4D, 0XB5, 0XC9, 0XB3, 0X4D, 0XD9, 0X49, 0X5D, 0X9C, 0X16, 0X2F, 0XA5,
+  0X39, 0XC8, 0XB7, 0X1A, 0X72, 0X0E, 0XC6, 0XA7, 0X23, 0X34, 0X87, 0X12,
+  0X77, 0X72, 0X97, 0XBD, 0XBD, 0X42, 0X63, 0X49, 0XE7, 0X2C, 0XDF, 0X4A,
+  0X70, 0X4A, 0X77, 0X5D, 0X4A, 0XA8, 0X47, 0XDE, 0X6A, 0XC8, 0XB5, 0X26,
+  0X4B, 0X28, 0XB9, 0X57, 0XF2, 0X7A, 0X45, 0XB1, 0X8D, 0XB3, 0X38, 0X19,
+  0XF2, 0XB4, 0XA4, 0X7A, 0X90, 0X5C, 0XC5, 0X31, 0XB0, 0XDC, 0X34, 0X49,
+  0X0F, 0X74, 0X66, 0X80, 0X2B, 0XD4, 0X72, 0XA4, 0X5A, 0X53, 0X14, 0X84,
+  0X55, 0X70, 0X6D, 0XD5, 0XFC, 0X16, 0X14, 0X6C, 0X49, 0X24, 0XCD, 0X13,
+  0X4F, 0XBF, 0XC1, 0X86, 0X3A, 0XB3, 0XA0, 0X97, 0X1F, 0X45, 0XB1, 0XD0,
+  0X21, 0XAB, 0X84, 0X17, 0X49, 0X9B, 0X12, 0X76, 0X02, 0X22, 0X47, 0X99,
+  0X74, 0X12, 0X4E, 0XDE, 0XE6, 0X22, 0X47, 0X92, 0X3A, 0X89, 0X85, 0X06,
+  0X43, 0XB5, 0XC8, 0X90, 0X0B, 0XED, 0X82, 0X1B, 0X05, 0XB0, 0X22, 0X65,
+  0X50, 0XE4, 0X36, 0XDB, 0X28, 0X27, 0XCB, 0X18, 0XA5, 0X68, 0XC7, 0XE0,
+  0X0A, 0XEA, 0X6C, 0X1C, 0XCE, 0X4D, 0XD7, 0X0A, 0X97, 0XE6, 0X3D, 0XD6,
+  0XB3, 0XC6, 0X59, 0XAE, 0X6C, 0X7A, 0X86, 0X0C, 0X6C, 0XC1, 0XA5, 0X9C,
+  0XEE, 0X08, 0X68, 0X21, 0XEF, 0X37, 0XAB, 0X7B, 0XDB, 0XFA, 0X7E, 0X7C,
+  0X93, 0X25, 0XA1, 0X52, 0X5C, 0X03, 0X60, 0XB9, 0XD1, 0X2E, 0XCC, 0X60,
+  0X05, 0XD6, 0X0F, 0XA3, 0XDF, 0X46, 0XD7, 0X7F, 0X1F, 0X69, 0XD5, 0XDC,
+  0X78, 0XC1, 0X04, 0XDB, 0XEB, 0X22, 0X51, 0X2A, 0X67, 0XE6, 0X17, 0X84,
+  0X45, 0XC9, 0X15, 0XA1, 0X92, 0X31, 0X70, 0X03, 0X9D, 0X04, 0X9B, 0X01,
+  0X0E, 0XC2, 0X86, 0X5A, 0X62, 0X1F, 0X40, 0X56, 0XA6, 0XAF, 0XC7, 0XD9,
+  0X5A, 0X0C, 0X52, 0XB4, 0XAA, 0XE2, 0X9B, 0X36, 0X49, 0X7E, 0X63, 0X38,
+  0X81, 0XA9, 0XAB, 0X2A, 0X18, 0XF9, 0XE6, 0X38, 0XE9, 0XF3, 0XB1, 0XF9,
+  0X89, 0X88, 0X78, 0X82, 0X48, 0X78, 0XD2, 0X69, 0X4B, 0XEB, 0X13, 0X6A,
+  0XD0, 0X65, 0XB4, 0X9A, 0X11, 0X79, 0XEF, 0XED, 0X07, 0X6C, 0XE9, 0XED,
+  0X5A, 0X36, 0X56, 0X51, 0XED, 0XD6, 0X8C, 0XCF, 0X9E, 0X0D, 0X29, 0X1E,
+  0X55, 0X50, 0X4D, 0XA1, 0XAA, 0X27, 0X55, 0X30, 0XC8, 0XF9, 0XA7, 0X7F,
+  0XA1, 0XF5, 0XAB, 0X37, 0X5B, 0X16, 0XB0, 0X54, 0X55, 0X4A, 0XBA, 0X96,
+  0X69, 0X34, 0XD0, 0X55, 0X7F, 0X80, 0XF4, 0X23, 0XA2, 0X8F, 0X77, 0XE0,
+  0XCC, 0XCE, 0XF8, 0XEF, 0X5B, 0XF8, 0X8D, 0XF4, 0XD6, 0X3E, 0X6A, 0X02,
+  0X21, 0XB4, 0X66, 0X15, 0X12, 0X79, 0X31, 0XEC, 0XDF, 0X78, 0X97, 0XF0,
+  0X86, 0XFC, 0X5E, 0X04, 0X90, 0X69, 0X86, 0X48, 0X7F, 0X4B, 0X1E, 0X66,
+  0X8F, 0X51, 0XFC, 0X7B, 0X61, 0X07, 0X21, 0XC9, 0X55, 0XB1, 0XCB, 0X1B,
+  0X1C, 0X53, 0X7A, 0XCE, 0XC9, 0XCC, 0X96, 0XB3, 0X61, 0X4E, 0X74, 0XA2,
+  0X65, 0X0F, 0XF8, 0XE9, 0X34, 0XE0, 0X2F, 0XF9, 0X4D, 0X39, 0X8A, 0X9F,
+  0X08, 0X4F, 0XF1, 0X03, 0XE5, 0X23, 0X7E, 0X7A, 0X4F, 0X39, 0X49, 0XFA,
+  0X11, 0X5E, 0XE2, 0XA7, 0X4B, 0X41, 0X9C, 0XB6, 0X64, 0XCC, 0X82, 0XD0,
+  0X27, 0X67, 0X90, 0XF8, 0X18, 0X9E, 0X99, 0X91, 0XF9, 0X3B, 0X3C, 0XA6,
+  0XD6, 0X06, 0XD3, 0X3D, 0X44, 0X2A, 0X6E, 0XD3, 0X65, 0X58, 0XF8, 0XB3,
+  0X87, 0X0E, 0X9A, 0XA8, 0XD3, 0X95, 0X87, 0XCE, 0X20, 0XDA, 0XB8, 0XC4,
+  0XEE, 0X5D, 0XB4, 0X3C, 0XA5, 0X80, 0X0C, 0XAA, 0X68, 0X3E, 0XAC, 0XCC,
+  0X39, 0X11, 0X5F, 0X53, 0X2F, 0X5D, 0XCD, 0X20, 0X95, 0XB1, 0X0A, 0XDE,
+  0X0B, 0X66, 0X3E, 0X33, 0X66, 0X3E, 0XA3, 0X0E, 0X3A, 0X3A, 0XA5, 0X4F,
+  0X9F, 0X81, 0X62, 0XAB, 0X68, 0X05, 0X8A, 0X10, 0X84, 0XB9, 0XBC, 0X26,
+  0X2B, 0X7A, 0X13, 0XEF, 0X1C, 0X3F, 0XE8, 0X44, 0X07, 0XC4, 0X0D, 0XD0,
+  0X45, 0X3E, 0X9D, 0XB0, 0XFB, 0XB9, 0X46, 0X46, 0X4E, 0X27, 0X28, 0X0F,
+  0XD1, 0XDF, 0X60, 0XD6, 0X69, 0X08, 0X26, 0X5E, 0XD1, 0X92, 0X0E, 0X63,
+  0X72, 0X1B, 0XCE, 0XA3, 0X4A, 0X78, 0XF3, 0X75, 0X37, 0XB3, 0X94, 0X3D,
+  0X6A, 0X2A, 0X01, 0X0C, 0XAE, 0XD5, 0XEB, 0XCC, 0X3D, 0X0B, 0XF7, 0X88,
+  0X3F, 0XA0, 0X32, 0XC1, 0X8B, 0X06, 0X6D, 0X81, 0XB1, 0XB6, 0X32, 0X00,
+  0X9C, 0XC5, 0X34, 0X88, 0X42, 0XA7, 0X32, 0X11, 0X8B, 0XF6, 0X8C, 0X25,
+  0XB9, 0X10, 0X82, 0XB4, 0XC0, 0XC9, 0XFC, 0XF3, 0X9F, 0X48, 0XAB, 0X73,
+  0X4F, 0X22, 0XA8, 0XA5, 0XA0, 0X13, 0XB9, 0X5B, 0X07, 0X35, 0X22, 0XEA,
+  0X23, 0X0E, 0XA9, 0XB0, 0XAE, 0X27, 0X75, 0X2B, 0XC5, 0X81, 0X8C, 0XF2,
+  0XA0, 0XCD, 0X70, 0XBE, 0XE5, 0XB5, 0X68, 0X8E, 0X01, 0X15, 0XF0, 0X71,
+  0X16, 0XB8, 0X9A, 0XE0, 0X12, 0XAA, 0XF6, 0X91, 0X40, 0X95, 0X75, 0XBC,
+  0X2D, 0XE6, 0X78, 0X19, 0X2F, 0X8D, 0X28, 0XC8, 0XD2, 0X78, 0X2A, 0X17,
+  0X7C, 0XE2, 0X3D, 0XAD, 0X4C, 0X8D, 0X42, 0XB8, 0X3B, 0X7D, 0X51, 0XFD,
+  0X4E, 0XB1, 0XBE, 0X66, 0X05, 0X9F, 0XAB, 0X3E, 0XFE, 0XB7, 0X45, 0X0B,
+  0X12, 0X20, 0X68, 0X7C, 0X5D, 0X38, 0XE6, 0X5D, 0XC8, 0XE3, 0X00, 0X4D,
+  0X3D, 0XD8, 0X4F, 0XB6, 0X13, 0XC4, 0X1F, 0XA0, 0X6A, 0X9C, 0X7B, 0X2B,
+  0XF1, 0X6A, 0XBE, 0X84, 0X04, 0X1E, 0X3B, 0XFC, 0X49, 0X0E, 0X36, 0XF4,
+  0XA7, 0X43, 0XBD, 0X25, 0X7F, 0XCB, 0X5E, 0X1E, 0XB4, 0X6B, 0X59, 0XFA,
+  0X7B, 0XA4, 0X92, 0X08, 0X22, 0X1E, 0X56, 0X60, 0X20, 0X44, 0XC4, 0XE1,
+  0XA1, 0X88, 0XF2, 0XB6, 0X14, 0X89, 0XAF, 0X68, 0XA0, 0XB9, 0XA6, 0X78,
+  0X70, 0XBC, 0X3B, 0XC4, 0XB7, 0XEC, 0X13, 0X71, 0X6E, 0X06, 0XFD, 0X1B,
+  0X7A, 0XB8, 0X81, 0XE3, 0X4B, 0XB2, 0X1C, 0XE0, 0XA8, 0X89, 0X7E, 0X46,
+  0XDB, 0XC2, 0X96, 0X14, 0XA7, 0X88, 0X09, 0XC5, 0X0F, 0XA9, 0X08, 0X96,
+  0X8E, 0X67, 0X67, 0XF1, 0X21, 0X35, 0XDE, 0X70, 0XCD, 0XF4, 0X55, 0X14,
+  0XD5, 0XE2, 0X7C, 0X3E, 0X69, 0X62, 0X82, 0X25, 0X94, 0XC9, 0XAE, 0X78,
+  0XE4, 0XF1, 0X1C, 0X3A, 0X21, 0X04, 0XB1, 0X9B, 0X58, 0XD3, 0X6E, 0XE2,
+  0X1F, 0X0D, 0X49, 0X10, 0XDE, 0XE8, 0X4E, 0XD0, 0XC6, 0XAD, 0XA1, 0XED,
+  0X81, 0XB3, 0XD5, 0X3C, 0X2A, 0X13, 0X39, 0X01, 0XAC, 0X28, 0X74, 0XD2,
+  0XC8, 0X28, 0X7B, 0XA9, 0XD6, 0X91, 0X6E, 0XE7, 0XA6, 0XF8, 0X2B, 0X87,
+  0XD3, 0X72, 0XC1, 0XEF, 0X3F, 0X5E, 0X18, 0XFC, 0XE8, 0X36, 0X16, 0XE3,
+  0X9D, 0XE8, 0X7C, 0X82, 0X1F, 0XA2, 0X33, 0X4C, 0X22, 0X59, 0XA0, 0X6B,
+  0XEB, 0X68, 0X51, 0X3F, 0X06, 0X87, 0X69, 0XD1, 0X06, 0X3D, 0X1E, 0X1F,
+  0X23, 0X5C, 0XCF, 0XA8, 0X76, 0XE3, 0X90, 0XC1, 0XFE, 0X66, 0XA2, 0X44,
+  0X1C, 0XA5, 0X8A, 0X36, 0X04, 0X2D, 0X6E, 0XAB, 0X40, 0X5B, 0X15, 0X13,
+  0X0E, 0X9B, 0X22, 0X26, 0XD4, 0X55, 0XD1, 0XE7, 0XAD, 0X08, 0X19, 0X22,
+  0X66, 0XA8, 0X89, 0X48, 0XF3, 0X36, 0X3F, 0XA6, 0X84, 0XCA, 0XD1, 0XC6,
+  0X81, 0XF5, 0X49, 0XCD, 0X58, 0XD4, 0XF5, 0XB8, 0XB0, 0X2B, 0X78, 0X95,
+  0X78, 0XB6, 0X8B, 0X73, 0X02, 0X57, 0X17, 0X97, 0XC3, 0XF1, 0XE4, 0X7A,
+  0X34, 0X9C, 0X0E, 0XAE, 0XAF, 0X6E, 0X2E, 0X87, 0X93, 0XA1, 0X92, 0X22,
+  0XCC, 0X56, 0X1F, 0XCC, 0X05, 0X67, 0X68, 0X72, 0XA9, 0X8F, 0X48, 0XB6,
+  0X73, 0X4C, 0X7C, 0XC7, 0X26, 0XDA, 0X33, 0X3B, 0X42, 0X23, 0XB2, 0X1B,
+  0X46, 0X12, 0X6D, 0XDF, 0X7C, 0XA4, 0X6E, 0X7F, 0X84, 0X2C, 0XDB, 0X72,
+  0X7F, 0X8A, 0XC8, 0X89, 0X74, 0X04, 0X18, 0X3D, 0X70, 0XAC, 0X2B, 0X2F,
+  0X78, 0X3C, 0X81, 0X7C, 0X9C, 0XB8, 0XAA, 0X7D, 0XD4, 0X42, 0XE7, 0X03,
+  0XF8, 0XF1, 0XC7, 0X3E, 0X6A, 0X73, 0XF7, 0XA6, 0XCE, 0X2C, 0X6D, 0XB0,
+  0X18, 0XF7, 0X2E, 0XC3, 0X20, 0X1B, 0XEE, 0X76, 0X81, 0X1E, 0X79, 0X9F,
+  0X11, 0XF5, 0XA8, 0X5D, 0XF4, 0X51, 0X23, 0X14, 0X49, 0X54, 0X65, 0X14,
+  0XC9, 0X2F, 0X46, 0X51, 0XFB, 0X64, 0XB0, 0X73, 0X61, 0XBA, 0X4E, 0X0E,
+  0XF3, 0XEF, 0X13, 0X59, 0X6A, 0XA8, 0XDB, 0X8B, 0XA9, 0XFE, 0X08, 0XCE,
+  0X13, 0X75, 0X3A, 0XB4, 0XBD, 0XC8, 0XB0, 0XB8, 0X6F, 0X0A, 0X0B, 0X66,
+  0X24, 0X04, 0X2E, 0X95, 0X6A, 0XDB, 0XC2, 0XDE, 0X7A, 0XA8, 0X59, 0X34,
+  0X2B, 0X13, 0XD4, 0X34, 0XA5, 0X31, 0XD1, 0X12, 0XC2, 0X73, 0XF7, 0XAF,
+  0XF8, 0XBC, 0X16, 0X5D, 0XE4, 0X64, 0X19, 0X61, 0XC3, 0X9F, 0X9B, 0XFE,
+  0X5F, 0X5A, 0XDC, 0X25, 0X81, 0XAA, 0X27, 0X40, 0X06, 0X03, 0XEA, 0X11,
+  0X75, 0X74, 0X1A, 0X66, 0X0F, 0X95, 0XDA, 0X2A, 0X02, 0X01, 0X24, 0XBB,
+  0X06, 0X76, 0XD1, 0X8F, 0X3F, 0XA2, 0X37, 0X7A, 0XA2, 0XA2, 0X76, 0X6D,
+  0X17, 0X02, 0X2C, 0XE7, 0XC0, 0XDC, 0XC3, 0X56, 0X11, 0X04, 0X58, 0X8F,
+  0X8D, 0XE5, 0X73, 0XC5, 0XD8, 0X13, 0X93, 0X6D, 0X47, 0XEA, 0X6F, 0XB7,
+  0XC1, 0X29, 0X6C, 0X65, 0X9E, 0X43, 0XF5, 0XE8, 0X5F, 0XC2, 0XBA, 0XF6,
+  0XBC, 0X9A, 0X21, 0X46, 0XA9, 0XEB, 0XB2, 0XAD, 0X1B, 0X3C, 0X05, 0XA1,
+  0X32, 0X81, 0X6F, 0X46, 0XF1, 0X20, 0XD1, 0XF2, 0X42, 0X86, 0X64, 0X2B,
+  0X09, 0X30, 0X11, 0X68, 0XC6, 0X5B, 0XE3, 0X4E, 0XBC, 0X5A, 0X6E, 0X7D,
+  0X3D, 0XFB, 0X8C, 0XE7, 0X91, 0X71, 0X8F, 0X1F, 0X43, 0X3D, 0XBD, 0X34,
+  0X55, 0XFB, 0X98, 0X9F, 0XAC, 0X07, 0XB5, 0X4F, 0XD5, 0XD0, 0X27, 0XC5,
+  0X4E, 0XB9, 0X42, 0X48, 0XF4, 0X13, 0X9E, 0X5E, 0X99, 0XD5, 0X3F, 0X53,
+  0XB0, 0X78, 0X93, 0X5A, 0X25, 0XD9, 0X61, 0X55, 0XC9, 0X54, 0XEE, 0XBD,
+  0XB0, 0X16, 0X4A, 0X19, 0X6D, 0XFA, 0X15, 0X37, 0XE1, 0X6A, 0X05, 0X91,
+  0X9E, 0XF8, 0X7C, 0X48, 0X11, 0X1E, 0X16, 0XFC, 0X1F, 0X35, 0X98, 0X3A,
+  0XB1, 0X83, 0X04, 0XA0, 0XA0, 0X3C, 0XAA, 0X6A, 0X27, 0XD2, 0X3C, 0X12,
+  0X02, 0XBC, 0XA0, 0XB6, 0X12, 0X67, 0X55, 0X77, 0X5B, 0X5B, 0X09, 0XAC,
+  0XDF, 0XA1, 0XB6, 0X92, 0XB7, 0X6F, 0XFE, 0X4F, 0X54, 0X57, 0X7C, 0XEB,
+  0X64, 0X73, 0XA9, 0XB5, 0XA3, 0XE2, 0X2A, 0X55, 0X46, 0XB1, 0X10, 0XA1,
+  0X2A, 0XA1, 0XE2, 0XB5, 0XBE, 0X9D, 0XD7, 0X44, 0X83, 0X65, 0X61, 0XF5,
+  0XC3, 0X03, 0X96, 0XBA, 0XF2, 0XA1, 0X1E, 0XE6, 0X7F, 0X40, 0XC1, 0X73,
+  0X58, 0XAA, 0XDE, 0X39, 0XDC, 0X61, 0XB9, 0XC3, 0X4C, 0XA9, 0X4A, 0XFE,
+  0XF7, 0XFF, 0X05, 0XD2, 0X33, 0X0A, 0X24, 0X71, 0X42, 0X54, 0X67, 0XFA,
+  0X26, 0X69, 0X1D, 0X61, 0X3F, 0X3E, 0XD0, 0X0E, 0X81, 0X21, 0X7E, 0XD5,
+  0XA2, 0XAF, 0X16, 0XB6, 0X6B, 0X87, 0X4B, 0X6C, 0X51, 0X01, 0XE9, 0X91,
+  0XB7, 0X60, 0XED, 0X47, 0XF0, 0X5C, 0X3B, 0XAD, 0X92, 0XC3, 0XA4, 0X63,
+  0X5A, 0XB5, 0XA4, 0XE2, 0XED, 0XF7, 0X4A, 0X2A, 0X14, 0X2B, 0XC1, 0XB5,
+  0X17, 0X07, 0XFD, 0XB8, 0XAA, 0XDC, 0XB8, 0X00, 0X2A, 0X80, 0X8F, 0X2B,
+  0X00, 0X27, 0XE5, 0X6C, 0X35, 0XED, 0X88, 0XF3, 0XAC, 0X89, 0X7A, 0XE2,
+  0XAC, 0X57, 0XBA, 0X79, 0XD1, 0XC8, 0X95, 0X14, 0XD5, 0XEA, 0X8E, 0X97,
+  0XE6, 0X00, 0XF2, 0X25, 0X90, 0X9D, 0XA6, 0X01, 0X32, 0XE2, 0XEF, 0X90,
+  0X09, 0XD0, 0X93, 0X1F, 0XA8, 0XC4, 0X91, 0X12, 0X71, 0XDB, 0X35, 0X73,
+  0XA4, 0X47, 0XDC, 0XD9, 0XA0, 0XB7, 0X2E, 0XD1, 0X0A, 0X7C, 0X7B, 0X04,
+  0X79, 0X22, 0X32, 0XD1, 0XD7, 0XA5, 0XED, 0XE0, 0X9A, 0X61, 0XC8, 0X27,
+  0X0B, 0X76, 0X9D, 0X5F, 0X54, 0X65, 0X76, 0X4B, 0XDC, 0X8C, 0XF7, 0XC6,
+  0X14, 0XD1, 0X6E, 0XC7, 0X47, 0XE2, 0X9F, 0X15, 0X0A, 0X79, 0XEC, 0X40,
+  0X28, 0X1D, 0X10, 0X3B, 0X09, 0X36, 0X65, 0X20, 0X7C, 0X5B, 0X58, 0X5D,
+  0XD2, 0X64, 0X23, 0X90, 0XEF, 0X26, 0XCC, 0X03, 0X4C, 0XAA, 0X0C, 0XA6,
+  0X4B, 0XFD, 0XA7, 0X28, 0XF8, 0XA9, 0X60, 0XAB, 0X8A, 0XDE, 0X7F, 0X27,
+  0X77, 0X1C, 0X02, 0X7B, 0XB6, 0X8E, 0XB0, 0XAE, 0XD9, 0X96, 0X46, 0XDC,
+  0X7E, 0X83, 0X90, 0X2B, 0XD9, 0X85, 0X5F, 0XA3, 0X21, 0X13, 0X81, 0XDD,
+  0X1E, 0XE9, 0XFB, 0XFC, 0XF2, 0X6E, 0X01, 0X06, 0XCA, 0XAF, 0X35, 0XE5,
+  0XE1, 0XA9, 0X90, 0X69, 0XEB, 0XA7, 0XCD, 0XFD, 0X03, 0X40, 0XF0, 0X92,
+  0XFE, 0XB3, 0X67, 0X33, 0XC0, 0X99, 0X4F, 0X59, 0XE5, 0X33, 0XA3, 0X6C,
+  0X93, 0X05, 0X59, 0XC8, 0X40, 0X8B, 0XD5, 0X6D, 0XFA, 0XE0, 0X6C, 0XAC,
+  0X01, 0XCC, 0X44, 0X4B, 0XE7, 0XA4, 0X0B, 0X80, 0X0B, 0X52, 0X92, 0XBD,
+  0XBD, 0XDA, 0XB7, 0XC2, 0XE3, 0XC3, 0X42, 0X13, 0XE9, 0XA3, 0X0D, 0X52,
+  0X72, 0X12, 0X73, 0XFE, 0X91, 0X72, 0X7A, 0X40, 0X32, 0X93, 0X4F, 0X34,
+  0X1C, 0X9C, 0X68, 0X6A, 0X36, 0X9E, 0X4A, 0X4A, 0X32, 0XDB, 0X20, 0X0A,
+  0X1F, 0XE0, 0X94, 0X8E, 0X33, 0X9C, 0XFC, 0XF2, 0X09, 0XD5, 0X51, 0XFB,
+  0XF0, 0XB0, 0XAC, 0XE2, 0X08, 0XBE, 0X02, 0X6A, 0X25, 0X5C, 0X50, 0X0A,
+  0X59, 0XB0, 0X35, 0X09, 0X7B, 0XD1, 0X89, 0XE7, 0XAA, 0X1E, 0X91, 0X1E,
+  0X0B, 0XD3, 0X9E, 0X1F, 0XAD, 0X04, 0XDA, 0XD7, 0X8C, 0X54, 0XB1, 0X6F,
+  0XC0, 0X8E, 0X2C, 0XAE, 0X7C, 0X7C, 0X19, 0X3B, 0X46, 0XCA, 0X1E, 0XC0,
+  0X09, 0XE7, 0XEF, 0XA3, 0XBD, 0X21, 0X17, 0XD2, 0X72, 0X07, 0X79, 0X33,
+  0X50, 0XC6, 0XDC, 0X31, 0XC3, 0XF0, 0X12, 0X64, 0X02, 0XEE, 0X57, 0XDE,
+  0X17, 0X7A, 0X08, 0X98, 0XC1, 0X68, 0X35, 0XC5, 0X29, 0XA3, 0X1C, 0X82,
+  0X2E, 0X76, 0X12, 0X3E, 0X80, 0XAF, 0X04, 0X9F, 0X69, 0X59, 0X32, 0X32,
+  0X75, 0X54, 0X4E, 0XBE, 0X68, 0X81, 0XBE, 0X6D, 0X16, 0XA7, 0XAB, 0X10,
+  0X27, 0X75, 0XA4, 0X7B, 0XE4, 0X21, 0XB2, 0X1F, 0XC7, 0X3B, 0X1A, 0XFC,
+  0XE8, 0X16, 0XFD, 0X9E, 0X01, 0XDD, 0XFF, 0X83, 0XB6, 0X17, 0X1E, 0X83,
+  0X2F, 0X43, 0X21, 0X4D, 0X20, 0X5B, 0XC1, 0X3F, 0X7D, 0X8F, 0XD3, 0XCF,
+  0XEA, 0X18, 0X4E, 0XFC, 0X6E, 0X3F, 0X69, 0XD1, 0XE5, 0X1B, 0X58, 0X04,
+  0X7A, 0X1D, 0X87, 0XE4, 0XB2, 0X31, 0X3A, 0XE9, 0X41, 0XCE, 0X58, 0X49,
+  0X57, 0XC8, 0XF2, 0X56, 0X96, 0XB2, 0X56, 0XA9, 0X5F, 0X2B, 0XD5, 0X6F,
+  0XDB, 0X95, 0X41, 0XFA, 0X49, 0X8C, 0X9A, 0X41, 0XEF, 0XDE, 0XAB, 0XF1,
+  0XB5, 0X2B, 0XE1, 0X8B, 0XAF, 0X20, 0X6E, 0XC0, 0X78, 0X50, 0X8D, 0X43,
+  0X71, 0X9D, 0X20, 0X87, 0XB2, 0X62, 0X2E, 0X48, 0XFD, 0XD0, 0XCD, 0XF5,
+  0XB8, 0XC8, 0X11, 0X81, 0X29, 0XD4, 0X19, 0XCD, 0X02, 0X5F, 0X44, 0X1D,
+  0X8C, 0X7A, 0XDC, 0X94, 0X57, 0X2A, 0X72, 0XF7, 0X48, 0X77, 0X20, 0XB3,
+  0XFA, 0XFE, 0X29, 0X9D, 0X17, 0XD2, 0XA1, 0X74, 0X72, 0XD2, 0X97, 0X9E,
+  0X92, 0X61, 0XC7, 0X98, 0X53, 0X87, 0XF5, 0XF7, 0XD5, 0XB7, 0X60, 0X8B,
+  0X1C, 0X67, 0XF6, 0X9E, 0XFF, 0XEB, 0X2D, 0XF5, 0X81, 0X8B, 0X62, 0X6A,
+  0X66, 0X0B, 0X6D, 0XE0, 0X6B, 0XDB, 0XCD, 0XA6, 0X22, 0X79, 0XA8, 0XE8,
+  0X61, 0X2E, 0X5C, 0X90, 0X0E, 0X92, 0XAD, 0X79, 0XEA, 0XCB, 0X0C, 0XAA,
+  0XFB, 0X45, 0X3B, 0XBA, 0X2B, 0XF0, 0X04, 0X3E, 0X3B, 0XC4, 0XE8, 0XC5,
+  0X8C, 0X17, 0X56, 0X95, 0X4F, 0X55, 0X2D, 0X5B, 0X14, 0X84, 0XFC, 0XEB,
+  0X11, 0X45, 0XD6, 0X1D, 0XF1, 0XB1, 0X13, 0X17, 0XC9, 0XF8, 0X99, 0XF5,
+  0X3A, 0X89, 0XBD, 0X04, 0X33, 0XF9, 0X1C, 0X45, 0X03, 0X24, 0XB7, 0X5D,
+  0X4D, 0X39, 0X35, 0XB6, 0X55, 0XBA, 0XE2, 0XEB, 0X15, 0X69, 0XAB, 0XCE,
+  0X15, 0X95, 0XD2, 0X7D, 0XF8, 0X52, 0X47, 0XF6, 0X37, 0X5D, 0XC9, 0X7C,
+  0X8E, 0X8B, 0X38, 0X1F, 0XF6, 0XCF, 0X8A, 0X5C, 0X04, 0X61, 0X6E, 0X93,
+  0X77, 0X28, 0X94, 0XA9, 0XD2, 0X59, 0XEA, 0XF4, 0X1C, 0X53, 0X2C, 0X03,
+  0X8A, 0XE6, 0X29, 0X19, 0X12, 0XC5, 0X3B, 0XDB, 0XB5, 0XF0, 0X43, 0XDA,
+  0X3D, 0XE4, 0X16, 0X41, 0X3B, 0X19, 0XD2, 0X1F, 0X69, 0XA7, 0X4F, 0XD2,
+  0X69, 0X8F, 0XEC, 0X04, 0X55, 0X2C, 0X1E, 0XAA, 0X50, 0X90, 0XAE, 0X64,
+  0XD1, 0XE4, 0X53, 0X26, 0X33, 0X48, 0X18, 0X06, 0X1C, 0XE3, 0X88, 0X5C,
+  0X50, 0X33, 0X16, 0X81, 0XB7, 0X1A, 0X2C, 0XCD, 0X60, 0X40, 0XCA, 0X94,
+  0XB2, 0XC8, 0X92, 0X99, 0X20, 0XE4, 0X14, 0XA0, 0X4A, 0X89, 0X08, 0X8A,
+  0XF2, 0X97, 0X26, 0XC4, 0X67, 0X20, 0X8A, 0X27, 0XE3, 0X73, 0X30, 0X90,
+  0XE5, 0X29, 0X7D, 0X58, 0X23, 0X6B, 0X05, 0X27, 0X28, 0X59, 0XAC, 0XCB,
+  0XAC, 0XD5, 0X21, 0X5D, 0X34, 0X72, 0X3D, 0X21, 0XAD, 0X96, 0X39, 0X1C,
+  0XDD, 0X68, 0XB0, 0X2D, 0X00, 0X7A, 0X03, 0X2A, 0XB0, 0X4E, 0XE8, 0XB9,
+  0X61, 0XC8, 0XA0, 0XD8, 0X26, 0X03, 0X79, 0X18, 0X4F, 0XFA, 0XFC, 0X89,
+  0X01, 0XEA, 0XAD, 0XA3, 0XDA, 0X0F, 0XB9, 0XF3, 0X19, 0XD3, 0XB9, 0X1B,
+  0XE5, 0X0D, 0XE4, 0X34, 0XD6, 0X64, 0XFB, 0X98, 0X2E, 0X90, 0XE7, 0X8D,
+  0XF3, 0X34, 0XA7, 0XF4, 0XF6, 0XB1, 0X6A, 0XD3, 0X66, 0X65, 0XCE, 0XA7,
+  0XA6, 0XAF, 0XF0, 0X63, 0XE2, 0X25, 0XB8, 0XF9, 0X82, 0XB7, 0X94, 0X41,
+  0XC5, 0X3B, 0X85, 0X09, 0X1F, 0X6D, 0X30, 0X57, 0X7E, 0XC0, 0X96, 0X70,
+  0X51, 0XCA, 0X68, 0X73, 0X06, 0X2B, 0X10, 0X10, 0X4E, 0X4B, 0X61, 0X38,
+  0X52, 0X61, 0X79, 0XDA, 0X26, 0X43, 0X6B, 0X9B, 0X10, 0X4C, 0X1F, 0XE5,
+  0X26, 0X5E, 0X7B, 0X3B, 0X0B, 0XCF, 0XB5, 0X5F, 0X62, 0X89, 0XCC, 0XA4,
+  0XFE, 0X2D, 0XDE, 0XB6, 0XA5, 0X66, 0X44, 0XAF, 0X02, 0X24, 0X46, 0XCD,
+  0XD9, 0X4D, 0X56, 0XA0, 0X67, 0XB9, 0X15, 0XD2, 0XE7, 0XB2, 0XC0, 0X8C,
+  0X5D, 0X26, 0X26, 0X06, 0XF8, 0XB5, 0XA8, 0XC1, 0X6C, 0XCA, 0X92, 0XA3,
+  0XE6, 0XF0, 0X1A, 0XF4, 0XCE, 0XCD, 0X70, 0X39, 0X37, 0XE9, 0X9D, 0X60,
+  0XEB, 0X91, 0X58, 0XCA, 0XCA, 0X8C, 0X94, 0X8A, 0XFD, 0X39, 0X2D, 0XF9,
+  0XCF, 0X32, 0X67, 0X71, 0X03, 0XF5, 0X2D, 0X9B, 0X19, 0X95, 0X86, 0XB0,
+  0X2B, 0XFB, 0XC8, 0XA7, 0XE2, 0X20, 0X56, 0XED, 0X32, 0XD3, 0XB7, 0X1D,
+  0XBA, 0X5D, 0XEA, 0X19, 0X20, 0X93, 0X98, 0X3A, 0XB6, 0X7B, 0X5F, 0XBC,
+  0X74, 0XA6, 0X99, 0X72, 0X72, 0X12, 0X77, 0XC8, 0XAC, 0X1B, 0X92, 0XDD,
+  0X00, 0X12, 0XE3, 0X79, 0X66, 0X42, 0X97, 0XF6, 0XD5, 0XFD, 0X44, 0X84,
+  0X15, 0X7B, 0X99, 0XEC, 0X88, 0X2A, 0X64, 0X32, 0X38, 0XC3, 0X1B, 0X3B,
+  0XD2, 0X53, 0X89, 0X3B, 0XA9, 0XCB, 0X16, 0XFE, 0X18, 0X64, 0X51, 0XDF,
+  0X1C, 0X8F, 0X7C, 0XCB, 0X38, 0XC3, 0XE5, 0XB3, 0X27, 0XBE, 0XCF, 0XCC,
+  0X2F, 0XD6, 0X49, 0XFC, 0X79, 0X19, 0X66, 0X5E, 0X7E, 0X6F, 0X77, 0X44,
+  0X64, 0XB1, 0X36, 0X91, 0XC9, 0X9D, 0X53, 0X94, 0X4D, 0X65, 0X6B, 0XAE,
+  0X23, 0X22, 0X59, 0X91, 0XD7, 0X95, 0X4F, 0XAB, 0X6C, 0X74, 0XBB, 0X59,
+  0X4F, 0X0B, 0X35, 0X8C, 0X8D, 0XFE, 0X1D, 0X1D, 0X36, 0XC9, 0XDA, 0XCA,
+  0XDB, 0X5F, 0X54, 0XDE, 0X3C, 0X8D, 0X5B, 0XFB, 0XCB, 0X2D, 0XCE, 0XF3,
+  0X77, 0XA0, 0XD4, 0X00, 0X4B, 0X7B, 0X83, 0XD9, 0X43, 0X38, 0X7C, 0X83,
+  0X90, 0X00, 0XA9, 0X6F, 0X79, 0X4B, 0X92, 0XD3, 0X9F, 0XD2, 0X84, 0XE6,
+  0XD7, 0XC1, 0X74, 0XAD, 0XD9, 0X24, 0XA8, 0XE9, 0X6B, 0X23, 0XF2, 0X58,
+  0X5E, 0X47, 0X72, 0X0E, 0XA8, 0X96, 0X1C, 0X7B, 0X8E, 0XF5, 0X7A, 0X5B,
+  0X9D, 0X14, 0X17, 0X7E, 0X7C, 0X13, 0X3B, 0X65, 0XFC, 0X46, 0XE1, 0X27,
+  0X8F, 0X92, 0X9B, 0XB7, 0XA9, 0XCF, 0X27, 0XE5, 0X2E, 0XA7, 0XC6, 0XC5,
+  0X38, 0X76, 0X78, 0X3D, 0X52, 0XDB, 0XD1, 0X15, 0XD5, 0XF4, 0XF7, 0X57,
+  0X18, 0X54, 0XFA, 0X7B, 0XA8, 0X5A, 0XED, 0XB5, 0XAF, 0XAA, 0XA6, 0X78,
+  0X88, 0XE1, 0XB6, 0X73, 0X51, 0X71, 0X65, 0X02, 0X94, 0X7D, 0XA4, 0X38,
+  0X45, 0X1C, 0X97, 0X70, 0X5C, 0XF9, 0XFA, 0X47, 0XED, 0X6C, 0XD8, 0XFF,
+  0X30, 0X39, 0X9F, 0XDE, 0X5E, 0XFF, 0XFA, 0X61, 0X38, 0X25, 0X09, 0X2B,
+  0X57, 0X4C, 0X8D, 0XB8, 0X39, 0XFE, 0XF2, 0XDD, 0XED, 0X75, 0XFF, 0X6C,
+  0XD0, 0X1F, 0X4F, 0X90, 0XDE, 0X1F, 0X4C, 0XC4, 0X4B, 0X70, 0X65, 0X93,
+  0X0F, 0XB7, 0XC3, 0XE9, 0XF5, 0XE8, 0XF2, 0X4F, 0XA9, 0XDB, 0XA7, 0X57,
+  0XBD, 0X2A, 0X9B, 0X1E, 0X43, 0X9A, 0XF5, 0XBC, 0X82, 0XEE, 0X0E, 0X4B,
+  0XA9, 0X6E, 0X7C, 0X31, 0XFA, 0XF5, 0X72, 0X38, 0XA5, 0X3B, 0X8D, 0X44,
+  0X21, 0XC3, 0XF1, 0X78, 0XDA, 0XBF, 0XBC, 0X64, 0X0D, 0XE3, 0X5D, 0X29,
+  0X42, 0X79, 0XF7, 0X36, 0XA5, 0X06, 0X80, 0X78, 0X0D, 0X25, 0XB4, 0XDA,
+  0XAF, 0X6D, 0X41, 0XFC, 0XE5, 0XE0, 0XFA, 0XEA, 0XDD, 0XC5, 0X68, 0X48,
+  0X74, 0X57, 0X56, 0X69, 0X85, 0XD7, 0X87, 0X53, 0X8A, 0X11, 0X5F, 0XAE,
+  0X91, 0X6E, 0XC3, 0X97, 0X98, 0XE1, 0X4F, 0X05, 0X0B, 0X6E, 0X69, 0XB9,
+  0X4D, 0XF9, 0X89, 0XAE, 0X9F, 0X3E, 0XC7, 0X3B, 0XB2, 0X8D, 0X08, 0X29,
+  0XC1, 0X10, 0XDF, 0X9E, 0XD5, 0X72, 0XEB, 0X95, 0X32, 0X29, 0X03, 0X22,
+  0XE9, 0XD0, 0X04, 0X67, 0X99, 0XDC, 0X29, 0XA6, 0X6F, 0XF7, 0X59, 0XF1,
+  0X97, 0X71, 0X98, 0X24, 0XE4, 0XF2, 0X8F, 0XDD, 0X16, 0X27, 0X40, 0X0C,
+  0X20, 0XAB, 0X1E, 0XD6, 0X1A, 0X9B, 0X04, 0XC5, 0XAE, 0X84, 0XE0, 0XA9,
+  0X0E, 0X63, 0X43, 0X09, 0X11, 0X7F, 0X5E, 0XB7, 0X4B, 0X97, 0X69, 0X4A,
+  0XA6, 0XE6, 0X59, 0X85, 0XC9, 0X3B, 0X6E, 0X0C, 0XB1, 0XBC, 0X00, 0X91,
+  0X8A, 0X68, 0X9D, 0X86, 0XF8, 0X18, 0X63, 0XA7, 0X41, 0X3E, 0XB0, 0X4E,
+  0XBF, 0XB7, 0X4E, 0XBE, 0XB5, 0XFF, 0X5F, 0X79, 0X7C, 0X1E, 0X13, 0X82,
+  0X5F, 0X00, 0X00
 };
-unsigned int page_index_len = 3378;
+unsigned int page_index_len = 4983;
 
 #endif
@@ -11,23 +11,294 @@
  */
 #include "webserver.h"
 
-#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define LOG_LOCAL_LEVEL CONFIG_WEBSERVER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
 #include "esp_http_server.h"
 #include "esp_wifi_types.h"
+#include "esp_timer.h"
 
 #include "wifi_controller.h"
 #include "attack.h"
 #include "pcap_serializer.h"
 #include "hccapx_serializer.h"
+#include "frame_analyzer.h"
+#include "station_inventory.h"
+#include "capture_filter.h"
+#include "capture_log.h"
+#include "result_history.h"
+#include "gzip_stream.h"
+#include "crc32.h"
+#include "metrics.h"
+#include "frame_trace.h"
+#include "binary_log.h"
+#include "task_topology.h"
+#include "display.h"
+#include "buttons.h"
 
 #include "pages/page_index.h"
 
 static const char* TAG = "webserver";
 ESP_EVENT_DEFINE_BASE(WEBSERVER_EVENTS);
 
+/**
+ * @brief Metrics of HTTP handlers
+ * @{
+ */
+METRICS_COUNTER_DEFINE(metric_requests, "http_requests_total", NULL, "HTTP requests handled");
+METRICS_COUNTER_DEFINE(metric_failed_requests, "http_failed_requests_total", NULL, "HTTP requests whose handler returned error");
+static const uint32_t request_duration_bounds[] = { 1, 5, 10, 50, 100, 500, 1000, 5000 };
+METRICS_HISTOGRAM_DEFINE(metric_request_duration, "http_request_duration_ms", NULL, "Time spent in HTTP handler including sending response", request_duration_bounds);
+//@}
+
+/**
+ * @brief Chunked response body that is gzip compressed on the fly if client accepts it
+ * @{
+ */
+typedef struct {
+    httpd_req_t *req;
+    gzip_stream_t *gzip;    //< NULL if response is sent uncompressed
+} response_t;
+
+static esp_err_t response_send_chunk(void *ctx, const uint8_t *data, unsigned length){
+    return httpd_resp_send_chunk((httpd_req_t *) ctx, (const char *) data, length);
+}
+
+static bool accepts_gzip(httpd_req_t *req){
+    char accept_encoding[64];
+    if(httpd_req_get_hdr_value_str(req, "Accept-Encoding", accept_encoding, sizeof(accept_encoding)) != ESP_OK){
+        return false;
+    }
+    return strstr(accept_encoding, "gzip") != NULL;
+}
+
+/**
+ * @brief Starts response body. Has to be called after content type is set.
+ *
+ * Falls back to uncompressed response if compressor state cannot be allocated.
+ */
+static void response_begin(response_t *response, httpd_req_t *req){
+    response->req = req;
+    response->gzip = NULL;
+    httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+    if(!accepts_gzip(req)){
+        return;
+    }
+    response->gzip = (gzip_stream_t *) malloc(sizeof(gzip_stream_t));
+    if(response->gzip == NULL){
+        ESP_LOGW(TAG, "Not enough memory for compression, sending uncompressed");
+        return;
+    }
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    gzip_stream_init(response->gzip, response_send_chunk, req);
+}
+
+static esp_err_t response_write(response_t *response, const void *data, unsigned length){
+    if(response->gzip != NULL){
+        return gzip_stream_write(response->gzip, (const uint8_t *) data, length);
+    }
+    return httpd_resp_send_chunk(response->req, (const char *) data, length);
+}
+
+/**
+ * @brief Finishes response body and releases compressor. Has to be called even if previous write failed.
+ *
+ * @param response
+ * @param err result of previous writes, response is terminated only if it is ESP_OK
+ */
+static esp_err_t response_end(response_t *response, esp_err_t err){
+    if(response->gzip != NULL){
+        if(err == ESP_OK){
+            err = gzip_stream_finish(response->gzip);
+        }
+        free(response->gzip);
+        response->gzip = NULL;
+    }
+    if(err != ESP_OK){
+        return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(response->req, NULL, 0);
+}
+//@}
+
+/**
+ * @brief Single byte range support for resumable downloads (RFC 7233)
+ *
+ * Partial responses are never compressed, so the range always refers to uncompressed body.
+ * Compressed full responses carry different entity tag, so they are never mixed with partial ones.
+ * @{
+ */
+typedef struct {
+    uint32_t start;
+    uint32_t end;       //< exclusive
+    bool partial;
+} byte_range_t;
+
+/**
+ * @brief Header values have to stay valid until response is sent. Only one request is handled at a time.
+ */
+//@{
+static char etag_header[32];
+static char content_range_header[48];
+static char milestones_header[ATTACK_MILESTONE_MAX * 26];
+//@}
+
+/**
+ * @brief Reads Range header if it applies to current representation.
+ *
+ * @param req
+ * @param etag entity tag of current representation, NULL if range requests are not supported
+ * @param range_header output buffer
+ * @param size size of output buffer
+ * @return true if range was requested and If-Range (if any) matches \c etag
+ */
+static bool range_header_get(httpd_req_t *req, const char *etag, char *range_header, unsigned size){
+    if((etag == NULL) || (httpd_req_get_hdr_value_str(req, "Range", range_header, size) != ESP_OK)){
+        return false;
+    }
+    char if_range[sizeof(etag_header)];
+    if(httpd_req_get_hdr_value_len(req, "If-Range") > 0){
+        // only strong entity tags are issued, so anything else (including dates) doesn't match
+        if((httpd_req_get_hdr_value_str(req, "If-Range", if_range, sizeof(if_range)) != ESP_OK) || (strcmp(if_range, etag) != 0)){
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Resolves range header against size of body.
+ *
+ * Unsupported forms (multiple ranges, other units) and syntactically invalid ranges are ignored
+ * and whole body is sent as allowed by RFC 7233.
+ *
+ * @return esp_err_t
+ *  - ESP_OK if range is filled (partial or whole body)
+ *  - ESP_ERR_INVALID_SIZE if range is not satisfiable
+ */
+static esp_err_t range_resolve(const char *range_header, uint32_t size, byte_range_t *range){
+    range->start = 0;
+    range->end = size;
+    range->partial = false;
+    if((range_header == NULL) || (strncmp(range_header, "bytes=", 6) != 0) || (strchr(range_header, ',') != NULL)){
+        return ESP_OK;
+    }
+    const char *spec = &range_header[6];
+    char *end;
+    if(*spec == '-'){
+        unsigned long suffix = strtoul(&spec[1], &end, 10);
+        if((end == &spec[1]) || (*end != '\0')){
+            return ESP_OK;
+        }
+        if((suffix == 0) || (size == 0)){
+            return ESP_ERR_INVALID_SIZE;
+        }
+        range->start = (suffix < size) ? size - suffix : 0;
+    }
+    else {
+        unsigned long first = strtoul(spec, &end, 10);
+        if((end == spec) || (*end != '-')){
+            return ESP_OK;
+        }
+        const char *last_str = &end[1];
+        if(*last_str != '\0'){
+            unsigned long last = strtoul(last_str, &end, 10);
+            if((end == last_str) || (*end != '\0') || (last < first)){
+                return ESP_OK;
+            }
+            if(last < size){
+                range->end = last + 1;
+            }
+        }
+        if(first >= size){
+            return ESP_ERR_INVALID_SIZE;
+        }
+        range->start = first;
+    }
+    range->partial = true;
+    return ESP_OK;
+}
+
+/**
+ * @brief Starts response body with range headers. Has to be called after content type is set.
+ *
+ * @param response
+ * @param req
+ * @param etag entity tag of current representation, NULL if range requests are not supported
+ * @param range_header value of Range header, NULL if whole body is requested
+ * @param size size of uncompressed body, may be UINT32_MAX if unknown and \c range_header is NULL
+ * @param range output range of body to send
+ * @return esp_err_t
+ *  - ESP_OK if response was started
+ *  - ESP_ERR_INVALID_SIZE if range is not satisfiable, 416 response was already sent
+ */
+static esp_err_t response_begin_range(response_t *response, httpd_req_t *req, const char *etag, const char *range_header,
+    uint32_t size, byte_range_t *range){
+    if(range_resolve(range_header, size, range) != ESP_OK){
+        snprintf(content_range_header, sizeof(content_range_header), "bytes */%u", size);
+        httpd_resp_set_status(req, "416 Range Not Satisfiable");
+        httpd_resp_set_hdr(req, "Content-Range", content_range_header);
+        httpd_resp_send(req, NULL, 0);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if(range->partial){
+        snprintf(content_range_header, sizeof(content_range_header), "bytes %u-%u/%u", range->start, range->end - 1, size);
+        httpd_resp_set_status(req, "206 Partial Content");
+        httpd_resp_set_hdr(req, "Content-Range", content_range_header);
+        response->req = req;
+        response->gzip = NULL;
+    }
+    else {
+        response_begin(response, req);
+    }
+    if(etag == NULL){
+        return ESP_OK;
+    }
+    httpd_resp_set_hdr(req, "Accept-Ranges", "bytes");
+    if(response->gzip != NULL){
+        // "<tag>" -> "<tag>-gz"
+        snprintf(etag_header, sizeof(etag_header), "%.*s-gz\"", (int) strlen(etag) - 1, etag);
+    }
+    else {
+        snprintf(etag_header, sizeof(etag_header), "%s", etag);
+    }
+    httpd_resp_set_hdr(req, "ETag", etag_header);
+    return ESP_OK;
+}
+
+/**
+ * @brief Formats strong entity tag from two values identifying representation (e.g. CRC32 and size)
+ */
+static void etag_format(char *etag, unsigned size, uint32_t first, uint32_t second){
+    snprintf(etag, size, "\"%08x-%x\"", first, second);
+}
+
+/**
+ * @brief Writes part of data that overlaps with range.
+ *
+ * @param response
+ * @param range
+ * @param position offset of data within whole body, advanced by \c length
+ * @param data
+ * @param length
+ */
+static esp_err_t response_write_range(response_t *response, const byte_range_t *range, uint32_t *position, const void *data, unsigned length){
+    uint32_t start = *position;
+    uint32_t end = start + length;
+    *position = end;
+    if((end <= range->start) || (start >= range->end)){
+        return ESP_OK;
+    }
+    uint32_t from = (start < range->start) ? range->start : start;
+    uint32_t to = (end > range->end) ? range->end : end;
+    return response_write(response, (const uint8_t *) data + (from - start), to - from);
+}
+//@}
+
 /**
  * @brief Handlers for index/root \c / path endpoint
  *
@@ -137,23 +408,41 @@ static httpd_uri_t uri_run_attack_post = {
  * @brief Handlers for \c /status endpoint
  *
  * This endpoint fetches current status from main component attack wrapper, serialize it and sends it to client as octet stream.
+ * Milestones reached by the last attack run are sent in \c X-Attack-Milestones header as comma separated
+ * \c name=ms pairs, where ms is time since attack start.
  * @param req
  * @return esp_err_t
  * @{
  */
 static esp_err_t uri_status_get_handler(httpd_req_t *req) {
     ESP_LOGD(TAG, "Fetching attack status...");
-    const attack_status_t *attack_status;
-    attack_status = attack_get_status();
+    // snapshot keeps header consistent and content alive while it's being sent
+    attack_status_snapshot_t snapshot;
+    attack_status_acquire(&snapshot);
+    const attack_status_t *attack_status = &snapshot.status;
+
+    uint32_t milestones[ATTACK_MILESTONE_MAX];
+    attack_get_milestones(milestones);
+    char *end = milestones_header;
+    *end = '\0';
+    for(unsigned i = 0; i < ATTACK_MILESTONE_MAX; i++){
+        if(milestones[i] != ATTACK_MILESTONE_NOT_REACHED){
+            end += sprintf(end, "%s%s=%u", (end == milestones_header) ? "" : ",", attack_milestone_name(i), milestones[i]);
+        }
+    }
 
     ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
+    ESP_ERROR_CHECK(httpd_resp_set_hdr(req, "X-Attack-Milestones", milestones_header));
+    response_t response;
+    response_begin(&response, req);
     // first send attack result header
-    ESP_ERROR_CHECK(httpd_resp_send_chunk(req, (char *) attack_status, 4));
+    esp_err_t err = response_write(&response, attack_status, 4);
     // send attack result content
-    if(((attack_status->state == FINISHED) || (attack_status->state == TIMEOUT)) && (attack_status->content_size > 0)){
-        ESP_ERROR_CHECK(httpd_resp_send_chunk(req, attack_status->content, attack_status->content_size));
+    if((err == ESP_OK) && ((attack_status->state == FINISHED) || (attack_status->state == TIMEOUT)) && (attack_status->content_size > 0)){
+        err = response_write(&response, attack_status->content, attack_status->content_size);
     }
-    return httpd_resp_send_chunk(req, NULL, 0);
+    attack_status_release(&snapshot);
+    return response_end(&response, err);
 }
 
 static httpd_uri_t uri_status_get = {
@@ -176,8 +465,20 @@ static httpd_uri_t uri_status_get = {
  */
 static esp_err_t uri_capture_pcap_get_handler(httpd_req_t *req){
     ESP_LOGD(TAG, "Providing PCAP file...");
+    const uint8_t *buffer = pcap_serializer_get_buffer();
+    unsigned size = pcap_serializer_get_size();
+    char etag[24];
+    etag_format(etag, sizeof(etag), crc32_update(0, buffer, size), size);
+    char range_header[48];
+    bool has_range = range_header_get(req, etag, range_header, sizeof(range_header));
+
     ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
-    return httpd_resp_send(req, (char *) pcap_serializer_get_buffer(), pcap_serializer_get_size());
+    response_t response;
+    byte_range_t range;
+    if(response_begin_range(&response, req, etag, has_range ? range_header : NULL, size, &range) != ESP_OK){
+        return ESP_OK;
+    }
+    return response_end(&response, response_write(&response, &buffer[range.start], range.end - range.start));
 }
 
 static httpd_uri_t uri_capture_pcap_get = {
@@ -192,6 +493,7 @@ static httpd_uri_t uri_capture_pcap_get = {
  * @brief Handlers for \c /capture.hccapx endpoint
  *
  * This endpoint forwards HCCAPX binary data from hccapx_serializer via octet stream to client.
+ * Records of all ranked message pairs are concatenated, the best pair comes first.
  *
  * @note Most browsers will start download process when this endpoint is called.
  * @param req
@@ -200,8 +502,29 @@ static httpd_uri_t uri_capture_pcap_get = {
  */
 static esp_err_t uri_capture_hccapx_get_handler(httpd_req_t *req){
     ESP_LOGD(TAG, "Providing HCCAPX file...");
+    // best pair first, followed by alternates; ETag and body come from the same snapshot
+    static hccapx_t pairs[CONFIG_HCCAPX_MAX_PAIRS];
+    unsigned pair_count = hccapx_serializer_get_pairs(pairs, CONFIG_HCCAPX_MAX_PAIRS);
+    uint32_t crc = crc32_update(0, (const uint8_t *) pairs, pair_count * sizeof(hccapx_t));
+    char etag[24];
+    etag_format(etag, sizeof(etag), crc, pair_count * sizeof(hccapx_t));
+    char range_header[48];
+    bool has_range = range_header_get(req, etag, range_header, sizeof(range_header));
+
     ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
-    return httpd_resp_send(req, (char *) hccapx_serializer_get(), sizeof(hccapx_t));
+    response_t response;
+    byte_range_t range;
+    if(response_begin_range(&response, req, etag, has_range ? range_header : NULL, pair_count * sizeof(hccapx_t), &range) != ESP_OK){
+        return ESP_OK;
+    }
+    // records have fixed size, so the first record of range is found directly
+    unsigned first_rank = range.start / sizeof(hccapx_t);
+    uint32_t position = first_rank * sizeof(hccapx_t);
+    esp_err_t err = ESP_OK;
+    for(unsigned rank = first_rank; (rank < pair_count) && (position < range.end) && (err == ESP_OK); rank++){
+        err = response_write_range(&response, &range, &position, &pairs[rank], sizeof(hccapx_t));
+    }
+    return response_end(&response, err);
 }
 
 static httpd_uri_t uri_capture_hccapx_get = {
@@ -212,18 +535,681 @@ static httpd_uri_t uri_capture_hccapx_get = {
 };
 //@}
 
+/**
+ * @brief Handlers for \c /stations endpoint
+ *
+ * This endpoint streams station inventory of current (or last) attack as octet stream.
+ * Every station is sent as separate chunk, so no buffer for whole inventory is needed.
+ * 
+ * Station record format (30 bytes, multi-byte values in little endian):
+ * MAC (6) + BSSID (6) + RSSI (1, 0 if unknown) + EAPoL seen (1) + frames (4) + bytes (4) + first seen ms (4) + last seen ms (4)
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_stations_get_handler(httpd_req_t *req){
+    char resp_chunk[30];
+
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
+    station_entry_t station;
+    for(unsigned i = 0; i < station_inventory_capacity(); i++){
+        if(!station_inventory_get(i, &station)){
+            continue;
+        }
+        mac_store(station.mac, (uint8_t *) resp_chunk);
+        memcpy(&resp_chunk[6], station.bssid, 6);
+        resp_chunk[12] = station_inventory_rssi(&station);
+        resp_chunk[13] = station.eapol_seen;
+        memcpy(&resp_chunk[14], &station.frames, 4);
+        memcpy(&resp_chunk[18], &station.bytes, 4);
+        memcpy(&resp_chunk[22], &station.first_seen, 4);
+        memcpy(&resp_chunk[26], &station.last_seen, 4);
+        if(httpd_resp_send_chunk(req, resp_chunk, sizeof(resp_chunk)) != ESP_OK){
+            return ESP_FAIL;
+        }
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static httpd_uri_t uri_stations_get = {
+    .uri = "/stations",
+    .method = HTTP_GET,
+    .handler = uri_stations_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Handlers for \c /capture-filter endpoint
+ *
+ * This endpoint sets capture filter of sniffer. Request body is either filter expression as plain text
+ * compiled on device, or precompiled bytecode (array of capture_filter_insn_t) when Content-Type is
+ * \c application/octet-stream. Empty body clears the filter.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_capture_filter_post_handler(httpd_req_t *req){
+    // enough for text expression of maximum length program as well as for its bytecode
+    static char body[CONFIG_CAPTURE_FILTER_MAX_INSNS * 24];
+    static capture_filter_t filter;
+
+    if(req->content_len >= sizeof(body)){
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Filter too long");
+    }
+    unsigned received = 0;
+    while(received < req->content_len){
+        int ret = httpd_req_recv(req, &body[received], req->content_len - received);
+        if(ret <= 0){
+            return ESP_FAIL;
+        }
+        received += ret;
+    }
+    body[received] = '\0';
+
+    char content_type[32] = "";
+    httpd_req_get_hdr_value_str(req, "Content-Type", content_type, sizeof(content_type));
+    esp_err_t err;
+    if(strcmp(content_type, HTTPD_TYPE_OCTET) == 0){
+        err = capture_filter_load((uint8_t *) body, received, &filter);
+    } 
+    else {
+        err = capture_filter_compile(body, &filter);
+    }
+    if(err != ESP_OK){
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid filter");
+    }
+    wifictl_sniffer_set_capture_filter(&filter);
+    return httpd_resp_send(req, NULL, 0);
+}
+
+static httpd_uri_t uri_capture_filter_post = {
+    .uri = "/capture-filter",
+    .method = HTTP_POST,
+    .handler = uri_capture_filter_post_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Handlers for \c /capture-log endpoint
+ *
+ * This endpoint streams index of sessions stored in persistent capture log, newest session first.
+ *
+ * Session record format (56 bytes, multi-byte values in little endian):
+ * ID (2) + flags (1) + status (1) + attack type (1) + attack method (1) + channel (1) + BSSID (6) 
+ * + SSID length (1) + SSID (32) + frames (2) + HCCAPX records (2) + PMKIDs (2) + bytes (4)
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_capture_log_get_handler(httpd_req_t *req){
+    static capture_log_session_t sessions[CONFIG_CAPTURE_LOG_MAX_SESSIONS];
+    char resp_chunk[56];
+
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
+    unsigned count = capture_log_get_sessions(sessions, CONFIG_CAPTURE_LOG_MAX_SESSIONS);
+    for(unsigned i = 0; i < count; i++){
+        const capture_log_session_t *session = &sessions[i];
+        memcpy(&resp_chunk[0], &session->id, 2);
+        resp_chunk[2] = session->flags;
+        resp_chunk[3] = session->status;
+        // session info is packed in the same order
+        memcpy(&resp_chunk[4], &session->info, sizeof(capture_log_session_info_t));
+        memcpy(&resp_chunk[46], &session->frames, 2);
+        memcpy(&resp_chunk[48], &session->hccapx, 2);
+        memcpy(&resp_chunk[50], &session->pmkids, 2);
+        memcpy(&resp_chunk[52], &session->bytes, 4);
+        if(httpd_resp_send_chunk(req, resp_chunk, sizeof(resp_chunk)) != ESP_OK){
+            return ESP_FAIL;
+        }
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static httpd_uri_t uri_capture_log_get = {
+    .uri = "/capture-log",
+    .method = HTTP_GET,
+    .handler = uri_capture_log_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Handlers for \c /capture-log/<id>.pcap endpoint
+ *
+ * This endpoint streams frames of one session from persistent capture log as PCAP file.
+ * Frames are read from flash record by record, so the session doesn't have to fit into RAM.
+ *
+ * Finished sessions support range requests. Seek index of the last requested session is kept,
+ * so resumed download continues from the nearest sector instead of reading the session from its start.
+ *
+ * @note Most browsers will start download process when this endpoint is called.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static capture_log_seek_index_t seek_index;
+
+/**
+ * @brief Returns offset in PCAP file after given number of frames from capture log
+ */
+static uint32_t pcap_offset(uint32_t frames, uint32_t frame_bytes){
+    return sizeof(pcap_global_header_t) + frames * PCAP_SERIALIZER_RECORD_HEADER_SIZE + frame_bytes;
+}
+
+static esp_err_t uri_capture_log_session_get_handler(httpd_req_t *req){
+    const char *id_str = &req->uri[sizeof("/capture-log/") - 1];
+    char *end;
+    unsigned long session_id = strtoul(id_str, &end, 10);
+    if((end == id_str) || (strcmp(end, ".pcap") != 0) || (session_id > UINT16_MAX)){
+        return httpd_resp_send_404(req);
+    }
+    capture_log_session_t session;
+    capture_log_iterator_t iterator;
+    if((capture_log_get_session(session_id, &session) != ESP_OK) || (capture_log_iterator_init(session_id, &iterator) != ESP_OK)){
+        return httpd_resp_send_404(req);
+    }
+    uint8_t *payload = (uint8_t *) malloc(CAPTURE_LOG_MAX_PAYLOAD);
+    if(payload == NULL){
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
+    }
+
+    // session being written changes, so ranges are supported only for finished sessions
+    char etag[24];
+    etag_format(etag, sizeof(etag), session.start_sequence, session.id);
+    bool immutable = !(session.flags & CAPTURE_LOG_SESSION_ACTIVE);
+    char range_header[48];
+    bool has_range = range_header_get(req, immutable ? etag : NULL, range_header, sizeof(range_header));
+    uint32_t size = UINT32_MAX;
+    const capture_log_seek_point_t *seek_point = NULL;
+    if(has_range){
+        if(((seek_index.session_id != session.id) || (seek_index.start_sequence != session.start_sequence))
+            && (capture_log_seek_index_build(session.id, &seek_index, payload) != ESP_OK)){
+            seek_index.session_id = 0;
+            has_range = false;
+        }
+        else {
+            size = pcap_offset(seek_index.frames, seek_index.frame_bytes);
+        }
+    }
+
+    ESP_LOGD(TAG, "Providing PCAP of capture log session %lu...", session_id);
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
+    response_t response;
+    byte_range_t range;
+    if(response_begin_range(&response, req, immutable ? etag : NULL, has_range ? range_header : NULL, size, &range) != ESP_OK){
+        free(payload);
+        return ESP_OK;
+    }
+    if(range.partial){
+        seek_point = &seek_index.points[0];
+        for(unsigned i = 1; (i < seek_index.count) && (pcap_offset(seek_index.points[i].frames, seek_index.points[i].frame_bytes) <= range.start); i++){
+            seek_point = &seek_index.points[i];
+        }
+    }
+    uint32_t position = 0;
+    esp_err_t err = ESP_OK;
+    if((seek_point == NULL) || (seek_point == &seek_index.points[0])){
+        pcap_global_header_t global_header;
+        pcap_serializer_write_global_header(&global_header);
+        err = response_write_range(&response, &range, &position, &global_header, sizeof(global_header));
+    }
+    else {
+        iterator = seek_point->iterator;
+        position = pcap_offset(seek_point->frames, seek_point->frame_bytes);
+    }
+    capture_log_record_header_t header;
+    while((err == ESP_OK) && (position < range.end) && (capture_log_iterator_next(&iterator, &header, payload) == ESP_OK)){
+        if((header.type != CAPTURE_LOG_RECORD_FRAME) || (header.length <= sizeof(capture_log_frame_t))){
+            continue;
+        }
+        const capture_log_frame_t *frame_info = (const capture_log_frame_t *) payload;
+        pcap_frame_info_t pcap_frame_info = { .channel = frame_info->channel, .rssi = frame_info->rssi, .fcs = true };
+        uint8_t record_header[PCAP_SERIALIZER_RECORD_HEADER_SIZE];
+        unsigned frame_size = pcap_serializer_write_record_header(record_header, header.length - sizeof(capture_log_frame_t),
+            frame_info->ts_usec, &pcap_frame_info);
+        err = response_write_range(&response, &range, &position, record_header, sizeof(record_header));
+        if(err == ESP_OK){
+            err = response_write_range(&response, &range, &position, &payload[sizeof(capture_log_frame_t)], frame_size);
+        }
+    }
+    free(payload);
+    return response_end(&response, err);
+}
+
+static httpd_uri_t uri_capture_log_session_get = {
+    .uri = "/capture-log/*",
+    .method = HTTP_GET,
+    .handler = uri_capture_log_session_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Handlers for \c /sessions endpoint
+ *
+ * This endpoint provides metadata of attack sessions in result history, newest session first.
+ *
+ * Session record format (106 bytes, multi-byte values in little endian):
+ * ID (2) + flags (1, bit N set if payload N didn't fit into memory: 0 PCAP, 1 HCCAPX, 2 PMKIDs) + attack type (1) + attack method (1) + outcome (1) + channel (1) + BSSID (6) + SSID length (1) 
+ * + SSID (32) + start ms (4) + end ms (4) + frames (2) + handshakes (2) + PMKIDs (2) + capture log session ID (2) + PCAP size (4)
+ * + milestones (10 * 4, ms since start in attack_milestone_t order, 0xffffffff if not reached)
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_sessions_get_handler(httpd_req_t *req){
+    #define SESSION_RECORD_SIZE (66 + RESULT_HISTORY_MILESTONES * 4)
+    // records are copied under history lock and sent after it's released, so slow client doesn't block attack
+    static char resp[CONFIG_RESULT_HISTORY_MAX_SESSIONS * SESSION_RECORD_SIZE];
+    unsigned resp_size = 0;
+
+    result_history_lock();
+    for(unsigned i = 0; i < result_history_count(); i++){
+        const result_history_session_t *session = result_history_get(i);
+        const result_history_meta_t *meta = &session->meta;
+        char *resp_chunk = &resp[resp_size];
+        memcpy(&resp_chunk[0], &meta->id, 2);
+        resp_chunk[2] = meta->flags;
+        resp_chunk[3] = meta->attack_type;
+        resp_chunk[4] = meta->attack_method;
+        resp_chunk[5] = meta->outcome;
+        resp_chunk[6] = meta->channel;
+        memcpy(&resp_chunk[7], meta->bssid, 6);
+        resp_chunk[13] = meta->ssid_length;
+        memcpy(&resp_chunk[14], meta->ssid, 32);
+        memcpy(&resp_chunk[46], &meta->start_time, 4);
+        memcpy(&resp_chunk[50], &meta->end_time, 4);
+        memcpy(&resp_chunk[54], &meta->frames, 2);
+        memcpy(&resp_chunk[56], &meta->handshakes, 2);
+        memcpy(&resp_chunk[58], &meta->pmkids, 2);
+        memcpy(&resp_chunk[60], &meta->log_session_id, 2);
+        memcpy(&resp_chunk[62], &session->payload_sizes[RESULT_HISTORY_PAYLOAD_PCAP], 4);
+        memcpy(&resp_chunk[66], meta->milestones, sizeof(meta->milestones));
+        resp_size += SESSION_RECORD_SIZE;
+    }
+    result_history_unlock();
+    #undef SESSION_RECORD_SIZE
+
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
+    return httpd_resp_send(req, resp, resp_size);
+}
+
+static httpd_uri_t uri_sessions_get = {
+    .uri = "/sessions",
+    .method = HTTP_GET,
+    .handler = uri_sessions_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Appends lowercase hex representation of data to string
+ *
+ * @param out end of string, must have space for 2 * length + 1 characters
+ * @param data
+ * @param length
+ * @return char* new end of string
+ */
+static char *append_hex(char *out, const uint8_t *data, unsigned length){
+    static const char digits[] = "0123456789abcdef";
+    for(unsigned i = 0; i < length; i++){
+        *out++ = digits[data[i] >> 4];
+        *out++ = digits[data[i] & 0x0f];
+    }
+    *out = '\0';
+    return out;
+}
+
+/**
+ * @brief Streams PMKIDs and handshakes of session as hashcat 22000 hash lines
+ *
+ * PMKID line: \c WPA*01*PMKID*MAC_AP*MAC_STA*ESSID***
+ * EAPoL line: \c WPA*02*MIC*MAC_AP*MAC_STA*ESSID*ANONCE*EAPOL*MESSAGE_PAIR
+ *
+ * @see Ref: https://hashcat.net/wiki/doku.php?id=cracking_wpawpa2
+ * @param req
+ * @param session acquired session
+ * @return esp_err_t
+ */
+static esp_err_t send_session_22000(httpd_req_t *req, const result_history_session_t *session){
+    // the longest line is EAPoL line with 256 bytes of EAPoL in hex
+    static char line[800];
+    esp_err_t err = ESP_OK;
+
+    const pmkid_record_t *pmkids = (const pmkid_record_t *) session->payloads[RESULT_HISTORY_PAYLOAD_PMKID];
+    unsigned pmkid_count = session->payload_sizes[RESULT_HISTORY_PAYLOAD_PMKID] / sizeof(pmkid_record_t);
+    for(unsigned i = 0; (i < pmkid_count) && (err == ESP_OK); i++){
+        char *end = line + sprintf(line, "WPA*01*");
+        end = append_hex(end, pmkids[i].pmkid, PMKID_LEN);
+        *end++ = '*';
+        end = append_hex(end, pmkids[i].mac_ap, 6);
+        *end++ = '*';
+        end = append_hex(end, pmkids[i].mac_sta, 6);
+        *end++ = '*';
+        end = append_hex(end, session->meta.ssid, session->meta.ssid_length);
+        strcpy(end, "***\n");
+        err = httpd_resp_sendstr_chunk(req, line);
+    }
+
+    const hccapx_t *hccapx = (const hccapx_t *) session->payloads[RESULT_HISTORY_PAYLOAD_HCCAPX];
+    unsigned hccapx_count = session->payload_sizes[RESULT_HISTORY_PAYLOAD_HCCAPX] / sizeof(hccapx_t);
+    for(unsigned i = 0; (i < hccapx_count) && (err == ESP_OK); i++){
+        unsigned eapol_len = (hccapx[i].eapol_len > sizeof(hccapx[i].eapol)) ? sizeof(hccapx[i].eapol) : hccapx[i].eapol_len;
+        char *end = line + sprintf(line, "WPA*02*");
+        end = append_hex(end, hccapx[i].keymic, sizeof(hccapx[i].keymic));
+        *end++ = '*';
+        end = append_hex(end, hccapx[i].mac_ap, 6);
+        *end++ = '*';
+        end = append_hex(end, hccapx[i].mac_sta, 6);
+        *end++ = '*';
+        end = append_hex(end, hccapx[i].essid, (hccapx[i].essid_len > 32) ? 32 : hccapx[i].essid_len);
+        *end++ = '*';
+        end = append_hex(end, hccapx[i].nonce_ap, sizeof(hccapx[i].nonce_ap));
+        *end++ = '*';
+        end = append_hex(end, hccapx[i].eapol, eapol_len);
+        sprintf(end, "*%02x\n", hccapx[i].message_pair);
+        err = httpd_resp_sendstr_chunk(req, line);
+    }
+    return err;
+}
+
+/**
+ * @brief Handlers for \c /sessions/<id>/<format> endpoint
+ *
+ * This endpoint provides results of one session from result history. Available formats:
+ * - \c pcap - captured frames as PCAP file
+ * - \c hccapx - ranked handshake message pairs as HCCAPX file
+ * - \c 22000 - PMKIDs and handshakes as hashcat 22000 hash lines
+ *
+ * Payload that didn't fit into result history is reported by 404. Session is referenced while being sent,
+ * so result history stays unlocked.
+ * @note Most browsers will start download process when this endpoint is called.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_session_get_handler(httpd_req_t *req){
+    const char *id_str = &req->uri[sizeof("/sessions/") - 1];
+    char *format;
+    unsigned long id = strtoul(id_str, &format, 10);
+    if((format == id_str) || (*format != '/') || (id > UINT16_MAX)){
+        return httpd_resp_send_404(req);
+    }
+    format++;
+
+    const result_history_session_t *session = result_history_acquire(id);
+    esp_err_t err;
+    if(session == NULL){
+        err = httpd_resp_send_404(req);
+    }
+    else if(strcmp(format, "pcap") == 0){
+        if(session->meta.flags & RESULT_HISTORY_MISSING(RESULT_HISTORY_PAYLOAD_PCAP)){
+            err = httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "PCAP didn't fit into result history");
+        }
+        else {
+            httpd_resp_set_type(req, HTTPD_TYPE_OCTET);
+            response_t response;
+            response_begin(&response, req);
+            err = response_end(&response, response_write(&response, session->payloads[RESULT_HISTORY_PAYLOAD_PCAP], session->payload_sizes[RESULT_HISTORY_PAYLOAD_PCAP]));
+        }
+    }
+    else if(strcmp(format, "hccapx") == 0){
+        if(session->meta.flags & RESULT_HISTORY_MISSING(RESULT_HISTORY_PAYLOAD_HCCAPX)){
+            err = httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "HCCAPX didn't fit into result history");
+        }
+        else {
+            httpd_resp_set_type(req, HTTPD_TYPE_OCTET);
+            err = httpd_resp_send(req, (char *) session->payloads[RESULT_HISTORY_PAYLOAD_HCCAPX], session->payload_sizes[RESULT_HISTORY_PAYLOAD_HCCAPX]);
+        }
+    }
+    else if(strcmp(format, "22000") == 0){
+        // hashes of payload that is present are useful on their own, missing payload is reported by session flags
+        httpd_resp_set_type(req, "text/plain");
+        err = send_session_22000(req, session);
+        if(err == ESP_OK){
+            err = httpd_resp_send_chunk(req, NULL, 0);
+        }
+    }
+    else {
+        err = httpd_resp_send_404(req);
+    }
+    result_history_release(session);
+    return err;
+}
+
+static httpd_uri_t uri_session_get = {
+    .uri = "/sessions/*",
+    .method = HTTP_GET,
+    .handler = uri_session_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Handlers for \c /metrics endpoint
+ *
+ * This endpoint exports metrics registry in Prometheus text format.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+/**
+ * @brief Writes null-terminated text into response, used by metrics and trace exporters
+ */
+static esp_err_t text_response_write(void *ctx, const char *text){
+    return response_write((response_t *) ctx, text, strlen(text));
+}
+
+static esp_err_t uri_metrics_get_handler(httpd_req_t *req){
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, "text/plain; version=0.0.4"));
+    response_t response;
+    response_begin(&response, req);
+    return response_end(&response, metrics_write(text_response_write, &response));
+}
+
+static httpd_uri_t uri_metrics_get = {
+    .uri = "/metrics",
+    .method = HTTP_GET,
+    .handler = uri_metrics_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Handlers for \c /trace endpoint
+ *
+ * This endpoint exports frame processing trace ring as Chrome trace JSON (open in chrome://tracing or Perfetto).
+ * Trace is empty unless firmware is built with CONFIG_FRAME_TRACE_ENABLE.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_trace_get_handler(httpd_req_t *req){
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, "application/json"));
+    response_t response;
+    response_begin(&response, req);
+    return response_end(&response, frame_trace_write_json(text_response_write, &response));
+}
+
+static httpd_uri_t uri_trace_get = {
+    .uri = "/trace",
+    .method = HTTP_GET,
+    .handler = uri_trace_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Handlers for \c /log and \c /log.bin endpoints
+ *
+ * These endpoints export deferred binary log ring, either decoded as text on device or as raw dump
+ * to be decoded on host by \c decode_binary_log.py with firmware ELF file.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t raw_response_write(void *ctx, const uint8_t *data, unsigned length){
+    return response_write((response_t *) ctx, data, length);
+}
+
+static esp_err_t uri_log_get_handler(httpd_req_t *req){
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, "text/plain"));
+    response_t response;
+    response_begin(&response, req);
+    return response_end(&response, binary_log_write_text(text_response_write, &response));
+}
+
+static httpd_uri_t uri_log_get = {
+    .uri = "/log",
+    .method = HTTP_GET,
+    .handler = uri_log_get_handler,
+    .user_ctx = NULL
+};
+
+static esp_err_t uri_log_bin_get_handler(httpd_req_t *req){
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
+    ESP_ERROR_CHECK(httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=\"log.bin\""));
+    response_t response;
+    response_begin(&response, req);
+    return response_end(&response, binary_log_write_raw(raw_response_write, &response));
+}
+
+static httpd_uri_t uri_log_bin_get = {
+    .uri = "/log.bin",
+    .method = HTTP_GET,
+    .handler = uri_log_bin_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Handlers for \c /screen.pbm and \c /button/<button>/<event> endpoints
+ *
+ * These endpoints allow to view and drive display UI remotely, e.g. by scripted menu flows compared against golden images.
+ * \c /screen.pbm returns content of display as binary PBM image. \c /button queues button event as if it came
+ * from hardware, button is one of \c up, \c middle, \c down and event one of \c press, \c long, \c repeat, \c release.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_screen_get_handler(httpd_req_t *req){
+    static uint8_t frame[DISPLAY_FRAME_SIZE];
+    display_snapshot(frame);
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, "image/x-portable-bitmap"));
+    response_t response;
+    response_begin(&response, req);
+    return response_end(&response, display_write_pbm(frame, raw_response_write, &response));
+}
+
+static httpd_uri_t uri_screen_get = {
+    .uri = "/screen.pbm",
+    .method = HTTP_GET,
+    .handler = uri_screen_get_handler,
+    .user_ctx = NULL
+};
+
+/**
+ * @brief Returns index of name in names or -1
+ */
+static int name_index(const char *name, unsigned length, const char *const names[], unsigned count){
+    for(unsigned i = 0; i < count; i++){
+        if((strlen(names[i]) == length) && (strncmp(name, names[i], length) == 0)){
+            return i;
+        }
+    }
+    return -1;
+}
+
+static esp_err_t uri_button_post_handler(httpd_req_t *req){
+    static const char *const button_names[] = { [BUTTON_UP] = "up", [BUTTON_MIDDLE] = "middle", [BUTTON_DOWN] = "down" };
+    static const char *const event_names[] = {
+        [BUTTON_EVENT_PRESS] = "press", [BUTTON_EVENT_LONG_PRESS] = "long",
+        [BUTTON_EVENT_REPEAT] = "repeat", [BUTTON_EVENT_RELEASE] = "release"
+    };
+    const char *button_str = &req->uri[sizeof("/button/") - 1];
+    const char *event_str = strchr(button_str, '/');
+    if(event_str == NULL){
+        return httpd_resp_send_404(req);
+    }
+    int button = name_index(button_str, event_str - button_str, button_names, BUTTON_MAX);
+    event_str++;
+    int type = name_index(event_str, strlen(event_str), event_names, sizeof(event_names) / sizeof(event_names[0]));
+    if((button < 0) || (type < 0)){
+        return httpd_resp_send_404(req);
+    }
+    button_event_t event = { .button = button, .type = type };
+    if(buttons_inject(&event) != ESP_OK){
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Event not queued");
+    }
+    return httpd_resp_send(req, NULL, 0);
+}
+
+static httpd_uri_t uri_button_post = {
+    .uri = "/button/*",
+    .method = HTTP_POST,
+    .handler = uri_button_post_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Measures every request and calls original handler stored in user context by register_uri_handler()
+ */
+static esp_err_t metered_handler(httpd_req_t *req){
+    esp_err_t (*handler)(httpd_req_t *) = (esp_err_t (*)(httpd_req_t *)) req->user_ctx;
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = handler(req);
+    metrics_histogram_observe(&metric_request_duration, (esp_timer_get_time() - start) / 1000);
+    metrics_counter_inc(&metric_requests);
+    if(err != ESP_OK){
+        metrics_counter_inc(&metric_failed_requests);
+    }
+    return err;
+}
+
+static esp_err_t register_uri_handler(httpd_handle_t server, httpd_uri_t *uri){
+    if(uri->handler != metered_handler){
+        uri->user_ctx = (void *) uri->handler;
+        uri->handler = metered_handler;
+    }
+    return httpd_register_uri_handler(server, uri);
+}
+
 void webserver_run(){
     ESP_LOGD(TAG, "Running webserver");
 
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.max_uri_handlers = 20;
+    config.core_id = TASK_TOPOLOGY_HTTPD_CORE;
+    config.task_priority = TASK_TOPOLOGY_HTTPD_PRIORITY;
+    config.stack_size = TASK_TOPOLOGY_HTTPD_STACK_SIZE;
+    config.uri_match_fn = httpd_uri_match_wildcard;
     httpd_handle_t server = NULL;
 
+    metrics_register(&metric_requests);
+    metrics_register(&metric_failed_requests);
+    metrics_register(&metric_request_duration);
+
     ESP_ERROR_CHECK(httpd_start(&server, &config));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_root_get));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_reset_head));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_ap_list_get));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_run_attack_post));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_status_get));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_capture_pcap_get));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_capture_hccapx_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_root_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_reset_head));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_ap_list_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_run_attack_post));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_status_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_capture_pcap_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_capture_hccapx_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_stations_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_capture_filter_post));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_capture_log_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_capture_log_session_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_sessions_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_session_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_metrics_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_trace_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_log_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_log_bin_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_screen_get));
+    ESP_ERROR_CHECK(register_uri_handler(server, &uri_button_post));
 }
\ No newline at end of file
@@ -8,7 +8,7 @@
  */
 #include "ap_scanner.h"
 
-#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#define LOG_LOCAL_LEVEL CONFIG_WIFI_CONTROLLER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_wifi.h"
@@ -44,6 +44,16 @@ void wifictl_mgmt_ap_start();
  */
 void wifictl_sta_connect_to_ap(const wifi_ap_record_t *ap_record, const char password[]);
 
+/**
+ * @brief Connects station interface to the given AP, restricted to its BSSID
+ * 
+ * Unlike wifictl_sta_connect_to_ap(), this will not connect to another AP of the same ESS.
+ * 
+ * @param ap_record 
+ * @param password password for target network
+ */
+void wifictl_sta_connect_to_bssid(const wifi_ap_record_t *ap_record, const char password[]);
+
 /**
  * @brief Disconnects station interface from currently connected AP
  * 
@@ -8,17 +8,102 @@
  */
 #include "sniffer.h"
 
-#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#include <string.h>
+
+#define LOG_LOCAL_LEVEL CONFIG_WIFI_CONTROLLER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
 #include "esp_wifi.h"
 #include "esp_wifi_types.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+#include "capture_filter.h"
+#include "crc32.h"
+#include "metrics.h"
+#include "frame_trace.h"
+#include "binary_log.h"
+
+/**
+ * @brief Length of Frame Check Sequence that is included in sig_len of every captured frame
+ */
+#define FCS_LEN 4
 
 static const char *TAG = "sniffer"; 
 
 ESP_EVENT_DEFINE_BASE(SNIFFER_EVENTS);
 
+/**
+ * @brief Buffers for capture filter so new filter can be prepared while promiscuous callback evaluates another one.
+ * 
+ * Promiscuous callback marks the filter it evaluates as used. One buffer is active, at most one is used by callback
+ * (possibly filter that was active before), so the third one is always free to be overwritten, even when filter
+ * is set several times while callback evaluates single frame. Both pointers are accessed only under capture_filter_lock.
+ */
+//@{
+static capture_filter_t capture_filters[3];
+static const capture_filter_t *active_capture_filter = NULL;
+static const capture_filter_t *used_capture_filter = NULL;
+static portMUX_TYPE capture_filter_lock = portMUX_INITIALIZER_UNLOCKED;
+//@}
+
+/**
+ * @brief Metrics of promiscuous callback
+ * @{
+ */
+METRICS_COUNTER_DEFINE(metric_frames_data, "sniffer_frames_total", "type=\"data\"", "Frames received by promiscuous callback");
+METRICS_COUNTER_DEFINE(metric_frames_mgmt, "sniffer_frames_total", "type=\"mgmt\"", "Frames received by promiscuous callback");
+METRICS_COUNTER_DEFINE(metric_frames_ctrl, "sniffer_frames_total", "type=\"ctrl\"", "Frames received by promiscuous callback");
+/** Counter of corrupted frames dropped on given channel, channel 0 counts frames with unknown channel */
+#define DROP_METRIC(reason, channel) { .name = "sniffer_dropped_frames_total", .labels = "reason=\"" reason "\",channel=\"" #channel "\"", \
+    .help = "Frames dropped before posting to event loop", .type = METRICS_TYPE_COUNTER }
+#define DROP_METRICS(reason) { DROP_METRIC(reason, 0), DROP_METRIC(reason, 1), DROP_METRIC(reason, 2), DROP_METRIC(reason, 3), \
+    DROP_METRIC(reason, 4), DROP_METRIC(reason, 5), DROP_METRIC(reason, 6), DROP_METRIC(reason, 7), DROP_METRIC(reason, 8), \
+    DROP_METRIC(reason, 9), DROP_METRIC(reason, 10), DROP_METRIC(reason, 11), DROP_METRIC(reason, 12), DROP_METRIC(reason, 13), \
+    DROP_METRIC(reason, 14) }
+static metrics_metric_t metric_drops_rx_error[WIFICTL_SNIFFER_MAX_CHANNEL + 1] = DROP_METRICS("rx_error");
+static metrics_metric_t metric_drops_fcs[WIFICTL_SNIFFER_MAX_CHANNEL + 1] = DROP_METRICS("fcs");
+METRICS_COUNTER_DEFINE(metric_drops_filter, "sniffer_dropped_frames_total", "reason=\"filter\"", "Frames dropped before posting to event loop");
+static const uint32_t post_duration_bounds[] = { 10, 25, 50, 100, 250, 1000, 10000 };
+METRICS_HISTOGRAM_DEFINE(metric_post_duration, "sniffer_event_post_duration_us", NULL,
+    "Time spent posting frame into event loop, long posts mean full event queue", post_duration_bounds);
+//@}
+
+/**
+ * @brief Validates captured frame and counts dropped frames per channel in metrics.
+ * 
+ * Frames with non-zero rx_state were received with error. If CONFIG_SNIFFER_VERIFY_FCS is enabled,
+ * CRC32 of frame is also compared to trailing FCS to catch bit errors that Wi-Fi driver didn't report.
+ * 
+ * @param frame 
+ * @return true if frame is valid
+ */
+static bool validate_frame(const wifi_promiscuous_pkt_t *frame){
+    uint8_t channel = frame->rx_ctrl.channel;
+    if(channel > WIFICTL_SNIFFER_MAX_CHANNEL){
+        channel = 0;
+    }
+    if(frame->rx_ctrl.rx_state != 0){
+        metrics_counter_inc(&metric_drops_rx_error[channel]);
+        return false;
+    }
+#ifdef CONFIG_SNIFFER_VERIFY_FCS
+    unsigned length = frame->rx_ctrl.sig_len;
+    if(length < FCS_LEN){
+        metrics_counter_inc(&metric_drops_fcs[channel]);
+        return false;
+    }
+    const uint8_t *fcs = &frame->payload[length - FCS_LEN];
+    uint32_t expected = fcs[0] | (fcs[1] << 8) | (fcs[2] << 16) | ((uint32_t) fcs[3] << 24);
+    if(crc32_update(0, frame->payload, length - FCS_LEN) != expected){
+        metrics_counter_inc(&metric_drops_fcs[channel]);
+        return false;
+    }
+#endif
+    return true;
+}
+
 /**
  * @brief Callback for promiscuous reciever. 
  * 
@@ -27,13 +112,47 @@ ESP_EVENT_DEFINE_BASE(SNIFFER_EVENTS);
  * - Management
  * - Control
  * 
+ * Corrupted frames and frames not matching capture filter are dropped here, before they are copied into event pool.
+ * 
  * @param buf 
  * @param type 
  */
 static void frame_handler(void *buf, wifi_promiscuous_pkt_type_t type) {
-    ESP_LOGV(TAG, "Captured frame %d.", (int) type);
+    BINARY_LOGV(TAG, "Captured frame %d.", (int) type);
 
     wifi_promiscuous_pkt_t *frame = (wifi_promiscuous_pkt_t *) buf;
+    FRAME_TRACE_BEGIN(trace_start);
+
+    switch (type) {
+        case WIFI_PKT_DATA:
+            metrics_counter_inc(&metric_frames_data);
+            break;
+        case WIFI_PKT_MGMT:
+            metrics_counter_inc(&metric_frames_mgmt);
+            break;
+        case WIFI_PKT_CTRL:
+            metrics_counter_inc(&metric_frames_ctrl);
+            break;
+        default:
+            break;
+    }
+
+    if(!validate_frame(frame)){
+        return;
+    }
+
+    portENTER_CRITICAL(&capture_filter_lock);
+    const capture_filter_t *filter = active_capture_filter;
+    used_capture_filter = filter;
+    portEXIT_CRITICAL(&capture_filter_lock);
+    bool matching = (filter == NULL) || capture_filter_match(filter, frame->payload, frame->rx_ctrl.sig_len);
+    portENTER_CRITICAL(&capture_filter_lock);
+    used_capture_filter = NULL;
+    portEXIT_CRITICAL(&capture_filter_lock);
+    if(!matching){
+        metrics_counter_inc(&metric_drops_filter);
+        return;
+    }
 
     int32_t event_id;
     switch (type) {
@@ -50,7 +169,14 @@ static void frame_handler(void *buf, wifi_promiscuous_pkt_type_t type) {
             return;
     }
 
+    // only data frames are consumed by frame analyzer, which ends the dwell
+    if(event_id == SNIFFER_EVENT_CAPTURED_DATA){
+        FRAME_TRACE_ASYNC_BEGIN(FRAME_TRACE_STAGE_QUEUE_DWELL, frame->rx_ctrl.timestamp);
+    }
+    int64_t post_start = esp_timer_get_time();
     ESP_ERROR_CHECK(esp_event_post(SNIFFER_EVENTS, event_id, frame, frame->rx_ctrl.sig_len + sizeof(wifi_promiscuous_pkt_t), portMAX_DELAY));
+    metrics_histogram_observe(&metric_post_duration, esp_timer_get_time() - post_start);
+    FRAME_TRACE_END(FRAME_TRACE_STAGE_SNIFFER_CALLBACK, trace_start);
 }
 
 /**
@@ -61,21 +187,52 @@ void wifictl_sniffer_filter_frame_types(bool data, bool mgmt, bool ctrl) {
     if(data) {
         filter.filter_mask |= WIFI_PROMIS_FILTER_MASK_DATA;
     }
-    else if(mgmt) {
+    if(mgmt) {
         filter.filter_mask |= WIFI_PROMIS_FILTER_MASK_MGMT;
     }
-    else if(ctrl) {
+    if(ctrl) {
         filter.filter_mask |= WIFI_PROMIS_FILTER_MASK_CTRL;
     }
     esp_wifi_set_promiscuous_filter(&filter);
 }
 
+void wifictl_sniffer_set_capture_filter(const capture_filter_t *filter) {
+    if((filter == NULL) || (filter->length == 0)){
+        portENTER_CRITICAL(&capture_filter_lock);
+        active_capture_filter = NULL;
+        portEXIT_CRITICAL(&capture_filter_lock);
+        ESP_LOGI(TAG, "Capture filter cleared");
+        return;
+    }
+    // filter is small (CONFIG_CAPTURE_FILTER_MAX_INSNS * 10 bytes), so it's copied inside critical section
+    portENTER_CRITICAL(&capture_filter_lock);
+    capture_filter_t *free_filter = &capture_filters[0];
+    while((free_filter == active_capture_filter) || (free_filter == used_capture_filter)){
+        free_filter++;
+    }
+    memcpy(free_filter, filter, sizeof(capture_filter_t));
+    active_capture_filter = free_filter;
+    portEXIT_CRITICAL(&capture_filter_lock);
+    ESP_LOGI(TAG, "Capture filter set (%u instructions)", filter->length);
+}
+
 void wifictl_sniffer_start(uint8_t channel) {
     ESP_LOGI(TAG, "Starting promiscuous mode...");
     // ESP32 cannot switch port, if there is some STA connected to AP
     ESP_LOGD(TAG, "Kicking all connected STAs from AP");
     ESP_ERROR_CHECK(esp_wifi_deauth_sta(0));
     esp_wifi_set_channel(channel, WIFI_SECOND_CHAN_NONE);
+    metrics_register(&metric_frames_data);
+    metrics_register(&metric_frames_mgmt);
+    metrics_register(&metric_frames_ctrl);
+    for(unsigned channel = 0; channel <= WIFICTL_SNIFFER_MAX_CHANNEL; channel++){
+        metrics_register(&metric_drops_rx_error[channel]);
+    }
+    for(unsigned channel = 0; channel <= WIFICTL_SNIFFER_MAX_CHANNEL; channel++){
+        metrics_register(&metric_drops_fcs[channel]);
+    }
+    metrics_register(&metric_drops_filter);
+    metrics_register(&metric_post_duration);
     esp_wifi_set_promiscuous(true);
     esp_wifi_set_promiscuous_rx_cb(&frame_handler);
 }
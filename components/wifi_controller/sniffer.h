@@ -9,8 +9,10 @@
 #ifndef SNIFFER_H
 #define SNIFFER_H
 
+#include <stdint.h>
 #include <stdbool.h>
 #include "esp_event.h"
+#include "capture_filter.h"
 
 ESP_EVENT_DECLARE_BASE(SNIFFER_EVENTS);
 
@@ -20,6 +22,11 @@ enum {
     SNIFFER_EVENT_CAPTURED_CTRL
 };
 
+/**
+ * @brief Highest Wi-Fi channel number (2.4 GHz)
+ */
+#define WIFICTL_SNIFFER_MAX_CHANNEL 14
+
 /**
  * @brief Sets sniffer filter for specific frame types. 
  * 
@@ -29,6 +36,17 @@ enum {
  */
 void wifictl_sniffer_filter_frame_types(bool data, bool mgmt, bool ctrl);
 
+/**
+ * @brief Sets capture filter evaluated on every captured frame before it's posted to event pool.
+ * 
+ * Filter is copied, so caller doesn't have to keep it. It can be changed while sniffer is running.
+ * Frame type mask set by wifictl_sniffer_filter_frame_types() is still applied by Wi-Fi driver
+ * before capture filter, so capture filter can only narrow captured frames down.
+ * 
+ * @param filter compiled filter or NULL to capture all frames
+ */
+void wifictl_sniffer_set_capture_filter(const capture_filter_t *filter);
+
 /**
  * @brief Start promiscuous mode on given channel
  * 
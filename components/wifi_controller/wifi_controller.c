@@ -3,7 +3,7 @@
 #include <stdio.h>
 #include <string.h>
 
-#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#define LOG_LOCAL_LEVEL CONFIG_WIFI_CONTROLLER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_wifi.h"
@@ -82,7 +82,14 @@ void wifictl_mgmt_ap_start(){
     wifictl_ap_start(&mgmt_wifi_config);
 }
 
-void wifictl_sta_connect_to_ap(const wifi_ap_record_t *ap_record, const char password[]){
+/**
+ * @brief Configures STA interface for given AP and connects to it.
+ * 
+ * @param ap_record 
+ * @param password password for target network
+ * @param bssid_set if true, STA connects only to AP with BSSID from ap_record
+ */
+static void sta_connect(const wifi_ap_record_t *ap_record, const char password[], bool bssid_set){
     ESP_LOGD(TAG, "Connecting STA to AP...");
     if(!wifi_init){
         wifi_init_apsta();
@@ -92,11 +99,15 @@ void wifictl_sta_connect_to_ap(const wifi_ap_record_t *ap_record, const char pas
         .sta = {
             .channel = ap_record->primary,
             .scan_method = WIFI_FAST_SCAN,
+            .bssid_set = bssid_set,
             .pmf_cfg.capable = false,
             .pmf_cfg.required = false
         },
     };
     mempcpy(sta_wifi_config.sta.ssid, ap_record->ssid, 32);
+    if(bssid_set){
+        memcpy(sta_wifi_config.sta.bssid, ap_record->bssid, 6);
+    }
 
     if(password != NULL){
         if(strlen(password) >= 64) {
@@ -110,7 +121,14 @@ void wifictl_sta_connect_to_ap(const wifi_ap_record_t *ap_record, const char pas
 
     ESP_ERROR_CHECK(esp_wifi_set_config(ESP_IF_WIFI_STA, &sta_wifi_config));
     ESP_ERROR_CHECK(esp_wifi_connect());
+}
+
+void wifictl_sta_connect_to_ap(const wifi_ap_record_t *ap_record, const char password[]){
+    sta_connect(ap_record, password, false);
+}
 
+void wifictl_sta_connect_to_bssid(const wifi_ap_record_t *ap_record, const char password[]){
+    sta_connect(ap_record, password, true);
 }
 
 void wifictl_sta_disconnect(){
@@ -11,12 +11,14 @@
 #include <stdint.h>
 #include <string.h>
 
-#define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
+#define LOG_LOCAL_LEVEL CONFIG_WSL_BYPASSER_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_wifi.h"
 #include "esp_wifi_types.h"
 
+#include "binary_log.h"
+
 static const char *TAG = "wsl_bypasser";
 /**
  * @brief Deauthentication frame template
@@ -49,7 +51,7 @@ void wsl_bypasser_send_raw_frame(const uint8_t *frame_buffer, int size){
 }
 
 void wsl_bypasser_send_deauth_frame(const wifi_ap_record_t *ap_record){
-    ESP_LOGD(TAG, "Sending deauth frame...");
+    BINARY_LOGD(TAG, "Sending deauth frame...");
     uint8_t deauth_frame[sizeof(deauth_frame_default)];
     memcpy(deauth_frame, deauth_frame_default, sizeof(deauth_frame_default));
     memcpy(&deauth_frame[10], ap_record->bssid, 6);
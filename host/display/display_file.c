@@ -0,0 +1,73 @@
+/**
+ * @file display_file.c
+ * @brief Implements display backend writing PBM file
+ */
+#include "display_file.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char *image_path = NULL;
+static uint8_t ram[DISPLAY_FRAME_SIZE];
+static unsigned written_bytes = 0;
+static pthread_mutex_t ram_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static esp_err_t file_writer(void *ctx, const uint8_t *data, unsigned length){
+    return (fwrite(data, 1, length, ctx) == length) ? ESP_OK : ESP_FAIL;
+}
+
+static esp_err_t file_init(void){
+    memset(ram, 0, sizeof(ram));
+    written_bytes = 0;
+    return ESP_OK;
+}
+
+static esp_err_t file_write(const uint8_t *frame, uint8_t page, uint8_t first, uint8_t last){
+    pthread_mutex_lock(&ram_lock);
+    unsigned offset = page * DISPLAY_WIDTH + first;
+    memcpy(&ram[offset], &frame[offset], last - first + 1);
+    written_bytes += last - first + 1;
+    esp_err_t err = ESP_OK;
+    if(image_path != NULL){
+        // written to temporary file first, so readers never see partial image
+        char temporary_path[256];
+        snprintf(temporary_path, sizeof(temporary_path), "%s.tmp", image_path);
+        FILE *file = fopen(temporary_path, "wb");
+        if(file == NULL){
+            err = ESP_FAIL;
+        }
+        else {
+            err = display_write_pbm(ram, file_writer, file);
+            fclose(file);
+            if((err == ESP_OK) && (rename(temporary_path, image_path) != 0)){
+                err = ESP_FAIL;
+            }
+        }
+    }
+    pthread_mutex_unlock(&ram_lock);
+    return err;
+}
+
+const display_backend_t display_file_backend = {
+    .name = "file",
+    .init = file_init,
+    .write = file_write
+};
+
+void display_file_set_path(const char *path){
+    image_path = path;
+}
+
+void display_file_ram(uint8_t *frame){
+    pthread_mutex_lock(&ram_lock);
+    memcpy(frame, ram, sizeof(ram));
+    pthread_mutex_unlock(&ram_lock);
+}
+
+unsigned display_file_written_bytes(void){
+    pthread_mutex_lock(&ram_lock);
+    unsigned bytes = written_bytes;
+    pthread_mutex_unlock(&ram_lock);
+    return bytes;
+}
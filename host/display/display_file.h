@@ -0,0 +1,38 @@
+/**
+ * @file display_file.h
+ * @brief Display backend writing content of emulated display RAM into PBM file
+ */
+#ifndef DISPLAY_FILE_H
+#define DISPLAY_FILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "display.h"
+
+/**
+ * @brief Backend emulating display RAM, whole RAM is written as PBM image after every page write
+ *
+ * Path of image is set by display_file_set_path() before display_start().
+ */
+extern const display_backend_t display_file_backend;
+
+/**
+ * @brief Sets path of PBM image written by display_file_backend
+ *
+ * @param path
+ */
+void display_file_set_path(const char *path);
+
+/**
+ * @brief Copies emulated display RAM
+ *
+ * @param[out] frame DISPLAY_FRAME_SIZE bytes
+ */
+void display_file_ram(uint8_t *frame);
+
+/**
+ * @brief Returns number of bytes written to display since display_start()
+ */
+unsigned display_file_written_bytes(void);
+
+#endif
@@ -0,0 +1,17 @@
+/**
+ * @file esp_heap_caps.h
+ * @brief Host replacement of ESP-IDF heap capabilities queries
+ */
+#ifndef ESP_HEAP_CAPS_H
+#define ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+
+static inline size_t heap_caps_get_largest_free_block(unsigned caps){
+    (void) caps;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,36 @@
+/**
+ * @file esp_log.h
+ * @brief Host replacement of ESP-IDF logging, prints warnings and errors to stderr
+ */
+#ifndef ESP_LOG_H
+#define ESP_LOG_H
+
+#include <stdio.h>
+#include "sdkconfig.h"
+#include <stdint.h>
+#include <time.h>
+
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+static inline uint32_t esp_log_timestamp(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+#define ESP_LOGE(tag, format, ...) fprintf(stderr, "E (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) fprintf(stderr, "W (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) do { (void) (tag); } while(0)
+#define ESP_LOGD(tag, format, ...) do { (void) (tag); } while(0)
+#define ESP_LOGV(tag, format, ...) do { (void) (tag); } while(0)
+
+#define ESP_LOG_BUFFER_HEX_LEVEL(tag, buffer, length, level) do { (void) (tag); (void) (buffer); (void) (length); } while(0)
+
+#endif
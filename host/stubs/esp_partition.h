@@ -0,0 +1,49 @@
+/**
+ * @file esp_partition.h
+ * @brief Host replacement of ESP-IDF partition API, host has no partition table so no partition is found
+ */
+#ifndef ESP_PARTITION_H
+#define ESP_PARTITION_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef enum {
+    ESP_PARTITION_TYPE_APP = 0x00,
+    ESP_PARTITION_TYPE_DATA = 0x01
+} esp_partition_type_t;
+
+typedef int esp_partition_subtype_t;
+
+typedef struct {
+    esp_partition_type_t type;
+    esp_partition_subtype_t subtype;
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+} esp_partition_t;
+
+static inline const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char *label){
+    (void) type;
+    (void) subtype;
+    (void) label;
+    return NULL;
+}
+
+static inline esp_err_t esp_partition_read(const esp_partition_t *partition, size_t offset, void *buffer, size_t length){
+    (void) partition; (void) offset; (void) buffer; (void) length;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static inline esp_err_t esp_partition_write(const esp_partition_t *partition, size_t offset, const void *buffer, size_t length){
+    (void) partition; (void) offset; (void) buffer; (void) length;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static inline esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t length){
+    (void) partition; (void) offset; (void) length;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif
@@ -0,0 +1,18 @@
+/**
+ * @file esp_system.h
+ * @brief Host replacement of ESP-IDF system queries, heap is not tracked on host
+ */
+#ifndef ESP_SYSTEM_H
+#define ESP_SYSTEM_H
+
+#include <stdint.h>
+
+static inline uint32_t esp_get_free_heap_size(){
+    return 0;
+}
+
+static inline uint32_t esp_get_minimum_free_heap_size(){
+    return 0;
+}
+
+#endif
@@ -0,0 +1,31 @@
+/**
+ * @file esp_wifi_types.h
+ * @brief Host replacement of ESP-IDF AP record and promiscuous mode packet types
+ */
+#ifndef ESP_WIFI_TYPES_H
+#define ESP_WIFI_TYPES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_event.h"
+
+typedef struct {
+    uint8_t bssid[6];
+    uint8_t ssid[33];
+    uint8_t primary;
+    int8_t rssi;
+} wifi_ap_record_t;
+
+typedef struct {
+    signed rssi:8;
+    unsigned channel:4;
+    unsigned sig_len:12;
+    unsigned timestamp:32;
+} wifi_pkt_rx_ctrl_t;
+
+typedef struct {
+    wifi_pkt_rx_ctrl_t rx_ctrl;
+    uint8_t payload[0];
+} wifi_promiscuous_pkt_t;
+
+#endif
@@ -0,0 +1,50 @@
+/**
+ * @file FreeRTOS.h
+ * @brief Host replacement of FreeRTOS types and critical sections
+ *
+ * All critical sections share one recursive mutex, like critical sections of single core FreeRTOS
+ * share disabled interrupts.
+ */
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE          1
+#define pdFALSE         0
+#define pdPASS          pdTRUE
+#define pdFAIL          pdFALSE
+#define portMAX_DELAY   ((TickType_t) 0xffffffff)
+#define portTICK_PERIOD_MS 1
+#define configTICK_RATE_HZ 1000
+#define tskNO_AFFINITY 0x7fffffff
+#define pdMS_TO_TICKS(ms) ((TickType_t) (ms))
+
+typedef struct {
+    int unused;
+} portMUX_TYPE;
+
+void host_enter_critical(void);
+void host_exit_critical(void);
+
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+#define portENTER_CRITICAL(mux) do { (void) (mux); host_enter_critical(); } while(0)
+#define portEXIT_CRITICAL(mux) do { (void) (mux); host_exit_critical(); } while(0)
+#define portENTER_CRITICAL_SAFE(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_SAFE(mux) portEXIT_CRITICAL(mux)
+#define portENTER_CRITICAL_ISR(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux) portEXIT_CRITICAL(mux)
+
+#define portNUM_PROCESSORS 2
+
+static inline BaseType_t xPortGetCoreID(){
+    return 0;
+}
+
+#endif
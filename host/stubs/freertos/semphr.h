@@ -0,0 +1,38 @@
+/**
+ * @file semphr.h
+ * @brief Host replacement of FreeRTOS mutexes backed by pthread mutexes
+ */
+#ifndef SEMPHR_H
+#define SEMPHR_H
+
+#include <pthread.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+
+typedef pthread_mutex_t *SemaphoreHandle_t;
+
+static inline SemaphoreHandle_t xSemaphoreCreateMutex(){
+    SemaphoreHandle_t mutex = malloc(sizeof(pthread_mutex_t));
+    if(mutex != NULL){
+        pthread_mutex_init(mutex, NULL);
+    }
+    return mutex;
+}
+
+static inline BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t ticks){
+    if(ticks == portMAX_DELAY){
+        return pthread_mutex_lock(mutex) == 0;
+    }
+    return pthread_mutex_trylock(mutex) == 0;
+}
+
+static inline BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex){
+    return pthread_mutex_unlock(mutex) == 0;
+}
+
+static inline void vSemaphoreDelete(SemaphoreHandle_t mutex){
+    pthread_mutex_destroy(mutex);
+    free(mutex);
+}
+
+#endif
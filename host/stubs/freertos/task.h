@@ -0,0 +1,53 @@
+/**
+ * @file task.h
+ * @brief Host replacement of FreeRTOS tasks backed by POSIX threads
+ *
+ * Tasks run as detached threads, priorities and core affinity are ignored. Task notification is
+ * counting semaphore of the task, as ulTaskNotifyTake() and xTaskNotifyGive() use it.
+ */
+#ifndef TASK_H
+#define TASK_H
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *arg);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stack_size, void *arg,
+    UBaseType_t priority, TaskHandle_t *handle, BaseType_t core);
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t wait);
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+
+TickType_t xTaskGetTickCount(void);
+
+void vTaskDelay(TickType_t ticks);
+
+const char *pcTaskGetTaskName(TaskHandle_t task);
+
+/**
+ * @brief Returns handle of calling task, NULL when called from thread that isn't task (e.g. main thread)
+ */
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+typedef struct {
+    TaskHandle_t xHandle;
+    const char *pcTaskName;
+    uint32_t usStackHighWaterMark;
+} TaskStatus_t;
+
+/**
+ * @brief Number of running tasks, threads that aren't tasks are not counted
+ */
+UBaseType_t uxTaskGetNumberOfTasks(void);
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *tasks, UBaseType_t max_count, uint32_t *total_run_time);
+
+static inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task){
+    (void) task;
+    return 0;
+}
+
+#endif
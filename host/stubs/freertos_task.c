@@ -0,0 +1,170 @@
+/**
+ * @file freertos_task.c
+ * @brief Implements host replacement of FreeRTOS tasks and critical sections by POSIX threads
+ */
+#include "freertos/task.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include "esp_timer.h"
+
+struct host_task {
+    pthread_t thread;
+    const char *name;
+    TaskFunction_t function;
+    void *arg;
+    pthread_mutex_t lock;
+    pthread_cond_t notified;
+    uint32_t notifications;
+    struct host_task *next;     //< next running task
+};
+
+static __thread struct host_task *current_task = NULL;
+static struct host_task *running_tasks = NULL;
+
+static pthread_once_t critical_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t critical_lock;
+
+static void critical_init(void){
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&critical_lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+void host_enter_critical(void){
+    pthread_once(&critical_once, critical_init);
+    pthread_mutex_lock(&critical_lock);
+}
+
+void host_exit_critical(void){
+    pthread_mutex_unlock(&critical_lock);
+}
+
+static void *task_main(void *arg){
+    current_task = arg;
+    current_task->function(current_task->arg);
+    // returned task leaves registry, its handle stays valid
+    host_enter_critical();
+    for(struct host_task **task = &running_tasks; *task != NULL; task = &(*task)->next){
+        if(*task == current_task){
+            *task = current_task->next;
+            break;
+        }
+    }
+    host_exit_critical();
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stack_size, void *arg,
+    UBaseType_t priority, TaskHandle_t *handle, BaseType_t core){
+    struct host_task *task = calloc(1, sizeof(struct host_task));
+    if(task == NULL){
+        return pdFAIL;
+    }
+    task->name = name;
+    task->function = function;
+    task->arg = arg;
+    pthread_mutex_init(&task->lock, NULL);
+    pthread_cond_init(&task->notified, NULL);
+    if(handle != NULL){
+        *handle = task;
+    }
+    host_enter_critical();
+    task->next = running_tasks;
+    running_tasks = task;
+    if(pthread_create(&task->thread, NULL, task_main, task) != 0){
+        running_tasks = task->next;
+        host_exit_critical();
+        return pdFAIL;
+    }
+    host_exit_critical();
+    pthread_detach(task->thread);
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t wait){
+    struct host_task *task = current_task;
+    pthread_mutex_lock(&task->lock);
+    if((task->notifications == 0) && (wait > 0)){
+        if(wait == portMAX_DELAY){
+            while(task->notifications == 0){
+                pthread_cond_wait(&task->notified, &task->lock);
+            }
+        }
+        else {
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_sec += wait / 1000;
+            deadline.tv_nsec += (wait % 1000) * 1000000L;
+            if(deadline.tv_nsec >= 1000000000L){
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000L;
+            }
+            while((task->notifications == 0) && (pthread_cond_timedwait(&task->notified, &task->lock, &deadline) == 0)){
+            }
+        }
+    }
+    uint32_t value = task->notifications;
+    if(value > 0){
+        task->notifications = clear_on_exit ? 0 : value - 1;
+    }
+    pthread_mutex_unlock(&task->lock);
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task){
+    pthread_mutex_lock(&task->lock);
+    task->notifications++;
+    pthread_cond_signal(&task->notified);
+    pthread_mutex_unlock(&task->lock);
+    return pdPASS;
+}
+
+TickType_t xTaskGetTickCount(void){
+    return esp_timer_get_time() / 1000 / portTICK_PERIOD_MS;
+}
+
+void vTaskDelay(TickType_t ticks){
+    struct timespec delay = { .tv_sec = ticks / 1000, .tv_nsec = (ticks % 1000) * 1000000L };
+    nanosleep(&delay, NULL);
+}
+
+const char *pcTaskGetTaskName(TaskHandle_t task){
+    if(task == NULL){
+        task = current_task;
+    }
+    return (task != NULL) ? task->name : "main";
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void){
+    return current_task;
+}
+
+UBaseType_t uxTaskGetNumberOfTasks(void){
+    UBaseType_t count = 0;
+    host_enter_critical();
+    for(struct host_task *task = running_tasks; task != NULL; task = task->next){
+        count++;
+    }
+    host_exit_critical();
+    return count;
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *tasks, UBaseType_t max_count, uint32_t *total_run_time){
+    UBaseType_t count = 0;
+    host_enter_critical();
+    for(struct host_task *task = running_tasks; (task != NULL) && (count < max_count); task = task->next){
+        tasks[count].xHandle = task;
+        tasks[count].pcTaskName = task->name;
+        tasks[count].usStackHighWaterMark = 0;
+        count++;
+    }
+    host_exit_critical();
+    if(total_run_time != NULL){
+        *total_run_time = 0;
+    }
+    return count;
+}
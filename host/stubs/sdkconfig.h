@@ -0,0 +1,40 @@
+/**
+ * @file sdkconfig.h
+ * @brief Configuration of host build, values are Kconfig defaults unless tests need otherwise
+ */
+#ifndef SDKCONFIG_H
+#define SDKCONFIG_H
+
+#define CONFIG_BINARY_LOG_RING_SIZE 256
+#define CONFIG_CAPTURE_LOG_PARTITION_LABEL "capture_log"
+#define CONFIG_CAPTURE_LOG_MAX_SESSIONS 16
+#define CONFIG_CAPTURE_LOG_FLUSH_THRESHOLD 256
+#define CONFIG_CAPTURE_LOG_LOG_LEVEL 2
+#define CONFIG_CAPTURE_FILTER_MAX_INSNS 128
+#define CONFIG_CAPTURE_FILTER_LOG_LEVEL 2
+#define CONFIG_DISPLAY_LOG_LEVEL 2
+#define CONFIG_FRAME_ANALYZER_LOG_LEVEL 2
+#define CONFIG_FRAME_TRACE_ENABLE 1
+#define CONFIG_FRAME_TRACE_RING_SIZE 1024
+#define CONFIG_FREERTOS_USE_TRACE_FACILITY 1
+#define CONFIG_GZIP_STREAM_WINDOW_SIZE 2048
+#define CONFIG_HCCAPX_MAX_CANDIDATES 8
+#define CONFIG_HCCAPX_MAX_PAIRS 4
+#define CONFIG_HCCAPX_SERIALIZER_LOG_LEVEL 2
+#define CONFIG_PCAP_SERIALIZER_LOG_LEVEL 2
+#define CONFIG_RESULT_HISTORY_MAX_SESSIONS 8
+#define CONFIG_RESULT_HISTORY_MEMORY_BUDGET 32768
+#define CONFIG_RESULT_HISTORY_LOG_LEVEL 2
+#define CONFIG_STATION_INVENTORY_SIZE 64
+#define CONFIG_STATION_INVENTORY_LOG_LEVEL 2
+#define CONFIG_TASK_TOPOLOGY_PIN_APPLICATION 1
+#define CONFIG_TASK_TOPOLOGY_HTTPD_PRIORITY 5
+#define CONFIG_TASK_TOPOLOGY_HTTPD_STACK_SIZE 4096
+#define CONFIG_TASK_TOPOLOGY_ATTACK_PRIORITY 6
+#define CONFIG_TASK_TOPOLOGY_ATTACK_STACK_SIZE 4096
+#define CONFIG_TASK_TOPOLOGY_DISPLAY_UI_PRIORITY 4
+#define CONFIG_TASK_TOPOLOGY_DISPLAY_UI_STACK_SIZE 8192
+#define CONFIG_TASK_TOPOLOGY_DISPLAY_PRIORITY 3
+#define CONFIG_TASK_TOPOLOGY_DISPLAY_STACK_SIZE 2560
+
+#endif
@@ -0,0 +1,35 @@
+/**
+ * @file test.h
+ * @brief Minimal assertion macros for host tests
+ *
+ * Every test is a separate executable registered in CTest. The first failed assertion prints its location
+ * and terminates the executable with non-zero status.
+ */
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_ASSERT(condition) do { \
+        if(!(condition)){ \
+            fprintf(stderr, "%s:%d: assertion failed: %s\n", __FILE__, __LINE__, #condition); \
+            exit(1); \
+        } \
+    } while(0)
+
+#define TEST_ASSERT_EQUAL(expected, actual) do { \
+        long long expected_ = (long long) (expected); \
+        long long actual_ = (long long) (actual); \
+        if(expected_ != actual_){ \
+            fprintf(stderr, "%s:%d: %s: expected %lld, got %lld\n", __FILE__, __LINE__, #actual, expected_, actual_); \
+            exit(1); \
+        } \
+    } while(0)
+
+#define RUN_TEST(test) do { \
+        printf("%s\n", #test); \
+        test(); \
+    } while(0)
+
+#endif
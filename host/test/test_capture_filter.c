@@ -0,0 +1,218 @@
+/**
+ * @file test_capture_filter.c
+ * @brief Tests capture filter compiler, bytecode verifier and VM on synthetic frames
+ */
+#include <string.h>
+
+#include "test.h"
+#include "capture_filter.h"
+#include "synthetic_pcap.h"
+
+#define PCAP_GLOBAL_HEADER_LENGTH 24
+#define PCAP_RECORD_HEADER_LENGTH 16
+
+static const uint8_t ap[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+static const uint8_t sta[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+
+static capture_filter_t filter;
+static uint8_t pcap[256 * 1024];
+
+static void set_insn(uint8_t *bytecode, unsigned index, uint8_t opcode){
+    capture_filter_insn_t insn = { .opcode = opcode };
+    memcpy(&bytecode[index * sizeof(insn)], &insn, sizeof(insn));
+}
+
+/**
+ * @brief Matches frame copied into buffer of exactly its length, so any read beyond it is caught by sanitizer
+ */
+static bool match(const char *expression, const uint8_t *frame, unsigned length){
+    TEST_ASSERT_EQUAL(ESP_OK, capture_filter_compile(expression, &filter));
+    uint8_t *copy = malloc(length);
+    memcpy(copy, frame, length);
+    bool result = capture_filter_match(&filter, copy, length);
+    free(copy);
+    return result;
+}
+
+static void test_parse_errors(){
+    static const char *invalid[] = {
+        "type", "type foo", "type ctrl subtype beacon", "subtype foo", "ether ip", "ether proto foo",
+        "ether proto 0x10000", "bssid 02:00:00:00:00", "addr1 02:00:00:00:00:01:02", "addr2 zz:00:00:00:00:01",
+        "(type mgmt", "type mgmt )", "type mgmt and", "or type mgmt", "type mgmt type data", "not",
+        "not not not not not not not not type mgmt",
+        "((((((((type mgmt))))))))"
+    };
+    for(unsigned i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++){
+        filter.length = 1;
+        if(capture_filter_compile(invalid[i], &filter) != ESP_ERR_INVALID_ARG){
+            fprintf(stderr, "accepted '%s'\n", invalid[i]);
+            exit(1);
+        }
+        TEST_ASSERT_EQUAL(0, filter.length);
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, capture_filter_compile("not not not not not not not type mgmt", &filter));
+    TEST_ASSERT_EQUAL(ESP_OK, capture_filter_compile("  ", &filter));
+    TEST_ASSERT_EQUAL(0, filter.length);
+
+    // program longer than CONFIG_CAPTURE_FILTER_MAX_INSNS
+    char expression[CONFIG_CAPTURE_FILTER_MAX_INSNS * 16] = "protected";
+    for(unsigned i = 1; i < CONFIG_CAPTURE_FILTER_MAX_INSNS; i++){
+        strcat(expression, " or protected");
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, capture_filter_compile(expression, &filter));
+}
+
+static void test_compiled_postfix(){
+    TEST_ASSERT_EQUAL(ESP_OK, capture_filter_compile("type mgmt subtype beacon or ether proto eapol and bssid 00:11:22:33:44:55", &filter));
+    static const uint8_t opcodes[] = { CAPTURE_FILTER_OP_SUBTYPE, CAPTURE_FILTER_OP_ETHER_PROTO, CAPTURE_FILTER_OP_BSSID,
+        CAPTURE_FILTER_OP_AND, CAPTURE_FILTER_OP_OR };
+    TEST_ASSERT_EQUAL(sizeof(opcodes), filter.length);
+    for(unsigned i = 0; i < sizeof(opcodes); i++){
+        TEST_ASSERT_EQUAL(opcodes[i], filter.insns[i].opcode);
+    }
+    TEST_ASSERT_EQUAL(0x08, filter.insns[0].k);
+    TEST_ASSERT_EQUAL(0x888e, filter.insns[1].k);
+    TEST_ASSERT_EQUAL(0x55, filter.insns[2].mac[5]);
+
+    // compiled program is accepted back by verifier
+    capture_filter_t loaded;
+    TEST_ASSERT_EQUAL(ESP_OK, capture_filter_load((const uint8_t *) filter.insns, filter.length * sizeof(capture_filter_insn_t), &loaded));
+    TEST_ASSERT_EQUAL(filter.length, loaded.length);
+}
+
+static void test_verifier_rejects_malformed_bytecode(){
+    uint8_t bytecode[(CONFIG_CAPTURE_FILTER_MAX_INSNS + 1) * sizeof(capture_filter_insn_t)] = { 0 };
+    const unsigned insn_size = sizeof(capture_filter_insn_t);
+
+    TEST_ASSERT_EQUAL(ESP_OK, capture_filter_load(bytecode, 0, &filter));
+    TEST_ASSERT_EQUAL(0, filter.length);
+    // truncated instruction and program beyond instruction limit
+    set_insn(bytecode, 0, CAPTURE_FILTER_OP_PROTECTED);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, capture_filter_load(bytecode, insn_size - 1, &filter));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, capture_filter_load(bytecode, insn_size + 1, &filter));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, capture_filter_load(bytecode, sizeof(bytecode), &filter));
+
+    // program has no jumps or loads of arbitrary offset, so unknown opcodes are the only way out of the VM
+    set_insn(bytecode, 0, 0);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, capture_filter_load(bytecode, insn_size, &filter));
+    set_insn(bytecode, 0, CAPTURE_FILTER_OP_MAX);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, capture_filter_load(bytecode, insn_size, &filter));
+    set_insn(bytecode, 0, 0xff);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, capture_filter_load(bytecode, insn_size, &filter));
+}
+
+static void test_verifier_stack_bounds(){
+    uint8_t bytecode[CONFIG_CAPTURE_FILTER_MAX_INSNS * sizeof(capture_filter_insn_t)];
+    const unsigned insn_size = sizeof(capture_filter_insn_t);
+
+    // underflow
+    set_insn(bytecode, 0, CAPTURE_FILTER_OP_NOT);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, capture_filter_load(bytecode, insn_size, &filter));
+    set_insn(bytecode, 0, CAPTURE_FILTER_OP_PROTECTED);
+    set_insn(bytecode, 1, CAPTURE_FILTER_OP_AND);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, capture_filter_load(bytecode, 2 * insn_size, &filter));
+    set_insn(bytecode, 1, CAPTURE_FILTER_OP_OR);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, capture_filter_load(bytecode, 2 * insn_size, &filter));
+    // underflow hidden by value pushed later
+    set_insn(bytecode, 2, CAPTURE_FILTER_OP_PROTECTED);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, capture_filter_load(bytecode, 3 * insn_size, &filter));
+    // more than one value left
+    set_insn(bytecode, 1, CAPTURE_FILTER_OP_PROTECTED);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, capture_filter_load(bytecode, 2 * insn_size, &filter));
+    set_insn(bytecode, 2, CAPTURE_FILTER_OP_OR);
+    TEST_ASSERT_EQUAL(ESP_OK, capture_filter_load(bytecode, 3 * insn_size, &filter));
+
+    // overflow: CAPTURE_FILTER_MAX_DEPTH values fit (host build allows long enough program) into the stack, one more doesn't
+    unsigned length = 0;
+    for(unsigned i = 0; i < CAPTURE_FILTER_MAX_DEPTH; i++){
+        set_insn(bytecode, length++, CAPTURE_FILTER_OP_PROTECTED);
+    }
+    for(unsigned i = 1; i < CAPTURE_FILTER_MAX_DEPTH; i++){
+        set_insn(bytecode, length++, CAPTURE_FILTER_OP_OR);
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, capture_filter_load(bytecode, length * insn_size, &filter));
+    length = 0;
+    for(unsigned i = 0; i <= CAPTURE_FILTER_MAX_DEPTH; i++){
+        set_insn(bytecode, length++, CAPTURE_FILTER_OP_PROTECTED);
+    }
+    for(unsigned i = 0; i < CAPTURE_FILTER_MAX_DEPTH; i++){
+        set_insn(bytecode, length++, CAPTURE_FILTER_OP_OR);
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, capture_filter_load(bytecode, length * insn_size, &filter));
+}
+
+static void test_handshake_frames(){
+    synthetic_handshake_t handshake;
+    synthetic_handshake_init(&handshake, ap, sta, 1, 1);
+    uint8_t m1[SYNTHETIC_HANDSHAKE_FRAME_MAX];
+    uint8_t m2[SYNTHETIC_HANDSHAKE_FRAME_MAX];
+    unsigned m1_length = synthetic_handshake_frame(&handshake, 1, m1);
+    unsigned m2_length = synthetic_handshake_frame(&handshake, 2, m2);
+
+    TEST_ASSERT(match("", m1, m1_length));
+    TEST_ASSERT(match("type data", m1, m1_length));
+    TEST_ASSERT(!match("type mgmt", m1, m1_length));
+    TEST_ASSERT(match("ether proto eapol", m1, m1_length));
+    TEST_ASSERT(match("ether proto 0x888e", m2, m2_length));
+    TEST_ASSERT(!match("ether proto ip", m1, m1_length));
+    TEST_ASSERT(!match("protected", m1, m1_length));
+    // BSSID is address 2 in FromDS M1 and address 1 in ToDS M2
+    TEST_ASSERT(match("bssid 02:00:00:00:00:01 and addr2 02:00:00:00:00:01", m1, m1_length));
+    TEST_ASSERT(match("bssid 02:00:00:00:00:01 and addr1 02:00:00:00:00:01", m2, m2_length));
+    TEST_ASSERT(!match("bssid 02:00:00:00:00:02", m2, m2_length));
+    TEST_ASSERT(match("ether proto eapol and not bssid 02:00:00:00:00:03", m2, m2_length));
+    TEST_ASSERT(!match("not (ether proto eapol or protected)", m2, m2_length));
+
+    // tests of truncated frame fail instead of reading beyond it
+    TEST_ASSERT(!match("ether proto eapol", m1, 24 + 7));
+    TEST_ASSERT(match("ether proto eapol", m1, 24 + 8));
+    TEST_ASSERT(!match("addr3 02:00:00:00:00:01", m1, 21));
+    TEST_ASSERT(match("addr3 02:00:00:00:00:01", m1, 22));
+    TEST_ASSERT(!match("bssid 02:00:00:00:00:01", m1, 15));
+    TEST_ASSERT(!match("type data", m1, 1));
+}
+
+static void test_synthetic_capture(){
+    unsigned length = synthetic_pcap_generate(pcap, sizeof(pcap), 42);
+    static const char *expressions[] = {
+        "type mgmt subtype beacon or subtype probe-req",
+        "ether proto eapol",
+        "type data and protected",
+        "not type mgmt",
+        "type data and not protected",
+    };
+    unsigned matched[sizeof(expressions) / sizeof(expressions[0])] = { 0 };
+    unsigned beacons = 0, eapol = 0, protected = 0, frames = 0;
+    for(unsigned offset = PCAP_GLOBAL_HEADER_LENGTH; offset < length;){
+        uint32_t frame_length;
+        memcpy(&frame_length, &pcap[offset + 8], sizeof(frame_length));
+        const uint8_t *frame = &pcap[offset + PCAP_RECORD_HEADER_LENGTH];
+        frames++;
+        beacons += (frame[0] == 0x80) || (frame[0] == 0x40);
+        protected += (frame[1] & 0x40) != 0;
+        // unprotected data frames of synthetic capture are EAPoL-Key frames
+        eapol += (frame[0] == 0x08) && !(frame[1] & 0x40);
+        for(unsigned i = 0; i < sizeof(expressions) / sizeof(expressions[0]); i++){
+            matched[i] += match(expressions[i], frame, frame_length);
+        }
+        offset += PCAP_RECORD_HEADER_LENGTH + frame_length;
+    }
+    TEST_ASSERT(eapol > 0);
+    TEST_ASSERT(protected > 0);
+    TEST_ASSERT_EQUAL(beacons, matched[0]);
+    TEST_ASSERT_EQUAL(eapol, matched[1]);
+    TEST_ASSERT_EQUAL(protected, matched[2]);
+    TEST_ASSERT_EQUAL(eapol + protected, matched[3]);
+    TEST_ASSERT_EQUAL(frames - beacons, matched[3]);
+    TEST_ASSERT_EQUAL(eapol, matched[4]);
+}
+
+int main(){
+    RUN_TEST(test_parse_errors);
+    RUN_TEST(test_compiled_postfix);
+    RUN_TEST(test_verifier_rejects_malformed_bytecode);
+    RUN_TEST(test_verifier_stack_bounds);
+    RUN_TEST(test_handshake_frames);
+    RUN_TEST(test_synthetic_capture);
+    return 0;
+}
@@ -0,0 +1,268 @@
+/**
+ * @file test_capture_log.c
+ * @brief Tests mount and replay, torn record recovery and ring wrap of capture log on RAM storage
+ */
+#include <string.h>
+#include "test.h"
+#include "capture_log.h"
+#include "crc32.h"
+
+#define SECTORS 4
+#define FRAME_LENGTH 100
+
+static uint8_t memory[SECTORS * CAPTURE_LOG_SECTOR_SIZE];
+static capture_log_ram_storage_t ram;
+static capture_log_storage_t counting_storage;
+static unsigned erase_counts[SECTORS];
+static uint8_t payload[CAPTURE_LOG_SECTOR_SIZE];
+
+static esp_err_t counting_erase_sector(void *ctx, unsigned offset){
+    erase_counts[offset / CAPTURE_LOG_SECTOR_SIZE]++;
+    return ram.storage.erase_sector(ctx, offset);
+}
+
+static void remount(){
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_init_storage(&counting_storage));
+}
+
+static void format(){
+    memset(memory, 0xff, sizeof(memory));
+    memset(erase_counts, 0, sizeof(erase_counts));
+    counting_storage = *capture_log_ram_storage_init(&ram, memory, sizeof(memory));
+    counting_storage.erase_sector = counting_erase_sector;
+    remount();
+}
+
+static uint16_t start_session(uint8_t channel){
+    capture_log_session_info_t info = { .attack_type = 1, .channel = channel, .ssid_length = 4 };
+    memcpy(info.ssid, "test", 4);
+    uint16_t id = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_session_start(&info, &id));
+    return id;
+}
+
+static void append_frame(uint16_t session_id, unsigned index){
+    capture_log_frame_t frame_info = { .ts_usec = index, .channel = 6, .rssi = -40 };
+    uint8_t frame[FRAME_LENGTH];
+    memset(frame, (uint8_t) (session_id + index), sizeof(frame));
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_append_frame(&frame_info, frame, sizeof(frame)));
+}
+
+/**
+ * @brief Reads session by iterator and checks its records, returns number of frames read
+ */
+static unsigned read_session(uint16_t session_id, bool ended){
+    capture_log_iterator_t iterator;
+    capture_log_record_header_t header;
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_iterator_init(session_id, &iterator));
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_iterator_next(&iterator, &header, payload));
+    TEST_ASSERT_EQUAL(CAPTURE_LOG_RECORD_SESSION_START, header.type);
+
+    unsigned frames = 0;
+    bool end_read = false;
+    esp_err_t err;
+    while((err = capture_log_iterator_next(&iterator, &header, payload)) == ESP_OK){
+        TEST_ASSERT_EQUAL(session_id, header.session_id);
+        TEST_ASSERT(!end_read);
+        if(header.type == CAPTURE_LOG_RECORD_SESSION_END){
+            end_read = true;
+            continue;
+        }
+        if(header.type != CAPTURE_LOG_RECORD_FRAME){
+            continue;
+        }
+        TEST_ASSERT_EQUAL(sizeof(capture_log_frame_t) + FRAME_LENGTH, header.length);
+        capture_log_frame_t frame_info;
+        memcpy(&frame_info, payload, sizeof(frame_info));
+        TEST_ASSERT_EQUAL(frames, frame_info.ts_usec);
+        for(unsigned i = 0; i < FRAME_LENGTH; i++){
+            TEST_ASSERT_EQUAL((uint8_t) (session_id + frames), payload[sizeof(capture_log_frame_t) + i]);
+        }
+        frames++;
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, err);
+    TEST_ASSERT_EQUAL(ended, end_read);
+    return frames;
+}
+
+static void test_mount_replay(){
+    format();
+    capture_log_session_t sessions[CONFIG_CAPTURE_LOG_MAX_SESSIONS];
+    TEST_ASSERT_EQUAL(0, capture_log_get_sessions(sessions, CONFIG_CAPTURE_LOG_MAX_SESSIONS));
+
+    uint16_t first = start_session(6);
+    for(unsigned i = 0; i < 10; i++){
+        append_frame(first, i);
+    }
+    uint8_t pmkid[56] = { 0 };
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_append(CAPTURE_LOG_RECORD_PMKID, pmkid, sizeof(pmkid)));
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_session_end(3));
+    uint16_t second = start_session(11);
+    append_frame(second, 0);
+    append_frame(second, 1);
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_session_end(4));
+
+    remount();
+    TEST_ASSERT_EQUAL(2, capture_log_get_sessions(sessions, CONFIG_CAPTURE_LOG_MAX_SESSIONS));
+    TEST_ASSERT_EQUAL(second, sessions[0].id);
+    TEST_ASSERT_EQUAL(first, sessions[1].id);
+    TEST_ASSERT_EQUAL(CAPTURE_LOG_SESSION_ENDED, sessions[1].flags);
+    TEST_ASSERT_EQUAL(3, sessions[1].status);
+    TEST_ASSERT_EQUAL(6, sessions[1].info.channel);
+    TEST_ASSERT(memcmp(sessions[1].info.ssid, "test", 4) == 0);
+    TEST_ASSERT_EQUAL(10, sessions[1].frames);
+    TEST_ASSERT_EQUAL(1, sessions[1].pmkids);
+    TEST_ASSERT_EQUAL(2, sessions[0].frames);
+    TEST_ASSERT_EQUAL(4, sessions[0].status);
+    TEST_ASSERT_EQUAL(10, read_session(first, true));
+    TEST_ASSERT_EQUAL(2, read_session(second, true));
+
+    // writing continues after the last record with the next session ID
+    uint16_t third = start_session(1);
+    TEST_ASSERT_EQUAL(second + 1, third);
+    append_frame(third, 0);
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_session_end(0));
+    remount();
+    TEST_ASSERT_EQUAL(3, capture_log_get_sessions(sessions, CONFIG_CAPTURE_LOG_MAX_SESSIONS));
+    TEST_ASSERT_EQUAL(0, sessions[0].start_sector);
+    TEST_ASSERT_EQUAL(1, read_session(third, true));
+    TEST_ASSERT_EQUAL(10, read_session(first, true));
+}
+
+static void test_unflushed_records_lost(){
+    format();
+    uint16_t id = start_session(6);
+    append_frame(id, 0);
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_flush());
+    // stays below flush threshold, lost like on power loss
+    append_frame(id, 1);
+    TEST_ASSERT_EQUAL(2, read_session(id, false));
+
+    remount();
+    capture_log_session_t session;
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_get_session(id, &session));
+    TEST_ASSERT_EQUAL(0, session.flags);
+    TEST_ASSERT_EQUAL(1, session.frames);
+    TEST_ASSERT_EQUAL(1, read_session(id, false));
+}
+
+static void test_torn_record(){
+    format();
+    uint16_t id = start_session(6);
+    for(unsigned i = 0; i < 4; i++){
+        append_frame(id, i);
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_flush());
+    static uint8_t before[sizeof(memory)];
+    memcpy(before, memory, sizeof(memory));
+    append_frame(id, 4);
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_flush());
+
+    // power loss in the middle of programming the last record: its second half stays erased
+    unsigned start = 0;
+    while(memory[start] == before[start]){
+        start++;
+    }
+    unsigned record_size = sizeof(capture_log_record_header_t) + sizeof(capture_log_frame_t) + FRAME_LENGTH;
+    memset(&memory[start + record_size / 2], 0xff, record_size - record_size / 2);
+
+    remount();
+    capture_log_session_t session;
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_get_session(id, &session));
+    TEST_ASSERT_EQUAL(4, session.frames);
+    TEST_ASSERT_EQUAL(0, session.flags);
+    TEST_ASSERT_EQUAL(4, read_session(id, false));
+
+    // torn record ends its sector, nothing is written behind it
+    uint16_t next = start_session(1);
+    append_frame(next, 0);
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_session_end(0));
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_get_session(next, &session));
+    TEST_ASSERT_EQUAL(1, session.start_sector);
+    for(unsigned i = start + record_size / 2; i < CAPTURE_LOG_SECTOR_SIZE; i++){
+        TEST_ASSERT_EQUAL(0xff, memory[i]);
+    }
+
+    remount();
+    TEST_ASSERT_EQUAL(4, read_session(id, false));
+    TEST_ASSERT_EQUAL(1, read_session(next, true));
+}
+
+static void test_torn_sector_header(){
+    format();
+    uint16_t id = start_session(6);
+    append_frame(id, 0);
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_session_end(0));
+
+    // power loss right after the next sector was erased and its header partly written
+    memory[CAPTURE_LOG_SECTOR_SIZE] = 0x43;
+    remount();
+    capture_log_session_t session;
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_get_session(id, &session));
+    TEST_ASSERT_EQUAL(1, read_session(id, true));
+    uint16_t next = start_session(1);
+    TEST_ASSERT_EQUAL(id + 1, next);
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_session_end(0));
+    remount();
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_get_session(next, &session));
+    TEST_ASSERT_EQUAL(0, session.start_sector);
+}
+
+static void check_wrapped_sessions(uint16_t last, unsigned frames_per_session){
+    capture_log_session_t sessions[CONFIG_CAPTURE_LOG_MAX_SESSIONS];
+    unsigned count = capture_log_get_sessions(sessions, CONFIG_CAPTURE_LOG_MAX_SESSIONS);
+    // sessions spanning more than one sector, so less than SECTORS of them fit
+    TEST_ASSERT(count >= 2);
+    TEST_ASSERT(count < SECTORS);
+    for(unsigned i = 0; i < count; i++){
+        TEST_ASSERT_EQUAL(last - i, sessions[i].id);
+        TEST_ASSERT_EQUAL(frames_per_session, sessions[i].frames);
+        TEST_ASSERT_EQUAL(frames_per_session, read_session(sessions[i].id, true));
+    }
+    // the session before the oldest indexed one has lost its start sector
+    capture_log_iterator_t iterator;
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, capture_log_iterator_init(last - count, &iterator));
+}
+
+static void test_ring_wrap(){
+    format();
+    const unsigned frames_per_session = 40;
+    uint16_t last = 0;
+    for(unsigned session = 0; session < 20; session++){
+        last = start_session(session);
+        for(unsigned i = 0; i < frames_per_session; i++){
+            append_frame(last, i);
+        }
+        TEST_ASSERT_EQUAL(ESP_OK, capture_log_session_end(0));
+    }
+    check_wrapped_sessions(last, frames_per_session);
+    remount();
+    check_wrapped_sessions(last, frames_per_session);
+
+    // sectors are erased in turn, so wear is even
+    for(unsigned i = 1; i < SECTORS; i++){
+        TEST_ASSERT(erase_counts[i] + 1 >= erase_counts[0]);
+        TEST_ASSERT(erase_counts[i] <= erase_counts[0]);
+    }
+    TEST_ASSERT(erase_counts[0] > 2);
+
+    // writing continues in ring after remount
+    uint16_t next = start_session(1);
+    TEST_ASSERT_EQUAL(last + 1, next);
+    for(unsigned i = 0; i < frames_per_session; i++){
+        append_frame(next, i);
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, capture_log_session_end(0));
+    remount();
+    check_wrapped_sessions(next, frames_per_session);
+}
+
+int main(){
+    crc32_init();
+    RUN_TEST(test_mount_replay);
+    RUN_TEST(test_unflushed_records_lost);
+    RUN_TEST(test_torn_record);
+    RUN_TEST(test_torn_sector_header);
+    RUN_TEST(test_ring_wrap);
+    return 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file test_frame_trace.c
+ * @brief Tests trace ring order and overwriting and Chrome trace JSON export of frame trace
+ */
+#include <string.h>
+#include "test.h"
+#include "frame_trace.h"
+#include "freertos/task.h"
+
+static char json[256 * 1024];
+static unsigned json_length;
+
+static esp_err_t buffer_writer(void *ctx, const char *text){
+    (void) ctx;
+    unsigned length = strlen(text);
+    TEST_ASSERT(json_length + length < sizeof(json));
+    memcpy(&json[json_length], text, length + 1);
+    json_length += length;
+    return ESP_OK;
+}
+
+static esp_err_t failing_writer(void *ctx, const char *text){
+    (void) text;
+    return ((*(unsigned *) ctx)++ == 0) ? ESP_OK : ESP_FAIL;
+}
+
+static void export(){
+    json_length = 0;
+    json[0] = '\0';
+    TEST_ASSERT_EQUAL(ESP_OK, frame_trace_write_json(buffer_writer, NULL));
+    TEST_ASSERT(strncmp(json, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", 40) == 0);
+    TEST_ASSERT(strcmp(&json[json_length - 4], "\n]}\n") == 0);
+}
+
+static unsigned count(const char *needle){
+    unsigned found = 0;
+    for(const char *position = json; (position = strstr(position, needle)) != NULL; position++){
+        found++;
+    }
+    return found;
+}
+
+static void test_empty(){
+    frame_trace_clear();
+    export();
+    TEST_ASSERT_EQUAL(0, count("\"ph\""));
+}
+
+static void test_events(){
+    frame_trace_clear();
+    uint32_t start = frame_trace_now();
+    frame_trace_async(FRAME_TRACE_STAGE_QUEUE_DWELL, FRAME_TRACE_PHASE_ASYNC_BEGIN, 0x1234);
+    frame_trace_async(FRAME_TRACE_STAGE_QUEUE_DWELL, FRAME_TRACE_PHASE_ASYNC_END, 0x1234);
+    frame_trace_complete(FRAME_TRACE_STAGE_PCAP_APPEND, start);
+    export();
+    TEST_ASSERT_EQUAL(3, count("\"ph\""));
+    TEST_ASSERT_EQUAL(1, count("\"name\":\"queue dwell\",\"cat\":\"frame\",\"ph\":\"b\""));
+    TEST_ASSERT_EQUAL(1, count("\"name\":\"queue dwell\",\"cat\":\"frame\",\"ph\":\"e\""));
+    TEST_ASSERT_EQUAL(2, count("\"id\":\"0x00001234\""));
+    TEST_ASSERT_EQUAL(1, count("\"name\":\"pcap append\",\"cat\":\"frame\",\"ph\":\"X\""));
+    // events are separated by commas, the oldest first
+    TEST_ASSERT_EQUAL(2, count("},\n{"));
+    TEST_ASSERT(strstr(json, "\"ph\":\"b\"") < strstr(json, "\"ph\":\"e\""));
+    TEST_ASSERT(strstr(json, "\"ph\":\"e\"") < strstr(json, "\"ph\":\"X\""));
+}
+
+static void test_ring_overwrite(){
+    frame_trace_clear();
+    const unsigned extra = 10;
+    for(unsigned i = 0; i < CONFIG_FRAME_TRACE_RING_SIZE + extra; i++){
+        frame_trace_async(FRAME_TRACE_STAGE_QUEUE_DWELL, FRAME_TRACE_PHASE_ASYNC_BEGIN, i);
+    }
+    export();
+    TEST_ASSERT_EQUAL(CONFIG_FRAME_TRACE_RING_SIZE, count("\"ph\""));
+    // the oldest events were overwritten
+    TEST_ASSERT(strstr(json, "\"id\":\"0x00000009\"") == NULL);
+    char id[32];
+    snprintf(id, sizeof(id), "\"id\":\"0x%08x\"", extra);
+    TEST_ASSERT(strstr(json, id) == strstr(json, "\"id\""));
+    snprintf(id, sizeof(id), "\"id\":\"0x%08x\"", CONFIG_FRAME_TRACE_RING_SIZE + extra - 1);
+    TEST_ASSERT(strstr(json, id) != NULL);
+}
+
+static void named_task(void *arg){
+    frame_trace_complete(FRAME_TRACE_STAGE_SNIFFER_CALLBACK, frame_trace_now());
+    __atomic_store_n((bool *) arg, true, __ATOMIC_RELEASE);
+    while(true){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+
+static void test_thread_names(){
+    frame_trace_clear();
+    static bool recorded = false;
+    TaskHandle_t task;
+    xTaskCreatePinnedToCore(named_task, "sniffer", 4096, &recorded, 5, &task, 0);
+    while(!__atomic_load_n(&recorded, __ATOMIC_ACQUIRE)){
+        vTaskDelay(1);
+    }
+    export();
+    char tid[64];
+    snprintf(tid, sizeof(tid), "\"tid\":%u,\"args\":{\"name\":\"sniffer\"}", (uint32_t) (uintptr_t) task);
+    TEST_ASSERT_EQUAL(1, count(tid));
+    snprintf(tid, sizeof(tid), "\"tid\":%u,\"args\":{\"core\":", (uint32_t) (uintptr_t) task);
+    TEST_ASSERT_EQUAL(1, count(tid));
+}
+
+static void test_writer_error(){
+    frame_trace_clear();
+    frame_trace_complete(FRAME_TRACE_STAGE_SNIFFER_CALLBACK, frame_trace_now());
+    unsigned calls = 0;
+    TEST_ASSERT_EQUAL(ESP_FAIL, frame_trace_write_json(failing_writer, &calls));
+    TEST_ASSERT_EQUAL(2, calls);
+    // recording continues after failed export
+    frame_trace_complete(FRAME_TRACE_STAGE_SNIFFER_CALLBACK, frame_trace_now());
+    export();
+    TEST_ASSERT_EQUAL(2, count("\"cat\":\"frame\""));
+}
+
+int main(){
+    RUN_TEST(test_empty);
+    RUN_TEST(test_events);
+    RUN_TEST(test_ring_overwrite);
+    RUN_TEST(test_thread_names);
+    RUN_TEST(test_writer_error);
+    return 0;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file test_gzip_stream.c
+ * @brief Tests that output of gzip stream decompresses by zlib to original data
+ */
+#include <string.h>
+#include <zlib.h>
+#include "test.h"
+#include "gzip_stream.h"
+#include "crc32.h"
+#include "synthetic_pcap.h"
+
+#define INPUT_SIZE (256 * 1024)
+
+static uint8_t input[INPUT_SIZE];
+static uint8_t compressed[INPUT_SIZE + INPUT_SIZE / 8 + 64];
+static uint8_t decompressed[INPUT_SIZE];
+static unsigned compressed_length;
+static gzip_stream_t stream;
+
+static esp_err_t buffer_writer(void *ctx, const uint8_t *data, unsigned length){
+    (void) ctx;
+    TEST_ASSERT(length <= GZIP_STREAM_OUTPUT_SIZE);
+    TEST_ASSERT(compressed_length + length <= sizeof(compressed));
+    memcpy(&compressed[compressed_length], data, length);
+    compressed_length += length;
+    return ESP_OK;
+}
+
+static esp_err_t failing_writer(void *ctx, const uint8_t *data, unsigned length){
+    (void) data;
+    (void) length;
+    (*(unsigned *) ctx)++;
+    return ESP_FAIL;
+}
+
+/**
+ * @brief Compresses input written in chunks of pseudo random length up to max_chunk and checks zlib inflates it back
+ *
+ * @return unsigned compressed length
+ */
+static unsigned round_trip(unsigned length, unsigned max_chunk){
+    compressed_length = 0;
+    gzip_stream_init(&stream, buffer_writer, NULL);
+    uint32_t random = 12345;
+    for(unsigned offset = 0; offset < length;){
+        random = random * 1103515245 + 12345;
+        unsigned chunk = 1 + (random >> 8) % max_chunk;
+        if(chunk > length - offset){
+            chunk = length - offset;
+        }
+        TEST_ASSERT_EQUAL(ESP_OK, gzip_stream_write(&stream, &input[offset], chunk));
+        offset += chunk;
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, gzip_stream_finish(&stream));
+
+    z_stream z;
+    memset(&z, 0, sizeof(z));
+    TEST_ASSERT_EQUAL(Z_OK, inflateInit2(&z, 16 + MAX_WBITS));
+    z.next_in = compressed;
+    z.avail_in = compressed_length;
+    z.next_out = decompressed;
+    z.avail_out = sizeof(decompressed);
+    // gzip trailer (CRC32 and size) is verified by zlib
+    TEST_ASSERT_EQUAL(Z_STREAM_END, inflate(&z, Z_FINISH));
+    TEST_ASSERT_EQUAL(0, z.avail_in);
+    TEST_ASSERT_EQUAL(length, z.total_out);
+    TEST_ASSERT(memcmp(input, decompressed, length) == 0);
+    inflateEnd(&z);
+    return compressed_length;
+}
+
+static void test_empty_and_short(){
+    round_trip(0, 1);
+    input[0] = 'a';
+    round_trip(1, 1);
+    memcpy(input, "abcabcabcabd", 12);
+    round_trip(12, 1);
+    round_trip(12, 12);
+}
+
+static void test_long_runs(){
+    // runs longer than maximal match and window
+    memset(input, 'x', 3 * CONFIG_GZIP_STREAM_WINDOW_SIZE + 1000);
+    unsigned length = round_trip(3 * CONFIG_GZIP_STREAM_WINDOW_SIZE + 1000, 4096);
+    TEST_ASSERT(length < 200);
+}
+
+static void test_matches_at_window_distance(){
+    // period close to window size, so matches are at the far end of history
+    const unsigned periods[] = { CONFIG_GZIP_STREAM_WINDOW_SIZE - 1, CONFIG_GZIP_STREAM_WINDOW_SIZE,
+        CONFIG_GZIP_STREAM_WINDOW_SIZE + 1, 2 * CONFIG_GZIP_STREAM_WINDOW_SIZE - 1 };
+    for(unsigned p = 0; p < sizeof(periods) / sizeof(periods[0]); p++){
+        synthetic_random_fill(input, periods[p], p + 1);
+        for(unsigned i = periods[p]; i < 8 * CONFIG_GZIP_STREAM_WINDOW_SIZE; i++){
+            input[i] = input[i - periods[p]];
+        }
+        round_trip(8 * CONFIG_GZIP_STREAM_WINDOW_SIZE, 700);
+    }
+}
+
+static void test_pcap(){
+    unsigned length = synthetic_pcap_generate(input, INPUT_SIZE, 7);
+    unsigned compressed_pcap = round_trip(length, 3000);
+    TEST_ASSERT(compressed_pcap < length);
+    round_trip(length, 17);
+}
+
+static void test_random(){
+    synthetic_random_fill(input, INPUT_SIZE, 3);
+    unsigned length = round_trip(INPUT_SIZE, 1500);
+    // fixed Huffman codes of literals 144-255 are 9 bits long
+    TEST_ASSERT(length < INPUT_SIZE + INPUT_SIZE / 16 + 64);
+}
+
+static void test_writer_error(){
+    unsigned calls = 0;
+    gzip_stream_init(&stream, failing_writer, &calls);
+    synthetic_random_fill(input, 4 * GZIP_STREAM_OUTPUT_SIZE, 5);
+    esp_err_t err = ESP_OK;
+    for(unsigned i = 0; (i < 4) && (err == ESP_OK); i++){
+        err = gzip_stream_write(&stream, &input[i * GZIP_STREAM_OUTPUT_SIZE], GZIP_STREAM_OUTPUT_SIZE);
+    }
+    if(err == ESP_OK){
+        err = gzip_stream_finish(&stream);
+    }
+    TEST_ASSERT_EQUAL(ESP_FAIL, err);
+    TEST_ASSERT(calls > 0);
+}
+
+int main(){
+    crc32_init();
+    RUN_TEST(test_empty_and_short);
+    RUN_TEST(test_long_runs);
+    RUN_TEST(test_matches_at_window_distance);
+    RUN_TEST(test_pcap);
+    RUN_TEST(test_random);
+    RUN_TEST(test_writer_error);
+    return 0;
+}
@@ -0,0 +1,275 @@
+/**
+ * @file test_handshake_states.c
+ * @brief Feeds 4-way handshake messages in every order, with duplicates and shifted replay counters
+ * through HCCAPX serializer and checks the handshake state it reaches and ranking of message pairs
+ */
+#include <string.h>
+#include <arpa/inet.h>
+#include "test.h"
+#include "hccapx_serializer.h"
+#include "frame_analyzer_types.h"
+
+static const uint8_t mac_ap[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+static const uint8_t mac_sta[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+static const uint8_t ssid[] = "test";
+
+#define REPLAY_COUNTER 5
+
+/**
+ * @brief Handshake message to be fed into serializer
+ */
+typedef struct {
+    uint8_t message;            //< 1-4
+    int8_t replay_counter_shift; //< added to replay counter of correct handshake
+    uint8_t anonce;             //< byte ANonce of AP message is filled with, 0 for default ANONCE
+} message_t;
+
+#define ANONCE 0xa0
+#define SNONCE 0x50
+
+/**
+ * @brief Builds data frame with WPA2 EAPoL-Key packet of given handshake message
+ *
+ * @return unsigned length of frame
+ */
+static unsigned build_frame(const message_t *message, uint8_t *buffer){
+    bool from_ap = (message->message == 1) || (message->message == 3);
+    memset(buffer, 0, 256);
+    data_frame_t *frame = (data_frame_t *) buffer;
+    frame->mac_header.frame_control.type = 2;
+    memcpy(frame->mac_header.addr1, from_ap ? mac_sta : mac_ap, 6);
+    memcpy(frame->mac_header.addr2, from_ap ? mac_ap : mac_sta, 6);
+    memcpy(frame->mac_header.addr3, mac_ap, 6);
+
+    uint8_t *body = frame->body;
+    const uint8_t llc_snap[] = { 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x88, 0x8e };
+    memcpy(body, llc_snap, sizeof(llc_snap));
+    eapol_packet_t *eapol_packet = (eapol_packet_t *) &body[sizeof(llc_snap)];
+    eapol_packet->header.version = 2;
+    eapol_packet->header.packet_type = EAPOL_KEY;
+    eapol_packet->header.packet_body_length = htons(sizeof(eapol_key_packet_t));
+
+    eapol_key_packet_t *key = (eapol_key_packet_t *) eapol_packet->packet_body;
+    key->descriptor_type = 2;
+    key->key_information.key_descriptor_version = KEY_DESCRIPTOR_VERSION_HMAC_SHA1_AES;
+    key->key_information.key_type = KEY_TYPE_PAIRWISE;
+    key->key_information.key_ack = from_ap;
+    key->key_information.key_mic = message->message != 1;
+    key->key_information.install = message->message == 3;
+    key->key_information.secure = message->message >= 3;
+    uint64_t replay_counter = REPLAY_COUNTER + ((message->message >= 3) ? 1 : 0) + message->replay_counter_shift;
+    for(unsigned i = 0; i < 8; i++){
+        key->key_replay_counter[7 - i] = replay_counter >> (8 * i);
+    }
+    if(from_ap){
+        memset(key->key_nonce, (message->anonce != 0) ? message->anonce : ANONCE, sizeof(key->key_nonce));
+    }
+    else if(message->message == 2){
+        memset(key->key_nonce, SNONCE, sizeof(key->key_nonce));
+    }
+    if(message->message != 1){
+        memset(key->key_mic, message->message, sizeof(key->key_mic));
+    }
+    return sizeof(data_frame_mac_header_t) + sizeof(llc_snap) + sizeof(eapol_packet_header_t) + sizeof(eapol_key_packet_t);
+}
+
+static hccapx_handshake_state_t feed(const message_t *messages, unsigned count){
+    uint8_t buffer[256];
+    hccapx_serializer_init(ssid, sizeof(ssid));
+    for(unsigned i = 0; i < count; i++){
+        unsigned length = build_frame(&messages[i], buffer);
+        hccapx_serializer_add_frame((data_frame_t *) buffer, length, i * 1000);
+    }
+    return hccapx_serializer_get_state();
+}
+
+/**
+ * @brief Reference model of 4-way handshake progress (802.11-2016 [12.7.6]).
+ *
+ * M1 starts new exchange, M2 answers it with the same replay counter, M3 follows with incremented
+ * counter and M4 answers M3 with its counter. Anything else leaves the exchange where it is.
+ */
+static hccapx_handshake_state_t expected_state(const message_t *messages, unsigned count){
+    hccapx_handshake_state_t state = HCCAPX_HANDSHAKE_NONE;
+    hccapx_handshake_state_t best = HCCAPX_HANDSHAKE_NONE;
+    int exchange_counter = 0;
+    for(unsigned i = 0; i < count; i++){
+        int counter = REPLAY_COUNTER + ((messages[i].message >= 3) ? 1 : 0) + messages[i].replay_counter_shift;
+        switch(messages[i].message){
+            case 1:
+                state = HCCAPX_HANDSHAKE_M1;
+                exchange_counter = counter;
+                break;
+            case 2:
+                if((state == HCCAPX_HANDSHAKE_M1) && (counter == exchange_counter)){
+                    state = HCCAPX_HANDSHAKE_CHALLENGE;
+                }
+                break;
+            case 3:
+                if((state == HCCAPX_HANDSHAKE_CHALLENGE) && (counter == exchange_counter + 1)){
+                    state = HCCAPX_HANDSHAKE_AUTHORIZED;
+                    exchange_counter = counter;
+                }
+                break;
+            case 4:
+                if((state == HCCAPX_HANDSHAKE_AUTHORIZED) && (counter == exchange_counter)){
+                    state = HCCAPX_HANDSHAKE_COMPLETE;
+                }
+                break;
+        }
+        if(state > best){
+            best = state;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Generates permutation of M1-M4 by index 0-23
+ */
+static void permutation(unsigned index, message_t *messages){
+    uint8_t remaining[4] = { 1, 2, 3, 4 };
+    unsigned left = 4;
+    for(unsigned i = 0; i < 4; i++){
+        unsigned factorial = 1;
+        for(unsigned f = 2; f < left; f++){
+            factorial *= f;
+        }
+        unsigned pick = index / factorial;
+        index %= factorial;
+        messages[i] = (message_t) { .message = remaining[pick] };
+        memmove(&remaining[pick], &remaining[pick + 1], left - pick - 1);
+        left--;
+    }
+}
+
+static void test_known_sequences(){
+    const message_t in_order[] = { { 1 }, { 2 }, { 3 }, { 4 } };
+    TEST_ASSERT_EQUAL(HCCAPX_HANDSHAKE_COMPLETE, feed(in_order, 4));
+    hccapx_t hccapx;
+    TEST_ASSERT(hccapx_serializer_get(&hccapx));
+    TEST_ASSERT_EQUAL(0, hccapx.message_pair & 0x80);
+    TEST_ASSERT(memcmp(hccapx.mac_ap, mac_ap, 6) == 0);
+    TEST_ASSERT(memcmp(hccapx.mac_sta, mac_sta, 6) == 0);
+
+    const message_t reversed[] = { { 4 }, { 3 }, { 2 }, { 1 } };
+    TEST_ASSERT_EQUAL(HCCAPX_HANDSHAKE_M1, feed(reversed, 4));
+    const message_t without_m2[] = { { 1 }, { 3 }, { 4 } };
+    TEST_ASSERT_EQUAL(HCCAPX_HANDSHAKE_M1, feed(without_m2, 3));
+    const message_t m4_before_m3[] = { { 1 }, { 2 }, { 4 }, { 3 } };
+    TEST_ASSERT_EQUAL(HCCAPX_HANDSHAKE_AUTHORIZED, feed(m4_before_m3, 4));
+    const message_t m1_restart[] = { { 1 }, { 2 }, { 1 }, { 3 }, { 4 } };
+    TEST_ASSERT_EQUAL(HCCAPX_HANDSHAKE_CHALLENGE, feed(m1_restart, 5));
+    const message_t stale_m2[] = { { 1 }, { 2, -1 }, { 3 }, { 4 } };
+    TEST_ASSERT_EQUAL(HCCAPX_HANDSHAKE_M1, feed(stale_m2, 4));
+    const message_t replayed_m3[] = { { 1 }, { 2 }, { 3, 1 }, { 4, 1 } };
+    TEST_ASSERT_EQUAL(HCCAPX_HANDSHAKE_CHALLENGE, feed(replayed_m3, 4));
+    TEST_ASSERT_EQUAL(HCCAPX_HANDSHAKE_NONE, feed(NULL, 0));
+}
+
+static void test_all_orders(){
+    for(unsigned p = 0; p < 24; p++){
+        message_t messages[4];
+        permutation(p, messages);
+        TEST_ASSERT_EQUAL(expected_state(messages, 4), feed(messages, 4));
+    }
+}
+
+static void test_all_orders_with_duplicate(){
+    for(unsigned p = 0; p < 24; p++){
+        message_t messages[4];
+        permutation(p, messages);
+        for(unsigned duplicate = 0; duplicate < 4; duplicate++){
+            for(unsigned position = 0; position <= 4; position++){
+                message_t sequence[5];
+                memcpy(sequence, messages, position * sizeof(message_t));
+                sequence[position] = messages[duplicate];
+                memcpy(&sequence[position + 1], &messages[position], (4 - position) * sizeof(message_t));
+                TEST_ASSERT_EQUAL(expected_state(sequence, 5), feed(sequence, 5));
+            }
+        }
+    }
+}
+
+static void test_all_orders_with_replay_counter_shifts(){
+    for(unsigned p = 0; p < 24; p++){
+        message_t messages[4];
+        permutation(p, messages);
+        // every message shifted by -1, 0 or +1
+        for(unsigned shifts = 0; shifts < 81; shifts++){
+            unsigned digits = shifts;
+            for(unsigned i = 0; i < 4; i++){
+                messages[i].replay_counter_shift = (int) (digits % 3) - 1;
+                digits /= 3;
+            }
+            TEST_ASSERT_EQUAL(expected_state(messages, 4), feed(messages, 4));
+        }
+    }
+}
+
+/**
+ * @brief Checks message pair field of ranked pairs from the best one
+ */
+static void assert_ranking(const uint8_t *message_pairs, unsigned count){
+    hccapx_t pairs[CONFIG_HCCAPX_MAX_PAIRS];
+    TEST_ASSERT_EQUAL(count, hccapx_serializer_get_pair_count());
+    TEST_ASSERT_EQUAL(count, hccapx_serializer_get_pairs(pairs, CONFIG_HCCAPX_MAX_PAIRS));
+    for(unsigned rank = 0; rank < count; rank++){
+        TEST_ASSERT_EQUAL(message_pairs[rank], pairs[rank].message_pair);
+    }
+}
+
+static void test_rank_complete_handshake(){
+    // messages are 1 ms apart
+    const message_t in_order[] = { { 1 }, { 2 }, { 3 }, { 4 } };
+    feed(in_order, 4);
+    // authorized pairs first, then by time between messages (M1-M4 are 3 ms apart)
+    const uint8_t expected[] = { HCCAPX_MESSAGE_PAIR_M32E2, HCCAPX_MESSAGE_PAIR_M34E4, HCCAPX_MESSAGE_PAIR_M14E4, HCCAPX_MESSAGE_PAIR_M12E2 };
+    assert_ranking(expected, 4);
+
+    hccapx_t hccapx;
+    TEST_ASSERT(hccapx_serializer_get_pair(1, &hccapx));
+    TEST_ASSERT_EQUAL(ANONCE, hccapx.nonce_ap[0]);
+    // M4 carries no SNonce, it's taken from M2
+    TEST_ASSERT_EQUAL(SNONCE, hccapx.nonce_sta[31]);
+    TEST_ASSERT_EQUAL(4, hccapx.keymic[0]);
+    TEST_ASSERT(!hccapx_serializer_get_pair(4, &hccapx));
+}
+
+static void test_rank_replay_counter(){
+    // matching replay counter wins over shorter time between messages
+    const message_t stale_m2_first[] = { { 1 }, { 2, -1 }, { 2 } };
+    feed(stale_m2_first, 3);
+    const uint8_t expected[] = { HCCAPX_MESSAGE_PAIR_M12E2, HCCAPX_MESSAGE_PAIR_M12E2 | HCCAPX_MESSAGE_PAIR_RC_NOT_MATCHING };
+    assert_ranking(expected, 2);
+
+    // and over authorization
+    const message_t replayed_m3[] = { { 1 }, { 2 }, { 3, 1 } };
+    feed(replayed_m3, 3);
+    const uint8_t expected_replayed[] = { HCCAPX_MESSAGE_PAIR_M12E2, HCCAPX_MESSAGE_PAIR_M32E2 | HCCAPX_MESSAGE_PAIR_RC_NOT_MATCHING };
+    assert_ranking(expected_replayed, 2);
+}
+
+static void test_rank_nonce_consistency(){
+    // M1 and M3 of the first exchange disagree on ANonce, so the unauthorized pair of the second exchange wins
+    const message_t messages[] = { { 1, 0, 0xa1 }, { 2 }, { 3, 0, 0xa3 }, { 1, 4, 0xa4 }, { 2, 4 } };
+    feed(messages, 5);
+    const uint8_t expected[] = { HCCAPX_MESSAGE_PAIR_M12E2, HCCAPX_MESSAGE_PAIR_M32E2, HCCAPX_MESSAGE_PAIR_M12E2,
+        HCCAPX_MESSAGE_PAIR_M12E2 | HCCAPX_MESSAGE_PAIR_RC_NOT_MATCHING };
+    assert_ranking(expected, 4);
+    hccapx_t pairs[2];
+    TEST_ASSERT_EQUAL(2, hccapx_serializer_get_pairs(pairs, 2));
+    TEST_ASSERT_EQUAL(0xa4, pairs[0].nonce_ap[0]);
+    TEST_ASSERT_EQUAL(0xa3, pairs[1].nonce_ap[0]);
+}
+
+int main(){
+    RUN_TEST(test_known_sequences);
+    RUN_TEST(test_all_orders);
+    RUN_TEST(test_all_orders_with_duplicate);
+    RUN_TEST(test_all_orders_with_replay_counter_shifts);
+    RUN_TEST(test_rank_complete_handshake);
+    RUN_TEST(test_rank_replay_counter);
+    RUN_TEST(test_rank_nonce_consistency);
+    return 0;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file test_mac_address.c
+ * @brief Tests MAC address packing, hashing and MAC set/map containers
+ */
+#include "test.h"
+#include "mac_address.h"
+
+static const uint8_t mac_bytes[6] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+
+static void test_load_store_round_trip(){
+    mac_t mac = mac_load(mac_bytes);
+    TEST_ASSERT_EQUAL(0x060504030201ULL, mac);
+    uint8_t stored[8] = { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa };
+    mac_store(mac, stored);
+    TEST_ASSERT(memcmp(stored, mac_bytes, 6) == 0);
+    // only 6 bytes are written
+    TEST_ASSERT_EQUAL(0xaa, stored[6]);
+    TEST_ASSERT(mac_bytes_equal(stored, mac_bytes));
+    TEST_ASSERT_EQUAL(0x010203, mac_oui(mac));
+    TEST_ASSERT(mac_is_group(mac));
+    TEST_ASSERT(!mac_is_group(mac & ~1ULL));
+    TEST_ASSERT(mac_is_group(MAC_BROADCAST));
+    TEST_ASSERT(mac_is_zero(MAC_NONE));
+}
+
+static void test_hash_distribution(){
+    // sequential addresses of one vendor must spread over buckets
+    enum { BUCKETS = 64, KEYS = 1024 };
+    unsigned hits[BUCKETS] = { 0 };
+    for(unsigned i = 0; i < KEYS; i++){
+        mac_t mac = 0x0000AC0F0000ULL | ((mac_t) i << 40) | i;
+        TEST_ASSERT_EQUAL(mac_hash(mac), mac_hash(mac));
+        hits[mac_hash(mac) % BUCKETS]++;
+    }
+    for(unsigned i = 0; i < BUCKETS; i++){
+        TEST_ASSERT(hits[i] > 0);
+        TEST_ASSERT(hits[i] < 4 * KEYS / BUCKETS);
+    }
+}
+
+MAC_SET_DEFINE(small_set, 16);
+MAC_MAP_DEFINE(small_map, uint32_t, 16);
+
+/**
+ * @brief Finds count non-zero addresses hashing into the same slot of container with given capacity
+ */
+static void colliding_macs(unsigned capacity, mac_t *macs, unsigned count){
+    unsigned found = 0;
+    unsigned target = mac_hash(1) % capacity;
+    for(mac_t mac = 1; found < count; mac++){
+        if(mac_hash(mac) % capacity == target){
+            macs[found++] = mac;
+        }
+    }
+}
+
+static void test_collision_probing(){
+    mac_t macs[4];
+    colliding_macs(16, macs, 4);
+    mac_set_clear(&small_set);
+    for(unsigned i = 0; i < 4; i++){
+        TEST_ASSERT(mac_set_insert(&small_set, macs[i]));
+        TEST_ASSERT(!mac_set_insert(&small_set, macs[i]));
+    }
+    TEST_ASSERT_EQUAL(4, small_set.count);
+    for(unsigned i = 0; i < 4; i++){
+        TEST_ASSERT(mac_set_contains(&small_set, macs[i]));
+    }
+    TEST_ASSERT(!mac_set_contains(&small_set, macs[3] + 0x1000000));
+
+    mac_map_clear(&small_map);
+    for(unsigned i = 0; i < 4; i++){
+        bool created;
+        uint32_t *value = mac_map_get_or_insert(&small_map, macs[i], &created);
+        TEST_ASSERT(value != NULL);
+        TEST_ASSERT(created);
+        TEST_ASSERT_EQUAL(0, *value);
+        *value = i + 100;
+    }
+    for(unsigned i = 0; i < 4; i++){
+        uint32_t *value = mac_map_get(&small_map, macs[i]);
+        TEST_ASSERT(value != NULL);
+        TEST_ASSERT_EQUAL(i + 100, *value);
+        bool created;
+        TEST_ASSERT(mac_map_get_or_insert(&small_map, macs[i], &created) == value);
+        TEST_ASSERT(!created);
+    }
+    unsigned entries = 0;
+    for(unsigned slot = 0; slot < small_map.capacity; slot++){
+        mac_t mac;
+        if(mac_map_at(&small_map, slot, &mac) != NULL){
+            entries++;
+            TEST_ASSERT(mac_map_get(&small_map, mac) == mac_map_at(&small_map, slot, NULL));
+        }
+    }
+    TEST_ASSERT_EQUAL(4, entries);
+}
+
+static void test_full_table_limit(){
+    // capacity 16 keeps 1/8 of slots empty
+    mac_set_clear(&small_set);
+    unsigned inserted = 0;
+    for(mac_t mac = 1; mac <= 32; mac++){
+        inserted += mac_set_insert(&small_set, mac) ? 1 : 0;
+    }
+    TEST_ASSERT_EQUAL(14, inserted);
+    TEST_ASSERT_EQUAL(14, small_set.count);
+    // probing for missing address terminates on reserved empty slots
+    TEST_ASSERT(!mac_set_contains(&small_set, 0x123456789aULL));
+
+    mac_map_clear(&small_map);
+    for(mac_t mac = 1; mac <= 14; mac++){
+        TEST_ASSERT(mac_map_get_or_insert(&small_map, mac, NULL) != NULL);
+    }
+    TEST_ASSERT(mac_map_get_or_insert(&small_map, 15, NULL) == NULL);
+    TEST_ASSERT(mac_map_get(&small_map, 15) == NULL);
+    TEST_ASSERT_EQUAL(14, small_map.count);
+
+    // tiny containers keep at least one slot empty
+    MAC_SET_DEFINE(tiny_set, 4);
+    for(mac_t mac = 1; mac <= 4; mac++){
+        TEST_ASSERT_EQUAL(mac <= 3, mac_set_insert(&tiny_set, mac));
+    }
+    TEST_ASSERT(!mac_set_contains(&tiny_set, 4));
+}
+
+static void test_zero_key(){
+    mac_set_clear(&small_set);
+    TEST_ASSERT(!mac_set_contains(&small_set, MAC_NONE));
+    TEST_ASSERT(!mac_set_insert(&small_set, MAC_NONE));
+    TEST_ASSERT(mac_set_insert(&small_set, 1));
+    TEST_ASSERT(!mac_set_contains(&small_set, MAC_NONE));
+    TEST_ASSERT_EQUAL(1, small_set.count);
+
+    mac_map_clear(&small_map);
+    bool created = true;
+    TEST_ASSERT(mac_map_get_or_insert(&small_map, MAC_NONE, &created) == NULL);
+    TEST_ASSERT(!created);
+    TEST_ASSERT(mac_map_get(&small_map, MAC_NONE) == NULL);
+    TEST_ASSERT_EQUAL(0, small_map.count);
+}
+
+int main(){
+    RUN_TEST(test_load_store_round_trip);
+    RUN_TEST(test_hash_distribution);
+    RUN_TEST(test_collision_probing);
+    RUN_TEST(test_full_table_limit);
+    RUN_TEST(test_zero_key);
+    return 0;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file test_pcap_serializer.c
+ * @brief Tests PCAP record headers of appended and truncated frames
+ */
+#include <string.h>
+#include "test.h"
+#include "pcap_serializer.h"
+
+#define RADIOTAP_LENGTH sizeof(pcap_radiotap_header_t)
+
+static const pcap_frame_info_t info = { .channel = 6, .rssi = -42, .fcs = true };
+
+static pcap_record_header_t read_record_header(const uint8_t *header){
+    pcap_record_header_t record_header;
+    memcpy(&record_header, header, sizeof(record_header));
+    return record_header;
+}
+
+static void test_append_frame(){
+    uint8_t frame[100];
+    for(unsigned i = 0; i < sizeof(frame); i++){
+        frame[i] = i;
+    }
+    pcap_serializer_init();
+    pcap_serializer_append_frame(frame, sizeof(frame), 3000123, &info);
+    TEST_ASSERT_EQUAL(sizeof(pcap_global_header_t) + PCAP_SERIALIZER_RECORD_HEADER_SIZE + sizeof(frame), pcap_serializer_get_size());
+
+    const uint8_t *record = &pcap_serializer_get_buffer()[sizeof(pcap_global_header_t)];
+    pcap_record_header_t record_header = read_record_header(record);
+    TEST_ASSERT_EQUAL(3, record_header.ts_sec);
+    TEST_ASSERT_EQUAL(123, record_header.ts_usec);
+    TEST_ASSERT_EQUAL(RADIOTAP_LENGTH + sizeof(frame), record_header.incl_len);
+    TEST_ASSERT_EQUAL(RADIOTAP_LENGTH + sizeof(frame), record_header.orig_len);
+    pcap_radiotap_header_t radiotap_header;
+    memcpy(&radiotap_header, &record[sizeof(pcap_record_header_t)], sizeof(radiotap_header));
+    TEST_ASSERT_EQUAL(RADIOTAP_LENGTH, radiotap_header.length);
+    TEST_ASSERT_EQUAL(2437, radiotap_header.channel_frequency);
+    TEST_ASSERT_EQUAL(-42, radiotap_header.antenna_signal);
+    TEST_ASSERT(memcmp(&record[PCAP_SERIALIZER_RECORD_HEADER_SIZE], frame, sizeof(frame)) == 0);
+    pcap_serializer_deinit();
+}
+
+static void test_truncated_frame_keeps_original_length(){
+    pcap_global_header_t global_header;
+    pcap_serializer_write_global_header(&global_header);
+    uint8_t header[PCAP_SERIALIZER_RECORD_HEADER_SIZE];
+
+    unsigned size = pcap_serializer_write_record_header(header, global_header.snaplen - RADIOTAP_LENGTH, 0, &info);
+    TEST_ASSERT_EQUAL(global_header.snaplen - RADIOTAP_LENGTH, size);
+    TEST_ASSERT_EQUAL(global_header.snaplen, read_record_header(header).incl_len);
+    TEST_ASSERT_EQUAL(global_header.snaplen, read_record_header(header).orig_len);
+
+    size = pcap_serializer_write_record_header(header, 70000, 0, &info);
+    TEST_ASSERT_EQUAL(global_header.snaplen - RADIOTAP_LENGTH, size);
+    TEST_ASSERT_EQUAL(global_header.snaplen, read_record_header(header).incl_len);
+    TEST_ASSERT_EQUAL(RADIOTAP_LENGTH + 70000, read_record_header(header).orig_len);
+}
+
+int main(){
+    RUN_TEST(test_append_frame);
+    RUN_TEST(test_truncated_frame_keeps_original_length);
+    return 0;
+}
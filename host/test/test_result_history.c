@@ -0,0 +1,100 @@
+/**
+ * @file test_result_history.c
+ * @brief Tests eviction, session references and dropped payloads of result history
+ */
+#include <string.h>
+#include "test.h"
+#include "result_history.h"
+
+static uint8_t payload[CONFIG_RESULT_HISTORY_MEMORY_BUDGET + 1];
+
+static uint16_t commit_session(uint8_t channel, unsigned pcap_size){
+    result_history_meta_t meta = { .channel = channel };
+    result_history_begin(&meta);
+    memset(payload, channel, pcap_size);
+    result_history_append(RESULT_HISTORY_PAYLOAD_PCAP, payload, pcap_size);
+    return result_history_commit();
+}
+
+static void test_eviction_by_count(){
+    uint16_t first = commit_session(1, 16);
+    TEST_ASSERT(first != 0);
+    for(unsigned i = 1; i < CONFIG_RESULT_HISTORY_MAX_SESSIONS; i++){
+        commit_session(1 + i, 16);
+    }
+    result_history_lock();
+    TEST_ASSERT_EQUAL(CONFIG_RESULT_HISTORY_MAX_SESSIONS, result_history_count());
+    TEST_ASSERT_EQUAL(CONFIG_RESULT_HISTORY_MAX_SESSIONS, result_history_get(0)->meta.channel);
+    result_history_unlock();
+
+    uint16_t newest = commit_session(100, 16);
+    result_history_lock();
+    TEST_ASSERT_EQUAL(CONFIG_RESULT_HISTORY_MAX_SESSIONS, result_history_count());
+    TEST_ASSERT(result_history_find(first) == NULL);
+    TEST_ASSERT_EQUAL(newest, result_history_get(0)->meta.id);
+    result_history_unlock();
+}
+
+static void test_reference_outlives_eviction(){
+    uint16_t id = commit_session(42, 1000);
+    const result_history_session_t *session = result_history_acquire(id);
+    TEST_ASSERT(session != NULL);
+    // whole budget is needed by new sessions, so the referenced one is evicted
+    for(unsigned i = 0; i < CONFIG_RESULT_HISTORY_MAX_SESSIONS; i++){
+        commit_session(i, CONFIG_RESULT_HISTORY_MEMORY_BUDGET / 2);
+    }
+    TEST_ASSERT(result_history_acquire(id) == NULL);
+    // evicted session is still intact for its reader
+    TEST_ASSERT_EQUAL(id, session->meta.id);
+    TEST_ASSERT_EQUAL(1000, session->payload_sizes[RESULT_HISTORY_PAYLOAD_PCAP]);
+    for(unsigned i = 0; i < 1000; i++){
+        TEST_ASSERT_EQUAL(42, session->payloads[RESULT_HISTORY_PAYLOAD_PCAP][i]);
+    }
+    result_history_release(session);
+    result_history_release(NULL);
+}
+
+static void test_eviction_by_budget(){
+    uint16_t first = commit_session(1, CONFIG_RESULT_HISTORY_MEMORY_BUDGET / 2);
+    uint16_t second = commit_session(2, CONFIG_RESULT_HISTORY_MEMORY_BUDGET / 2);
+    commit_session(3, 1);
+    result_history_lock();
+    TEST_ASSERT(result_history_find(first) == NULL);
+    TEST_ASSERT(result_history_find(second) != NULL);
+    result_history_unlock();
+}
+
+static void test_oversized_payload_is_missing(){
+    result_history_meta_t meta = { .channel = 7 };
+    result_history_begin(&meta);
+    TEST_ASSERT_EQUAL(ESP_OK, result_history_append(RESULT_HISTORY_PAYLOAD_PCAP, payload, 100));
+    TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, result_history_append(RESULT_HISTORY_PAYLOAD_PCAP, payload, CONFIG_RESULT_HISTORY_MEMORY_BUDGET));
+    // dropped payload doesn't take later parts either
+    TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, result_history_append(RESULT_HISTORY_PAYLOAD_PCAP, payload, 10));
+    TEST_ASSERT_EQUAL(ESP_OK, result_history_append(RESULT_HISTORY_PAYLOAD_HCCAPX, payload, 393));
+    uint16_t id = result_history_commit();
+
+    const result_history_session_t *session = result_history_acquire(id);
+    TEST_ASSERT(session != NULL);
+    TEST_ASSERT_EQUAL(RESULT_HISTORY_MISSING(RESULT_HISTORY_PAYLOAD_PCAP), session->meta.flags);
+    TEST_ASSERT_EQUAL(0, session->payload_sizes[RESULT_HISTORY_PAYLOAD_PCAP]);
+    TEST_ASSERT(session->payloads[RESULT_HISTORY_PAYLOAD_PCAP] == NULL);
+    TEST_ASSERT_EQUAL(393, session->payload_sizes[RESULT_HISTORY_PAYLOAD_HCCAPX]);
+    result_history_release(session);
+}
+
+static void test_append_without_session(){
+    TEST_ASSERT_EQUAL(0, result_history_commit());
+    TEST_ASSERT(result_history_pending_meta() == NULL);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, result_history_append(RESULT_HISTORY_PAYLOAD_PCAP, payload, 1));
+}
+
+int main(){
+    result_history_init();
+    RUN_TEST(test_append_without_session);
+    RUN_TEST(test_eviction_by_count);
+    RUN_TEST(test_reference_outlives_eviction);
+    RUN_TEST(test_eviction_by_budget);
+    RUN_TEST(test_oversized_payload_is_missing);
+    return 0;
+}
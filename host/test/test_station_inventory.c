@@ -0,0 +1,104 @@
+/**
+ * @file test_station_inventory.c
+ * @brief Tests that station RSSI comes only from frames transmitted by station
+ */
+#include "test.h"
+#include "station_inventory.h"
+
+static const uint8_t bssid[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+static const uint8_t near_sta[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+static const uint8_t far_sta[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x03 };
+
+static station_entry_t find(const uint8_t *mac){
+    station_entry_t station;
+    for(unsigned slot = 0; slot < station_inventory_capacity(); slot++){
+        if(station_inventory_get(slot, &station) && (station.mac == mac_load(mac))){
+            return station;
+        }
+    }
+    TEST_ASSERT(false);
+    return station;
+}
+
+static mac_t strongest_mac(){
+    station_entry_t station;
+    return station_inventory_get_strongest(&station) ? station.mac : 0;
+}
+
+static void test_rssi_unknown_until_station_transmits(){
+    station_inventory_reset();
+    // AP to STA frames carry RSSI of AP
+    station_inventory_update(far_sta, bssid, -20, false, 100, false);
+    station_inventory_update(far_sta, bssid, -20, false, 100, false);
+    station_entry_t station = find(far_sta);
+    TEST_ASSERT(!station.rssi_known);
+    TEST_ASSERT_EQUAL(0, station_inventory_rssi(&station));
+    TEST_ASSERT_EQUAL(2, station.frames);
+    TEST_ASSERT_EQUAL(200, station.bytes);
+    TEST_ASSERT_EQUAL(0, strongest_mac());
+
+    // the first frame from station seeds the average
+    station_inventory_update(far_sta, bssid, -80, true, 100, false);
+    station = find(far_sta);
+    TEST_ASSERT(station.rssi_known);
+    TEST_ASSERT_EQUAL(-80, station_inventory_rssi(&station));
+    TEST_ASSERT_EQUAL(mac_load(far_sta), strongest_mac());
+
+    // later AP frames don't move the average
+    station_inventory_update(far_sta, bssid, -20, false, 100, false);
+    station = find(far_sta);
+    TEST_ASSERT_EQUAL(-80, station_inventory_rssi(&station));
+    TEST_ASSERT_EQUAL(4, station.frames);
+}
+
+static void test_strongest_ignores_ap_rssi(){
+    station_inventory_reset();
+    station_inventory_update(near_sta, bssid, -40, true, 100, false);
+    // strong AP signal must not make far station look strong
+    station_inventory_update(far_sta, bssid, -10, false, 100, false);
+    TEST_ASSERT_EQUAL(mac_load(near_sta), strongest_mac());
+    station_inventory_update(far_sta, bssid, -85, true, 100, false);
+    TEST_ASSERT_EQUAL(mac_load(near_sta), strongest_mac());
+    TEST_ASSERT_EQUAL(2, station_inventory_count());
+}
+
+static void test_rssi_average(){
+    station_inventory_reset();
+    station_inventory_update(near_sta, bssid, -40, true, 100, false);
+    for(unsigned i = 0; i < 100; i++){
+        station_inventory_update(near_sta, bssid, -60, true, 100, false);
+    }
+    station_entry_t station = find(near_sta);
+    TEST_ASSERT_EQUAL(-60, station_inventory_rssi(&station));
+    // average converges the same way when signal gets stronger
+    for(unsigned i = 0; i < 100; i++){
+        station_inventory_update(near_sta, bssid, -45, true, 100, false);
+    }
+    station = find(near_sta);
+    TEST_ASSERT_EQUAL(-45, station_inventory_rssi(&station));
+    for(unsigned i = 0; i < 100; i++){
+        station_inventory_update(near_sta, bssid, -44, true, 100, false);
+    }
+    station = find(near_sta);
+    TEST_ASSERT_EQUAL(-44, station_inventory_rssi(&station));
+}
+
+static void test_copy_survives_reset(){
+    station_inventory_reset();
+    station_inventory_update(near_sta, bssid, -40, true, 100, true);
+    station_entry_t station;
+    TEST_ASSERT(station_inventory_get_strongest(&station));
+    station_inventory_reset();
+    TEST_ASSERT_EQUAL(0, station_inventory_count());
+    TEST_ASSERT_EQUAL(mac_load(near_sta), station.mac);
+    TEST_ASSERT(station.eapol_seen);
+    TEST_ASSERT_EQUAL(-40, station_inventory_rssi(&station));
+}
+
+int main(){
+    RUN_TEST(test_rssi_unknown_until_station_transmits);
+    RUN_TEST(test_strongest_ignores_ap_rssi);
+    RUN_TEST(test_rssi_average);
+    RUN_TEST(test_copy_survives_reset);
+    return 0;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file bench_display.c
+ * @brief Measures rendering of menu screens and traffic of display pipeline on host
+ *
+ * Steps through all menu screens and selections repeatedly. The first pass only renders frames and reports time
+ * to render one frame. The second pass presents every frame and waits until display task flushes it through
+ * display_file_backend (without image file), then reports bytes sent to display per frame compared to full
+ * frame and display metrics.
+ *
+ * Usage: bench_display [<frames>]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "display.h"
+#include "display_file.h"
+#include "display_menu.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "metrics.h"
+
+static esp_err_t print_display_metrics(void *ctx, const char *text){
+    if(strncmp(text, "display_", strlen("display_")) == 0){
+        fputs(text, stdout);
+    }
+    return ESP_OK;
+}
+
+int main(int argc, char **argv){
+    unsigned frames = (argc > 1) ? strtoul(argv[1], NULL, 10) : 10000;
+    static const char *ssids[] = { "HomeNetwork", "CoffeeShop-Guest", "eduroam", "DIRECT-42-Printer" };
+    static const button_event_t steps[] = {
+        { BUTTON_DOWN, BUTTON_EVENT_PRESS }, { BUTTON_DOWN, BUTTON_EVENT_REPEAT }, { BUTTON_UP, BUTTON_EVENT_PRESS },
+        { BUTTON_MIDDLE, BUTTON_EVENT_PRESS }, { BUTTON_DOWN, BUTTON_EVENT_PRESS }, { BUTTON_MIDDLE, BUTTON_EVENT_PRESS },
+        { BUTTON_DOWN, BUTTON_EVENT_PRESS }, { BUTTON_MIDDLE, BUTTON_EVENT_PRESS }, { BUTTON_DOWN, BUTTON_EVENT_REPEAT },
+        { BUTTON_MIDDLE, BUTTON_EVENT_LONG_PRESS }
+    };
+
+    const unsigned step_count = sizeof(steps) / sizeof(steps[0]);
+    display_start(&display_file_backend);
+    display_menu_t menu;
+    display_menu_init(&menu, sizeof(ssids) / sizeof(ssids[0]));
+    char line1[DISPLAY_MENU_LINE_SIZE], line2[DISPLAY_MENU_LINE_SIZE];
+
+    static uint8_t frame[DISPLAY_FRAME_SIZE];
+    int64_t start = esp_timer_get_time();
+    for(unsigned i = 0; i < frames; i++){
+        display_menu_input(&menu, &steps[i % step_count]);
+        display_menu_lines(&menu, ssids[menu.selected_ap], line1, line2);
+        display_menu_draw(frame, line1, line2, NULL);
+    }
+    int64_t render_time = esp_timer_get_time() - start;
+    printf("render: %.2f us/frame (%u frames)\n", (double) render_time / frames, frames);
+
+    unsigned flushed_frames = frames / 10;
+    display_menu_init(&menu, sizeof(ssids) / sizeof(ssids[0]));
+    start = esp_timer_get_time();
+    for(unsigned i = 0; i < flushed_frames; i++){
+        display_menu_input(&menu, &steps[i % step_count]);
+        display_menu_lines(&menu, ssids[menu.selected_ap], line1, line2);
+        display_menu_draw(display_frame(), line1, line2, NULL);
+        memcpy(frame, display_frame(), DISPLAY_FRAME_SIZE);
+        display_present();
+        uint8_t flushed[DISPLAY_FRAME_SIZE];
+        do {
+            display_snapshot(flushed);
+        } while(memcmp(flushed, frame, DISPLAY_FRAME_SIZE) != 0);
+    }
+    int64_t flush_time = esp_timer_get_time() - start;
+
+    unsigned written = display_file_written_bytes();
+    printf("present and flush: %.2f us/frame (%u frames)\n", (double) flush_time / flushed_frames, flushed_frames);
+    printf("sent to display: %.1f B/frame (full frame %u B, %.1f %%)\n", (double) written / flushed_frames,
+        DISPLAY_FRAME_SIZE, 100.0 * written / ((double) flushed_frames * DISPLAY_FRAME_SIZE));
+    metrics_write(print_display_metrics, NULL);
+    return 0;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file bench_gzip_stream.c
+ * @brief Measures compression ratio and throughput of gzip stream on host
+ *
+ * Compresses synthetic PCAP capture, JSON status responses and random data in chunks of the size webserver
+ * sends them, and compares ratio with zlib deflate at levels 1 and 6 (which need far more memory).
+ * Throughput is of host CPU, it's useful to compare changes of compressor, not to predict ESP32 speed.
+ *
+ * Usage: bench_gzip_stream [<kilobytes>]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include "esp_timer.h"
+#include "gzip_stream.h"
+#include "crc32.h"
+#include "synthetic_pcap.h"
+
+#define CHUNK_SIZE 1024
+#define ROUNDS 5
+
+static esp_err_t counting_writer(void *ctx, const uint8_t *data, unsigned length){
+    (void) data;
+    *(unsigned *) ctx += length;
+    return ESP_OK;
+}
+
+static unsigned json_generate(uint8_t *buffer, unsigned size){
+    unsigned length = 0;
+    for(unsigned i = 0; ; i++){
+        char entry[160];
+        int entry_length = snprintf(entry, sizeof(entry),
+            "{\"mac\":\"%02x:%02x:%02x:%02x:%02x:%02x\",\"rssi\":%d,\"frames\":%u,\"last_seen\":%u,\"handshake\":%s},",
+            0x2c, 0x4d, 0x54, i & 0xff, (i * 7) & 0xff, (i * 13) & 0xff, -30 - (int) (i % 60), i * 37 % 5000,
+            i * 1000, (i % 5 == 0) ? "true" : "false");
+        if(length + entry_length > size){
+            return length;
+        }
+        memcpy(&buffer[length], entry, entry_length);
+        length += entry_length;
+    }
+}
+
+static unsigned zlib_compressed_length(const uint8_t *data, unsigned length, int level){
+    uLongf compressed_length = compressBound(length);
+    uint8_t *compressed = malloc(compressed_length);
+    if((compressed == NULL) || (compress2(compressed, &compressed_length, data, length, level) != Z_OK)){
+        compressed_length = 0;
+    }
+    free(compressed);
+    return compressed_length;
+}
+
+static void bench(const char *name, const uint8_t *data, unsigned length){
+    static gzip_stream_t stream;
+    unsigned compressed_length = 0;
+    int64_t start = esp_timer_get_time();
+    for(unsigned round = 0; round < ROUNDS; round++){
+        compressed_length = 0;
+        gzip_stream_init(&stream, counting_writer, &compressed_length);
+        for(unsigned offset = 0; offset < length; offset += CHUNK_SIZE){
+            unsigned chunk = (length - offset < CHUNK_SIZE) ? length - offset : CHUNK_SIZE;
+            gzip_stream_write(&stream, &data[offset], chunk);
+        }
+        gzip_stream_finish(&stream);
+    }
+    int64_t time = esp_timer_get_time() - start;
+    printf("%-7s %8u B -> %8u B, ratio %5.1f %%, %7.1f MB/s | zlib -1 %5.1f %%, zlib -6 %5.1f %%\n", name, length,
+        compressed_length, 100.0 * compressed_length / length, (double) length * ROUNDS / time,
+        100.0 * zlib_compressed_length(data, length, 1) / length, 100.0 * zlib_compressed_length(data, length, 6) / length);
+}
+
+int main(int argc, char **argv){
+    crc32_init();
+    unsigned size = ((argc > 1) ? strtoul(argv[1], NULL, 10) : 4096) * 1024;
+    uint8_t *data = malloc(size);
+    if(data == NULL){
+        return 1;
+    }
+    printf("window %u B, state %u B, chunks of %u B\n", CONFIG_GZIP_STREAM_WINDOW_SIZE, (unsigned) sizeof(gzip_stream_t), CHUNK_SIZE);
+    bench("pcap", data, synthetic_pcap_generate(data, size, 1));
+    bench("json", data, json_generate(data, size));
+    synthetic_random_fill(data, size, 1);
+    bench("random", data, size);
+    free(data);
+    return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file bench_handshake_states.c
+ * @brief Measures per-frame cost of HCCAPX serializer handshake state machine on host
+ *
+ * Replays 4-way handshakes of one AP and station built by synthetic_handshake_frame() through
+ * hccapx_serializer_add_frame() and reports time per frame for:
+ * - handshakes in order, candidate table full after the first two handshakes, so the oldest candidates are replaced
+ * - every frame sent twice, the second copy is retransmission that is only compared with candidates
+ * - ranking of pairs requested after every handshake (cost per ranking, it runs only when HCCAPX is read)
+ *
+ * Usage: bench_handshake_states [<rounds>]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "hccapx_serializer.h"
+#include "synthetic_pcap.h"
+
+#define HANDSHAKES 64
+#define FRAMES (HANDSHAKES * 4)
+
+typedef struct {
+    uint32_t data[(SYNTHETIC_HANDSHAKE_FRAME_MAX + 3) / 4];    //< aligned like radio buffer
+    unsigned length;
+} frame_t;
+
+static frame_t frames[FRAMES];
+
+static uint64_t now_ns(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static void build_frames(){
+    static const uint8_t ap[6] = { 0x02, 0x11, 0x22, 0x33, 0x44, 0x55 };
+    static const uint8_t sta[6] = { 0x02, 0x66, 0x77, 0x88, 0x99, 0xaa };
+    for(unsigned i = 0; i < HANDSHAKES; i++){
+        synthetic_handshake_t handshake;
+        synthetic_handshake_init(&handshake, ap, sta, 1 + 2 * i, i + 1);
+        for(unsigned message = 1; message <= 4; message++){
+            frame_t *frame = &frames[i * 4 + message - 1];
+            frame->length = synthetic_handshake_frame(&handshake, message, (uint8_t *) frame->data);
+        }
+    }
+}
+
+static void session_start(){
+    static const uint8_t ssid[] = "bench";
+    hccapx_serializer_init(ssid, sizeof(ssid) - 1);
+}
+
+static void report(const char *name, uint64_t time_ns, unsigned count, const char *unit){
+    printf("%-16s %8.1f ns/%s (%u %ss)\n", name, (double) time_ns / count, unit, count, unit);
+}
+
+int main(int argc, char **argv){
+    unsigned rounds = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000;
+    build_frames();
+    uint32_t timestamp = 0;
+
+    session_start();
+    uint64_t start = now_ns();
+    for(unsigned round = 0; round < rounds; round++){
+        for(unsigned i = 0; i < FRAMES; i++){
+            hccapx_serializer_add_frame((data_frame_t *) frames[i].data, frames[i].length, timestamp += 1000);
+        }
+    }
+    report("in order", now_ns() - start, rounds * FRAMES, "frame");
+    if(hccapx_serializer_get_state() != HCCAPX_HANDSHAKE_COMPLETE){
+        fprintf(stderr, "Handshake didn't complete, frames aren't valid handshake messages\n");
+        return 1;
+    }
+
+    session_start();
+    start = now_ns();
+    for(unsigned round = 0; round < rounds; round++){
+        for(unsigned i = 0; i < FRAMES; i++){
+            hccapx_serializer_add_frame((data_frame_t *) frames[i].data, frames[i].length, timestamp += 1000);
+            hccapx_serializer_add_frame((data_frame_t *) frames[i].data, frames[i].length, timestamp += 1000);
+        }
+    }
+    report("retransmissions", now_ns() - start, rounds * FRAMES * 2, "frame");
+
+    session_start();
+    uint64_t ranking_time = 0;
+    unsigned rankings = 0;
+    for(unsigned round = 0; round < rounds; round++){
+        for(unsigned i = 0; i < FRAMES; i++){
+            hccapx_serializer_add_frame((data_frame_t *) frames[i].data, frames[i].length, timestamp += 1000);
+            if((i % 4) == 3){
+                start = now_ns();
+                if(hccapx_serializer_get_pair_count() == 0){
+                    fprintf(stderr, "No pair ranked\n");
+                    return 1;
+                }
+                ranking_time += now_ns() - start;
+                rankings++;
+            }
+        }
+    }
+    report("ranking", ranking_time, rankings, "ranking");
+    printf("candidates %u, pairs %u\n", CONFIG_HCCAPX_MAX_CANDIDATES, CONFIG_HCCAPX_MAX_PAIRS);
+    return 0;
+}
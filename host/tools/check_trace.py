@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+"""Checks Chrome trace JSON exported by frame_trace.
+
+Trace must load as JSON and contain complete events of given stages with non-negative durations. Every async
+end must follow its begin and every task in events must have thread name.
+
+Prints duration percentiles of every stage, so traces downloaded from /trace of device under different
+task layouts can be compared.
+
+Usage: check_trace.py <trace.json> [<stage>...]
+"""
+import json
+import sys
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    with open(sys.argv[1]) as trace_file:
+        trace = json.load(trace_file)
+    events = trace['traceEvents']
+    thread_names = {event['tid']: event['args']['name'] for event in events if event['ph'] == 'M'}
+    durations = {}
+    open_async = {}
+    for event in events:
+        phase = event['ph']
+        if phase == 'M':
+            continue
+        if event['tid'] not in thread_names:
+            sys.exit('event of task %s without thread name: %s' % (event['tid'], event))
+        if phase == 'X':
+            if event['dur'] < 0:
+                sys.exit('negative duration: %s' % event)
+            durations.setdefault(event['name'], []).append(event['dur'])
+        elif phase == 'b':
+            open_async[(event['name'], event['id'])] = event['ts']
+        elif phase == 'e':
+            key = (event['name'], event['id'])
+            if key not in open_async:
+                continue
+            # timestamps are lower 32 bits of microseconds since boot
+            dwell = (event['ts'] - open_async.pop(key)) % 2**32
+            if dwell >= 2**31:
+                sys.exit('async end before begin: %s' % event)
+            durations.setdefault(event['name'], []).append(dwell)
+        else:
+            sys.exit('unexpected phase: %s' % event)
+    for stage in sys.argv[2:]:
+        if stage not in durations:
+            sys.exit('no events of stage "%s", found %s' % (stage, ', '.join(sorted(durations))))
+    print('%d events, tasks: %s' % (len(events), ', '.join(sorted(thread_names.values()))))
+    print('%-18s %7s %8s %8s %8s' % ('stage', 'count', 'p50 us', 'p99 us', 'max us'))
+    for name, values in sorted(durations.items()):
+        values.sort()
+        print('%-18s %7d %8d %8d %8d' % (name, len(values), percentile(values, 50), percentile(values, 99), values[-1]))
+
+
+def percentile(sorted_values, percent):
+    return sorted_values[min(len(sorted_values) - 1, len(sorted_values) * percent // 100)]
+
+
+if __name__ == '__main__':
+    main()
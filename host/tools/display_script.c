@@ -0,0 +1,222 @@
+/**
+ * @file display_script.c
+ * @brief Drives display menu by scripted button input on host and compares screens with golden images
+ *
+ * Menu (main/display_menu.c) runs with the real display pipeline and display_file_backend, so screens are
+ * compared as they were flushed to display RAM. Script format is the same as of
+ * components/display/utils/display_script.py, which drives running device:
+ * @code{.unparsed}
+ * click <up|middle|down>              press and release
+ * event <up|middle|down> <press|long|repeat|release>
+ * wait <ms>
+ * screen <name>                       compare display with <golden dir>/<name>.pbm
+ * aps <ssid>...                       host only: replaces scanned APs and returns to the first screen
+ * @endcode
+ *
+ * Usage: display_script [--update] <script> <golden dir> [<image>]
+ *
+ * With --update, golden images are (re)written instead of being compared. Display RAM is written to <image>
+ * (display.pbm by default) after every flush. Exits with non-zero status if any screen differs.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "display.h"
+#include "display_file.h"
+#include "display_menu.h"
+#include "freertos/task.h"
+
+#define MAX_APS 16
+#define FLUSH_TIMEOUT_MS 1000
+
+static display_menu_t menu;
+static char ap_ssids[MAX_APS][33];
+static uint8_t presented[DISPLAY_FRAME_SIZE];
+
+/**
+ * @brief Draws current menu screen and presents it, the same way display UI task does
+ */
+static void render(void){
+    char line1[DISPLAY_MENU_LINE_SIZE], line2[DISPLAY_MENU_LINE_SIZE];
+    display_menu_lines(&menu, ap_ssids[menu.selected_ap], line1, line2);
+    uint8_t *frame = display_frame();
+    display_menu_draw(frame, line1, line2, NULL);
+    memcpy(presented, frame, DISPLAY_FRAME_SIZE);
+    display_present();
+}
+
+/**
+ * @brief Waits until display task flushes the last presented frame
+ */
+static bool wait_flushed(void){
+    uint8_t flushed[DISPLAY_FRAME_SIZE];
+    for(unsigned waited = 0; waited < FLUSH_TIMEOUT_MS; waited++){
+        display_snapshot(flushed);
+        if(memcmp(flushed, presented, DISPLAY_FRAME_SIZE) == 0){
+            return true;
+        }
+        vTaskDelay(1);
+    }
+    return false;
+}
+
+static int parse_button(const char *name){
+    static const char *names[BUTTON_MAX] = { [BUTTON_UP] = "up", [BUTTON_MIDDLE] = "middle", [BUTTON_DOWN] = "down" };
+    for(int i = 0; name && (i < BUTTON_MAX); i++){
+        if(strcmp(name, names[i]) == 0){
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int parse_event(const char *name){
+    static const char *names[] = {
+        [BUTTON_EVENT_PRESS] = "press", [BUTTON_EVENT_LONG_PRESS] = "long",
+        [BUTTON_EVENT_REPEAT] = "repeat", [BUTTON_EVENT_RELEASE] = "release"
+    };
+    for(int i = 0; name && (i < (int) (sizeof(names) / sizeof(names[0]))); i++){
+        if(strcmp(name, names[i]) == 0){
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void input(int button, int type){
+    button_event_t event = { .button = button, .type = type };
+    if(display_menu_input(&menu, &event)){
+        printf("Attack requested: AP %u, type %s, method %u, timeout %us\n", menu.selected_ap,
+            display_menu_type_name(menu.selected_type), menu.selected_method, menu.timeout);
+    }
+    render();
+}
+
+static long read_file(const char *path, uint8_t *buffer, unsigned size){
+    FILE *file = fopen(path, "rb");
+    if(file == NULL){
+        return -1;
+    }
+    long length = fread(buffer, 1, size, file);
+    fclose(file);
+    return length;
+}
+
+static bool write_file(const char *path, const uint8_t *data, unsigned length){
+    FILE *file = fopen(path, "wb");
+    if(file == NULL){
+        return false;
+    }
+    bool written = fwrite(data, 1, length, file) == length;
+    return (fclose(file) == 0) && written;
+}
+
+/**
+ * @brief Compares flushed screen with golden image or updates golden image
+ *
+ * @return true if screen matches or golden image was written
+ */
+static bool check_screen(const char *image_path, const char *golden_dir, const char *name, bool update){
+    uint8_t screen[DISPLAY_FRAME_SIZE + 64];
+    uint8_t golden[DISPLAY_FRAME_SIZE + 64];
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.pbm", golden_dir, name);
+    long screen_length = read_file(image_path, screen, sizeof(screen));
+    if(screen_length < 0){
+        fprintf(stderr, "%s: can't read display image\n", image_path);
+        return false;
+    }
+    if(update){
+        if(!write_file(path, screen, screen_length)){
+            fprintf(stderr, "%s: can't write\n", path);
+            return false;
+        }
+        printf("%s: written\n", path);
+        return true;
+    }
+    long golden_length = read_file(path, golden, sizeof(golden));
+    if((golden_length == screen_length) && (memcmp(golden, screen, screen_length) == 0)){
+        return true;
+    }
+    char actual_path[520];
+    snprintf(actual_path, sizeof(actual_path), "%s.actual", path);
+    write_file(actual_path, screen, screen_length);
+    printf("%s: differs, actual screen saved to %s\n", path, actual_path);
+    return false;
+}
+
+int main(int argc, char **argv){
+    bool update = (argc > 1) && (strcmp(argv[1], "--update") == 0);
+    if(update){
+        argc--;
+        argv++;
+    }
+    if((argc != 3) && (argc != 4)){
+        fprintf(stderr, "Usage: display_script [--update] <script> <golden dir> [<image>]\n");
+        return 2;
+    }
+    const char *script_path = argv[1];
+    const char *golden_dir = argv[2];
+    const char *image_path = (argc == 4) ? argv[3] : "display.pbm";
+    FILE *script = fopen(script_path, "r");
+    if(script == NULL){
+        fprintf(stderr, "%s: can't open\n", script_path);
+        return 2;
+    }
+
+    display_file_set_path(image_path);
+    display_start(&display_file_backend);
+    display_menu_init(&menu, 0);
+    render();
+
+    unsigned failures = 0;
+    char line[256];
+    for(unsigned number = 1; fgets(line, sizeof(line), script) != NULL; number++){
+        char *comment = strchr(line, '#');
+        if(comment != NULL){
+            *comment = '\0';
+        }
+        char *words[1 + MAX_APS] = { NULL };
+        unsigned word_count = 0;
+        for(char *word = strtok(line, " \t\r\n"); (word != NULL) && (word_count < sizeof(words) / sizeof(words[0]));
+            word = strtok(NULL, " \t\r\n")){
+            words[word_count++] = word;
+        }
+        if(word_count == 0){
+            continue;
+        }
+        const char *command = words[0];
+        int button = parse_button(words[1]);
+        if((strcmp(command, "click") == 0) && (button >= 0)){
+            input(button, BUTTON_EVENT_PRESS);
+            input(button, BUTTON_EVENT_RELEASE);
+        }
+        else if((strcmp(command, "event") == 0) && (button >= 0) && (parse_event(words[2]) >= 0)){
+            input(button, parse_event(words[2]));
+        }
+        else if((strcmp(command, "wait") == 0) && (words[1] != NULL)){
+            vTaskDelay(atoi(words[1]));
+        }
+        else if((strcmp(command, "screen") == 0) && (words[1] != NULL)){
+            if(!wait_flushed()){
+                fprintf(stderr, "%s:%u: display didn't flush presented frame\n", script_path, number);
+                return 1;
+            }
+            failures += check_screen(image_path, golden_dir, words[1], update) ? 0 : 1;
+        }
+        else if(strcmp(command, "aps") == 0){
+            unsigned count = 0;
+            for(unsigned i = 1; i < word_count; i++){
+                snprintf(ap_ssids[count++], sizeof(ap_ssids[0]), "%s", words[i]);
+            }
+            display_menu_init(&menu, count);
+            render();
+        }
+        else {
+            fprintf(stderr, "%s:%u: invalid command %s\n", script_path, number, command);
+            return 2;
+        }
+    }
+    fclose(script);
+    return (failures > 0) ? 1 : 0;
+}
@@ -0,0 +1,211 @@
+/**
+ * @file synthetic_pcap.c
+ * @brief Implements deterministic PCAP generator
+ */
+#include "synthetic_pcap.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#define PCAP_GLOBAL_HEADER_LENGTH 24
+#define PCAP_RECORD_HEADER_LENGTH 16
+#define MAX_FRAME_LENGTH 1500
+#define AP_COUNT 4
+
+static uint32_t next_random(uint32_t *state){
+    // xorshift32
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static void put_u32(uint8_t *buffer, uint32_t value){
+    memcpy(buffer, &value, sizeof(value));
+}
+
+static unsigned mac_header(uint8_t *frame, uint16_t frame_control, const uint8_t *addr1, const uint8_t *addr2, const uint8_t *addr3, uint16_t sequence){
+    frame[0] = frame_control & 0xff;
+    frame[1] = frame_control >> 8;
+    frame[2] = 0x3a;
+    frame[3] = 0x01;
+    memcpy(&frame[4], addr1, 6);
+    memcpy(&frame[10], addr2, 6);
+    memcpy(&frame[16], addr3, 6);
+    frame[22] = (sequence << 4) & 0xff;
+    frame[23] = sequence >> 4;
+    return 24;
+}
+
+static unsigned beacon(uint8_t *frame, const uint8_t *bssid, unsigned ap, uint16_t sequence, uint64_t timestamp){
+    static const uint8_t broadcast[6] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+    static const char *ssids[AP_COUNT] = { "HomeNetwork", "CoffeeShop-Guest", "eduroam", "DIRECT-42-Printer" };
+    static const uint8_t rates[] = { 0x01, 0x08, 0x82, 0x84, 0x8b, 0x96, 0x0c, 0x12, 0x18, 0x24 };
+    static const uint8_t rsn[] = { 0x30, 0x14, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x04, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x04,
+        0x01, 0x00, 0x00, 0x0f, 0xac, 0x02, 0x0c, 0x00 };
+    unsigned length = mac_header(frame, 0x0080, broadcast, bssid, bssid, sequence);
+    memcpy(&frame[length], &timestamp, 8);
+    frame[length + 8] = 0x64;
+    frame[length + 9] = 0x00;
+    frame[length + 10] = 0x11;
+    frame[length + 11] = 0x04;
+    length += 12;
+    unsigned ssid_length = strlen(ssids[ap]);
+    frame[length++] = 0;
+    frame[length++] = ssid_length;
+    memcpy(&frame[length], ssids[ap], ssid_length);
+    length += ssid_length;
+    memcpy(&frame[length], rates, sizeof(rates));
+    length += sizeof(rates);
+    frame[length++] = 3;
+    frame[length++] = 1;
+    frame[length++] = 1 + ap * 5;
+    memcpy(&frame[length], rsn, sizeof(rsn));
+    return length + sizeof(rsn);
+}
+
+void synthetic_handshake_init(synthetic_handshake_t *handshake, const uint8_t *ap, const uint8_t *sta, uint64_t replay_counter, uint32_t seed){
+    memcpy(handshake->ap, ap, 6);
+    memcpy(handshake->sta, sta, 6);
+    handshake->replay_counter = replay_counter;
+    handshake->random = (seed != 0) ? seed : 1;
+    for(unsigned i = 0; i < 32; i++){
+        handshake->anonce[i] = next_random(&handshake->random);
+        handshake->snonce[i] = next_random(&handshake->random);
+    }
+}
+
+unsigned synthetic_handshake_frame(synthetic_handshake_t *handshake, unsigned message, uint8_t *frame){
+    // Key Information: descriptor version 2, pairwise, plus Install, Ack, MIC, Secure and Encrypted Key Data bits
+    static const uint16_t key_information[4] = { 0x008a, 0x010a, 0x13ca, 0x030a };
+    static const uint8_t rsn[] = { 0x30, 0x14, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x04, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x04,
+        0x01, 0x00, 0x00, 0x0f, 0xac, 0x02, 0x0c, 0x00 };
+    static const uint8_t llc_snap[] = { 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x88, 0x8e };
+    bool from_ap = (message == 1) || (message == 3);
+    unsigned key_data_length = (message == 2) ? sizeof(rsn) : ((message == 3) ? 56 : 0);
+    unsigned length = from_ap ? mac_header(frame, 0x0208, handshake->sta, handshake->ap, handshake->ap, message)
+        : mac_header(frame, 0x0108, handshake->ap, handshake->sta, handshake->ap, message);
+    memcpy(&frame[length], llc_snap, sizeof(llc_snap));
+    length += sizeof(llc_snap);
+
+    uint8_t *eapol = &frame[length];
+    unsigned body_length = 95 + key_data_length;
+    memset(eapol, 0, 4 + body_length);
+    eapol[0] = 2;
+    eapol[1] = 3;
+    eapol[2] = body_length >> 8;
+    eapol[3] = body_length & 0xff;
+    uint8_t *key = &eapol[4];
+    key[0] = 2;
+    key[1] = key_information[message - 1] >> 8;
+    key[2] = key_information[message - 1] & 0xff;
+    key[4] = 16;
+    uint64_t replay_counter = handshake->replay_counter + ((message >= 3) ? 1 : 0);
+    for(unsigned i = 0; i < 8; i++){
+        key[5 + i] = replay_counter >> (56 - 8 * i);
+    }
+    if(from_ap){
+        memcpy(&key[13], handshake->anonce, 32);
+    }
+    else if(message == 2){
+        memcpy(&key[13], handshake->snonce, 32);
+    }
+    if(message != 1){
+        for(unsigned i = 0; i < 16; i++){
+            key[77 + i] = next_random(&handshake->random);
+        }
+    }
+    key[93] = key_data_length >> 8;
+    key[94] = key_data_length & 0xff;
+    if(message == 2){
+        memcpy(&key[95], rsn, sizeof(rsn));
+    }
+    else if(message == 3){
+        for(unsigned i = 0; i < key_data_length; i++){
+            key[95 + i] = next_random(&handshake->random);
+        }
+    }
+    return length + 4 + body_length;
+}
+
+unsigned synthetic_pcap_generate(uint8_t *buffer, unsigned size, uint32_t seed){
+    uint32_t state = (seed != 0) ? seed : 1;
+    uint8_t aps[AP_COUNT][6];
+    uint8_t stations[AP_COUNT][6];
+    for(unsigned i = 0; i < AP_COUNT; i++){
+        for(unsigned j = 0; j < 6; j++){
+            aps[i][j] = next_random(&state);
+            stations[i][j] = next_random(&state);
+        }
+        aps[i][0] &= 0xfe;
+        stations[i][0] &= 0xfe;
+    }
+    synthetic_handshake_t handshakes[AP_COUNT];
+    unsigned next_messages[AP_COUNT];
+    for(unsigned i = 0; i < AP_COUNT; i++){
+        synthetic_handshake_init(&handshakes[i], aps[i], stations[i], 1, next_random(&state));
+        next_messages[i] = 1;
+    }
+    if(size < PCAP_GLOBAL_HEADER_LENGTH){
+        return 0;
+    }
+    static const uint8_t global_header[PCAP_GLOBAL_HEADER_LENGTH] = {
+        0xd4, 0xc3, 0xb2, 0xa1, 0x02, 0x00, 0x04, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, 0x00, 0x00, 105, 0, 0, 0
+    };
+    memcpy(buffer, global_header, sizeof(global_header));
+    unsigned length = PCAP_GLOBAL_HEADER_LENGTH;
+
+    uint64_t time_usec = 1600000000ull * 1000000;
+    uint16_t sequence = 0;
+    uint8_t frame[MAX_FRAME_LENGTH];
+    while(true){
+        uint32_t random = next_random(&state);
+        unsigned ap = random % AP_COUNT;
+        unsigned kind = (random >> 8) % 16;
+        unsigned frame_length;
+        if(kind < 8){
+            frame_length = beacon(frame, aps[ap], ap, sequence, time_usec);
+        }
+        else if(kind < 10){
+            // probe request with wildcard SSID
+            static const uint8_t broadcast[6] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+            frame_length = mac_header(frame, 0x0040, broadcast, stations[ap], broadcast, sequence);
+            frame[frame_length++] = 0;
+            frame[frame_length++] = 0;
+        }
+        else if(kind < 11){
+            // next message of handshake of the AP, after M4 station reconnects with new nonces
+            frame_length = synthetic_handshake_frame(&handshakes[ap], next_messages[ap], frame);
+            if(++next_messages[ap] > 4){
+                synthetic_handshake_init(&handshakes[ap], aps[ap], stations[ap], handshakes[ap].replay_counter + 2, next_random(&state));
+                next_messages[ap] = 1;
+            }
+        }
+        else {
+            // protected data frame, CCMP header followed by encrypted payload
+            frame_length = mac_header(frame, 0x4208, stations[ap], aps[ap], aps[ap], sequence);
+            unsigned payload_length = 8 + 40 + next_random(&state) % (MAX_FRAME_LENGTH - 24 - 48);
+            for(unsigned i = 0; i < payload_length; i++){
+                frame[frame_length++] = next_random(&state);
+            }
+        }
+        if(length + PCAP_RECORD_HEADER_LENGTH + frame_length > size){
+            return length;
+        }
+        put_u32(&buffer[length], time_usec / 1000000);
+        put_u32(&buffer[length + 4], time_usec % 1000000);
+        put_u32(&buffer[length + 8], frame_length);
+        put_u32(&buffer[length + 12], frame_length);
+        memcpy(&buffer[length + PCAP_RECORD_HEADER_LENGTH], frame, frame_length);
+        length += PCAP_RECORD_HEADER_LENGTH + frame_length;
+        time_usec += 100 + next_random(&state) % 20000;
+        sequence = (sequence + 1) & 0x0fff;
+    }
+}
+
+void synthetic_random_fill(uint8_t *buffer, unsigned size, uint32_t seed){
+    uint32_t state = (seed != 0) ? seed : 1;
+    for(unsigned i = 0; i < size; i++){
+        buffer[i] = next_random(&state);
+    }
+}
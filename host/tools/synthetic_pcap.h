@@ -0,0 +1,75 @@
+/**
+ * @file synthetic_pcap.h
+ * @brief Generates deterministic PCAP captures resembling captures of attacks for host tests and benchmarks
+ */
+#ifndef SYNTHETIC_PCAP_H
+#define SYNTHETIC_PCAP_H
+
+#include <stdint.h>
+
+/**
+ * @brief Fills buffer with PCAP file (global header and whole records)
+ *
+ * Capture mixes beacons of few APs, probe requests, 4-way handshakes (messages of every AP follow in order,
+ * see synthetic_handshake_frame()) and protected data frames with random payload, in the proportions seen
+ * in handshake captures. Records are never cut, rest of buffer after the last
+ * record is not used.
+ *
+ * @param buffer
+ * @param size size of buffer
+ * @param seed seed of pseudo random generator, the same seed gives the same capture
+ * @return unsigned length of generated PCAP
+ */
+unsigned synthetic_pcap_generate(uint8_t *buffer, unsigned size, uint32_t seed);
+
+/**
+ * @brief Maximum length of frame generated by synthetic_handshake_frame()
+ */
+#define SYNTHETIC_HANDSHAKE_FRAME_MAX 192
+
+/**
+ * @brief WPA2 (HMAC-SHA1-AES) 4-way handshake between one AP and one station
+ */
+typedef struct {
+    uint8_t ap[6];
+    uint8_t sta[6];
+    uint64_t replay_counter;    //< replay counter of M1 and M2, M3 and M4 carry the next one
+    uint8_t anonce[32];
+    uint8_t snonce[32];
+    uint32_t random;            //< state of generator of MICs
+} synthetic_handshake_t;
+
+/**
+ * @brief Starts handshake with pseudo random nonces
+ *
+ * @param handshake
+ * @param ap MAC address of AP
+ * @param sta MAC address of station
+ * @param replay_counter replay counter of M1
+ * @param seed
+ */
+void synthetic_handshake_init(synthetic_handshake_t *handshake, const uint8_t *ap, const uint8_t *sta, uint64_t replay_counter, uint32_t seed);
+
+/**
+ * @brief Builds data frame with EAPoL-Key packet of given handshake message
+ *
+ * Key information bits, replay counter, nonces and key data follow 802.11-2016 [12.7.6]. MICs are pseudo random,
+ * every call gives a new one, so repeated call is a different message and not retransmission.
+ *
+ * @param handshake
+ * @param message number of message (1-4)
+ * @param frame output buffer of at least SYNTHETIC_HANDSHAKE_FRAME_MAX bytes
+ * @return unsigned length of frame
+ */
+unsigned synthetic_handshake_frame(synthetic_handshake_t *handshake, unsigned message, uint8_t *frame);
+
+/**
+ * @brief Fills buffer with pseudo random bytes
+ *
+ * @param buffer
+ * @param size
+ * @param seed
+ */
+void synthetic_random_fill(uint8_t *buffer, unsigned size, uint32_t seed);
+
+#endif
@@ -0,0 +1,300 @@
+/**
+ * @file trace_replay.c
+ * @brief Replays capture through host copy of frame processing pipeline and exports frame trace as Chrome trace JSON
+ *
+ * Pipeline mirrors the device with the same trace points and tasks connected by bounded queues:
+ * - "sniffer" task plays promiscuous callback, passes data frames to analyzer
+ * - "analyzer" task parses frames of target AP and passes EAPoL-Key frames on
+ * - "attack" task appends frames to PCAP and updates handshake state
+ *
+ * Target AP is BSSID of the first EAPoL-Key frame. Frames are replayed as fast as pipeline takes them
+ * unless interval between frames is given, so queue dwell shows backlog. Without capture file, synthetic
+ * capture from synthetic_pcap.h is replayed.
+ *
+ * Usage: trace_replay <trace.json> [<capture.pcap>] [--interval <us>]
+ */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "esp_wifi_types.h"
+#include "frame_analyzer_parser.h"
+#include "frame_analyzer_types.h"
+#include "frame_trace.h"
+#include "freertos/task.h"
+#include "hccapx_serializer.h"
+#include "pcap_serializer.h"
+#include "synthetic_pcap.h"
+
+#define SYNTHETIC_CAPTURE_SIZE (1024 * 1024)
+#define PCAP_GLOBAL_HEADER_LENGTH 24
+#define PCAP_RECORD_HEADER_LENGTH 16
+#define PCAP_MAGIC 0xa1b2c3d4
+#define QUEUE_LENGTH 32
+#define MAX_FRAME_LENGTH 4095
+
+/**
+ * @brief Bounded blocking queue of frames, NULL frame ends the stream
+ */
+typedef struct {
+    wifi_promiscuous_pkt_t *frames[QUEUE_LENGTH];
+    unsigned head;
+    unsigned count;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+} frame_queue_t;
+
+static frame_queue_t analyzer_queue = { .lock = PTHREAD_MUTEX_INITIALIZER, .changed = PTHREAD_COND_INITIALIZER };
+static frame_queue_t attack_queue = { .lock = PTHREAD_MUTEX_INITIALIZER, .changed = PTHREAD_COND_INITIALIZER };
+
+static uint8_t *capture;
+static unsigned capture_length;
+static unsigned interval_us;
+static uint8_t target_bssid[6];
+static unsigned drained_tasks;
+
+static struct {
+    unsigned frames;
+    unsigned data_frames;
+    unsigned target_frames;
+    unsigned eapol_key_frames;
+} stats;
+
+static void queue_send(frame_queue_t *queue, wifi_promiscuous_pkt_t *frame){
+    pthread_mutex_lock(&queue->lock);
+    while(queue->count == QUEUE_LENGTH){
+        pthread_cond_wait(&queue->changed, &queue->lock);
+    }
+    queue->frames[(queue->head + queue->count++) % QUEUE_LENGTH] = frame;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+static wifi_promiscuous_pkt_t *queue_receive(frame_queue_t *queue){
+    pthread_mutex_lock(&queue->lock);
+    while(queue->count == 0){
+        pthread_cond_wait(&queue->changed, &queue->lock);
+    }
+    wifi_promiscuous_pkt_t *frame = queue->frames[queue->head];
+    queue->head = (queue->head + 1) % QUEUE_LENGTH;
+    queue->count--;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&queue->lock);
+    return frame;
+}
+
+/**
+ * @brief Reports task drained and parks it, so it stays in task list for thread names of the trace
+ */
+static void task_drained(){
+    __atomic_fetch_add(&drained_tasks, 1, __ATOMIC_RELEASE);
+    while(true){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+
+static bool is_data_frame(const uint8_t *frame, unsigned length){
+    return (length >= sizeof(data_frame_mac_header_t)) && ((frame[0] & 0x0c) == 0x08);
+}
+
+/**
+ * @brief Calls callback with every record of capture, stops when callback returns false
+ */
+static void for_each_record(bool (*callback)(const uint8_t *frame, unsigned length, uint32_t ts_usec)){
+    unsigned offset = PCAP_GLOBAL_HEADER_LENGTH;
+    while(offset + PCAP_RECORD_HEADER_LENGTH <= capture_length){
+        uint32_t ts_sec, ts_usec, length;
+        memcpy(&ts_sec, &capture[offset], 4);
+        memcpy(&ts_usec, &capture[offset + 4], 4);
+        memcpy(&length, &capture[offset + 8], 4);
+        offset += PCAP_RECORD_HEADER_LENGTH;
+        if(length > capture_length - offset){
+            fprintf(stderr, "Truncated record at offset %u\n", offset);
+            return;
+        }
+        if(!callback(&capture[offset], length, ts_sec * 1000000 + ts_usec)){
+            return;
+        }
+        offset += length;
+    }
+}
+
+static bool find_target(const uint8_t *frame, unsigned length, uint32_t ts_usec){
+    (void) ts_usec;
+    if(!is_data_frame(frame, length) || (length > MAX_FRAME_LENGTH)){
+        return true;
+    }
+    // records in capture aren't aligned, parser expects frame aligned like radio buffer
+    static uint32_t aligned[(MAX_FRAME_LENGTH + 3) / 4];
+    memcpy(aligned, frame, length);
+    eapol_packet_t *eapol_packet = parse_eapol_packet((data_frame_t *) aligned);
+    if((eapol_captured_length(aligned, length, eapol_packet) == 0) || (parse_eapol_key_packet(eapol_packet) == NULL)){
+        return true;
+    }
+    memcpy(target_bssid, (const uint8_t *) aligned + offsetof(data_frame_mac_header_t, addr3), sizeof(target_bssid));
+    return false;
+}
+
+static bool sniff_record(const uint8_t *frame, unsigned length, uint32_t ts_usec){
+    if(interval_us > 0){
+        struct timespec delay = { .tv_sec = interval_us / 1000000, .tv_nsec = (interval_us % 1000000) * 1000L };
+        nanosleep(&delay, NULL);
+    }
+    FRAME_TRACE_BEGIN(trace_start);
+    stats.frames++;
+    if(length > MAX_FRAME_LENGTH){
+        length = MAX_FRAME_LENGTH;
+    }
+    if(is_data_frame(frame, length)){
+        wifi_promiscuous_pkt_t *packet = (wifi_promiscuous_pkt_t *) malloc(sizeof(wifi_promiscuous_pkt_t) + length);
+        if(packet != NULL){
+            memset(&packet->rx_ctrl, 0, sizeof(packet->rx_ctrl));
+            packet->rx_ctrl.sig_len = length;
+            packet->rx_ctrl.timestamp = ts_usec;
+            packet->rx_ctrl.channel = 1;
+            packet->rx_ctrl.rssi = -50;
+            memcpy(packet->payload, frame, length);
+            stats.data_frames++;
+            FRAME_TRACE_ASYNC_BEGIN(FRAME_TRACE_STAGE_QUEUE_DWELL, packet->rx_ctrl.timestamp);
+            queue_send(&analyzer_queue, packet);
+        }
+    }
+    FRAME_TRACE_END(FRAME_TRACE_STAGE_SNIFFER_CALLBACK, trace_start);
+    return true;
+}
+
+static void sniffer_task(void *arg){
+    (void) arg;
+    for_each_record(sniff_record);
+    queue_send(&analyzer_queue, NULL);
+    task_drained();
+}
+
+static void analyzer_task(void *arg){
+    (void) arg;
+    wifi_promiscuous_pkt_t *frame;
+    while((frame = queue_receive(&analyzer_queue)) != NULL){
+        FRAME_TRACE_ASYNC_END(FRAME_TRACE_STAGE_QUEUE_DWELL, frame->rx_ctrl.timestamp);
+        if(!is_frame_bssid_matching(frame, target_bssid)){
+            free(frame);
+            continue;
+        }
+        stats.target_frames++;
+        FRAME_TRACE_BEGIN(trace_start);
+        eapol_packet_t *eapol_packet = parse_eapol_packet((data_frame_t *) frame->payload);
+        if(eapol_captured_length(frame->payload, frame->rx_ctrl.sig_len, eapol_packet) == 0){
+            eapol_packet = NULL;
+        }
+        eapol_key_packet_t *eapol_key_packet = parse_eapol_key_packet(eapol_packet);
+        if(eapol_key_packet != NULL){
+            stats.eapol_key_frames++;
+            FRAME_TRACE_ASYNC_BEGIN(FRAME_TRACE_STAGE_QUEUE_DWELL, frame->rx_ctrl.timestamp);
+            queue_send(&attack_queue, frame);
+        }
+        else {
+            free(frame);
+        }
+        FRAME_TRACE_END(FRAME_TRACE_STAGE_ANALYZER_PARSE, trace_start);
+    }
+    queue_send(&attack_queue, NULL);
+    task_drained();
+}
+
+static void attack_task(void *arg){
+    (void) arg;
+    wifi_promiscuous_pkt_t *frame;
+    while((frame = queue_receive(&attack_queue)) != NULL){
+        FRAME_TRACE_ASYNC_END(FRAME_TRACE_STAGE_QUEUE_DWELL, frame->rx_ctrl.timestamp);
+        pcap_frame_info_t frame_info = { .channel = frame->rx_ctrl.channel, .rssi = frame->rx_ctrl.rssi, .fcs = false };
+        FRAME_TRACE_BEGIN(pcap_start);
+        pcap_serializer_append_frame(frame->payload, frame->rx_ctrl.sig_len, frame->rx_ctrl.timestamp, &frame_info);
+        FRAME_TRACE_END(FRAME_TRACE_STAGE_PCAP_APPEND, pcap_start);
+        FRAME_TRACE_BEGIN(handshake_start);
+        hccapx_serializer_add_frame((data_frame_t *) frame->payload, frame->rx_ctrl.sig_len, frame->rx_ctrl.timestamp);
+        FRAME_TRACE_END(FRAME_TRACE_STAGE_HANDSHAKE_UPDATE, handshake_start);
+        free(frame);
+    }
+    task_drained();
+}
+
+static esp_err_t file_writer(void *ctx, const char *text){
+    return (fputs(text, (FILE *) ctx) >= 0) ? ESP_OK : ESP_FAIL;
+}
+
+static bool load_capture(const char *path){
+    FILE *file = fopen(path, "rb");
+    if(file == NULL){
+        perror(path);
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    capture = (uint8_t *) malloc(size > 0 ? size : 1);
+    capture_length = (capture != NULL) ? fread(capture, 1, size, file) : 0;
+    fclose(file);
+    uint32_t magic = 0;
+    if(capture_length >= PCAP_GLOBAL_HEADER_LENGTH){
+        memcpy(&magic, capture, sizeof(magic));
+    }
+    if(magic != PCAP_MAGIC){
+        fprintf(stderr, "%s: not little endian PCAP with microsecond timestamps\n", path);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv){
+    const char *trace_path = NULL;
+    const char *capture_path = NULL;
+    for(int i = 1; i < argc; i++){
+        if((strcmp(argv[i], "--interval") == 0) && (i + 1 < argc)){
+            interval_us = strtoul(argv[++i], NULL, 10);
+        }
+        else if(trace_path == NULL){
+            trace_path = argv[i];
+        }
+        else {
+            capture_path = argv[i];
+        }
+    }
+    if(trace_path == NULL){
+        fprintf(stderr, "Usage: %s <trace.json> [<capture.pcap>] [--interval <us>]\n", argv[0]);
+        return 2;
+    }
+    if(capture_path != NULL){
+        if(!load_capture(capture_path)){
+            return 1;
+        }
+    }
+    else {
+        capture = (uint8_t *) malloc(SYNTHETIC_CAPTURE_SIZE);
+        capture_length = synthetic_pcap_generate(capture, SYNTHETIC_CAPTURE_SIZE, 1);
+    }
+    for_each_record(find_target);
+
+    pcap_serializer_init();
+    static const uint8_t ssid[] = "replay";
+    hccapx_serializer_init(ssid, sizeof(ssid) - 1);
+    xTaskCreatePinnedToCore(attack_task, "attack", 4096, NULL, 6, NULL, 1);
+    xTaskCreatePinnedToCore(analyzer_task, "analyzer", 4096, NULL, 5, NULL, 0);
+    xTaskCreatePinnedToCore(sniffer_task, "sniffer", 4096, NULL, 23, NULL, 0);
+    while(__atomic_load_n(&drained_tasks, __ATOMIC_ACQUIRE) < 3){
+        vTaskDelay(1);
+    }
+
+    FILE *trace = fopen(trace_path, "w");
+    if(trace == NULL){
+        perror(trace_path);
+        return 1;
+    }
+    esp_err_t err = frame_trace_write_json(file_writer, trace);
+    fclose(trace);
+    printf("frames %u, data %u, target %u, EAPoL-Key %u, handshake state %d\n", stats.frames, stats.data_frames,
+        stats.target_frames, stats.eapol_key_frames, hccapx_serializer_get_state());
+    free(capture);
+    return (err == ESP_OK) ? 0 : 1;
+}
@@ -12,118 +12,469 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
-#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#define LOG_LOCAL_LEVEL CONFIG_MAIN_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
 #include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
 
 #include "attack_pmkid.h"
 #include "attack_handshake.h"
 #include "attack_dos.h"
 #include "webserver.h"
 #include "wifi_controller.h"
+#include "frame_analyzer.h"
+#include "pcap_serializer.h"
+#include "hccapx_serializer.h"
+#include "capture_log.h"
+#include "result_history.h"
+#include "task_topology.h"
+#include "metrics.h"
 
 static const char* TAG = "attack";
+
+/**
+ * @brief Reference counted buffer of status content
+ */
+typedef struct {
+    uint32_t refs;      ///< one reference is held while published, one by every snapshot
+    unsigned capacity;
+    char data[];
+} attack_content_t;
+
+#define CONTENT_MIN_CAPACITY 64
+
+/**
+ * @brief Published status
+ *
+ * Header is written under seqlock, so attack_get_status() readers never block. Writers also hold status_lock,
+ * which serialises event loop and esp_timer writers and lets attack_status_acquire() take content reference
+ * before it can be replaced.
+ * @{
+ */
 static attack_status_t attack_status = { .state = READY, .type = -1, .content_size = 0, .content = NULL };
+static attack_content_t *attack_content = NULL;
+static uint32_t status_sequence = 0;
+static portMUX_TYPE status_lock = portMUX_INITIALIZER_UNLOCKED;
+//@}
 static esp_timer_handle_t attack_timeout_handle;
 
-const attack_status_t *attack_get_status() {
-    return &attack_status;
+#define COMMAND_QUEUE_LENGTH 8
+
+/**
+ * @brief Commands processed by orchestrator task
+ */
+typedef enum {
+    ATTACK_COMMAND_START,       ///< start new attack, ignored while an attack is running
+    ATTACK_COMMAND_FINISH,      ///< attack reached its objective
+    ATTACK_COMMAND_TIMEOUT,     ///< attack timeout timer expired
+    ATTACK_COMMAND_RESET,       ///< discard results of finished attack
+    ATTACK_COMMAND_CALL         ///< deferred function of running attack
+} attack_command_type_t;
+
+typedef struct {
+    uint8_t type;               ///< attack_command_type_t
+    uint32_t run;               ///< run that issued FINISH, TIMEOUT and CALL commands, stale commands are ignored
+    union {
+        attack_request_t request;
+        struct {
+            attack_call_t function;
+            void *arg;
+        } call;
+    };
+} attack_command_t;
+
+static QueueHandle_t command_queue;
+static uint32_t current_run = 0;    ///< incremented by orchestrator on every start
+
+static const char *state_names[] = { "READY", "RUNNING", "FINISHED", "TIMEOUT" };
+
+/**
+ * @brief Milestones of the last run
+ * @{
+ */
+static uint32_t run_start_time = 0;                     ///< ms since boot
+static uint32_t milestones[ATTACK_MILESTONE_MAX];       ///< ms since boot, 0 if not reached
+static const char *milestone_names[ATTACK_MILESTONE_MAX] = {
+    "sniffer_start", "first_frame", "first_eapol", "handshake_m1", "handshake_m2",
+    "handshake_m3", "handshake_m4", "first_pmkid", "complete", "stop"
+};
+_Static_assert(ATTACK_MILESTONE_MAX == RESULT_HISTORY_MILESTONES, "result history has to keep all milestones");
+//@}
+
+/**
+ * @brief Time to milestone across runs
+ * @{
+ */
+static const uint32_t milestone_bounds[] = { 100, 250, 500, 1000, 2500, 5000, 10000, 30000, 60000, 120000 };
+#define MILESTONE_HISTOGRAM_DEFINE(var, name) METRICS_HISTOGRAM_DEFINE(var, "attack_milestone_ms", "milestone=\"" name "\"", \
+    "Time from attack start to milestone", milestone_bounds)
+MILESTONE_HISTOGRAM_DEFINE(metric_milestone_sniffer_start, "sniffer_start");
+MILESTONE_HISTOGRAM_DEFINE(metric_milestone_first_frame, "first_frame");
+MILESTONE_HISTOGRAM_DEFINE(metric_milestone_first_eapol, "first_eapol");
+MILESTONE_HISTOGRAM_DEFINE(metric_milestone_handshake_m1, "handshake_m1");
+MILESTONE_HISTOGRAM_DEFINE(metric_milestone_handshake_m2, "handshake_m2");
+MILESTONE_HISTOGRAM_DEFINE(metric_milestone_handshake_m3, "handshake_m3");
+MILESTONE_HISTOGRAM_DEFINE(metric_milestone_handshake_m4, "handshake_m4");
+MILESTONE_HISTOGRAM_DEFINE(metric_milestone_first_pmkid, "first_pmkid");
+MILESTONE_HISTOGRAM_DEFINE(metric_milestone_complete, "complete");
+MILESTONE_HISTOGRAM_DEFINE(metric_milestone_stop, "stop");
+static metrics_metric_t *milestone_metrics[ATTACK_MILESTONE_MAX] = {
+    &metric_milestone_sniffer_start, &metric_milestone_first_frame, &metric_milestone_first_eapol,
+    &metric_milestone_handshake_m1, &metric_milestone_handshake_m2, &metric_milestone_handshake_m3,
+    &metric_milestone_handshake_m4, &metric_milestone_first_pmkid, &metric_milestone_complete, &metric_milestone_stop
+};
+//@}
+
+/**
+ * @brief Starts new session of attack in capture log and result history.
+ * 
+ * Capture log is optional, attack runs even if the log is not mounted.
+ * @param attack_config 
+ */
+static void attack_session_start(const attack_config_t *attack_config){
+    result_history_meta_t meta = {
+        .attack_type = attack_config->type,
+        .attack_method = attack_config->method,
+        .channel = attack_config->ap_record->primary,
+        .ssid_length = strnlen((char *) attack_config->ap_record->ssid, sizeof(meta.ssid)),
+        .start_time = run_start_time
+    };
+    memcpy(meta.bssid, attack_config->ap_record->bssid, sizeof(meta.bssid));
+    memcpy(meta.ssid, attack_config->ap_record->ssid, meta.ssid_length);
+
+    capture_log_session_info_t info = {
+        .attack_type = meta.attack_type,
+        .attack_method = meta.attack_method,
+        .channel = meta.channel,
+        .ssid_length = meta.ssid_length
+    };
+    memcpy(info.bssid, meta.bssid, sizeof(info.bssid));
+    memcpy(info.ssid, meta.ssid, meta.ssid_length);
+    if(capture_log_session_start(&info, &meta.log_session_id) == ESP_OK){
+        ESP_LOGD(TAG, "Capture log session %u started", meta.log_session_id);
+    }
+    result_history_begin(&meta);
+}
+
+/**
+ * @brief Closes session of attack and saves its results into result history.
+ * 
+ * @param outcome state the attack ended with
+ */
+static void attack_session_end(attack_state_t outcome){
+    // static, because orchestrator stack is small
+    static hccapx_t hccapx_pairs[CONFIG_HCCAPX_MAX_PAIRS];
+    capture_log_session_end(outcome);
+
+    result_history_meta_t *meta = result_history_pending_meta();
+    if(meta == NULL){
+        return;
+    }
+    meta->outcome = outcome;
+    meta->end_time = esp_timer_get_time() / 1000;
+    const pmkid_record_t *pmkids = NULL;
+    unsigned pmkid_count = 0;
+    switch(attack_status.type){
+        case ATTACK_TYPE_HANDSHAKE:
+            meta->frames = frame_analyzer_get_stats()->data_frames;
+            meta->handshakes = hccapx_serializer_get_pairs(hccapx_pairs, CONFIG_HCCAPX_MAX_PAIRS);
+            result_history_append(RESULT_HISTORY_PAYLOAD_PCAP, pcap_serializer_get_buffer(), pcap_serializer_get_size());
+            result_history_append(RESULT_HISTORY_PAYLOAD_HCCAPX, hccapx_pairs, meta->handshakes * sizeof(hccapx_t));
+            pmkids = attack_handshake_get_pmkids(&pmkid_count);
+            break;
+        case ATTACK_TYPE_PMKID:
+            meta->frames = frame_analyzer_get_stats()->data_frames;
+            pmkids = attack_pmkid_get_pmkids(&pmkid_count);
+            break;
+        default:
+            break;
+    }
+    meta->pmkids = pmkid_count;
+    attack_get_milestones(meta->milestones);
+    if(pmkid_count > 0){
+        result_history_append(RESULT_HISTORY_PAYLOAD_PMKID, pmkids, pmkid_count * sizeof(pmkid_record_t));
+    }
+    result_history_commit();
+}
+
+/**
+ * @brief Seqlock write section, caller holds status_lock
+ * @{
+ */
+static void status_sequence_begin(){
+    __atomic_store_n(&status_sequence, status_sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static void status_sequence_end(){
+    __atomic_store_n(&status_sequence, status_sequence + 1, __ATOMIC_RELEASE);
+}
+//@}
+
+static void status_write_begin(){
+    portENTER_CRITICAL(&status_lock);
+    status_sequence_begin();
+}
+
+static void status_write_end(){
+    status_sequence_end();
+    portEXIT_CRITICAL(&status_lock);
+}
+
+static void content_release(attack_content_t *content){
+    if((content != NULL) && (__atomic_sub_fetch(&content->refs, 1, __ATOMIC_ACQ_REL) == 0)){
+        free(content);
+    }
+}
+
+/**
+ * @brief Publishes new content buffer and size, caller holds status_lock
+ *
+ * @return attack_content_t* previously published buffer, caller releases it after leaving critical section
+ */
+static attack_content_t *content_publish_locked(attack_content_t *content, unsigned size){
+    status_sequence_begin();
+    attack_content_t *previous = attack_content;
+    attack_content = content;
+    attack_status.content = (content != NULL) ? content->data : NULL;
+    attack_status.content_size = size;
+    status_sequence_end();
+    return (previous != content) ? previous : NULL;
+}
+
+/**
+ * @brief Publishes new content buffer and size, previous buffer is freed when its last snapshot is released
+ */
+static void content_publish(attack_content_t *content, unsigned size){
+    portENTER_CRITICAL(&status_lock);
+    attack_content_t *previous = content_publish_locked(content, size);
+    portEXIT_CRITICAL(&status_lock);
+    content_release(previous);
 }
 
-void attack_update_status(attack_state_t state) {
+/**
+ * @brief Publishes state transition with its timestamp
+ */
+static void state_publish(uint8_t state, uint8_t type){
+    uint32_t now = esp_timer_get_time() / 1000;
+    ESP_LOGI(TAG, "%s -> %s at %u ms", state_names[attack_status.state], state_names[state], now);
+    status_write_begin();
     attack_status.state = state;
-    if(state == FINISHED) {
-        ESP_LOGD(TAG, "Stopping attack timeout timer");
-        ESP_ERROR_CHECK(esp_timer_stop(attack_timeout_handle));
-    } 
+    attack_status.type = type;
+    attack_status.state_time = now;
+    status_write_end();
+}
+
+void attack_get_status(attack_status_t *status) {
+    uint32_t sequence;
+    do {
+        sequence = __atomic_load_n(&status_sequence, __ATOMIC_ACQUIRE);
+        status->state = ((volatile attack_status_t *) &attack_status)->state;
+        status->type = ((volatile attack_status_t *) &attack_status)->type;
+        status->content_size = ((volatile attack_status_t *) &attack_status)->content_size;
+        status->state_time = ((volatile attack_status_t *) &attack_status)->state_time;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while((sequence & 1) || (sequence != __atomic_load_n(&status_sequence, __ATOMIC_RELAXED)));
+    status->content = NULL;
+}
+
+void attack_status_acquire(attack_status_snapshot_t *snapshot) {
+    portENTER_CRITICAL(&status_lock);
+    snapshot->status = attack_status;
+    snapshot->content_ref = attack_content;
+    if(attack_content != NULL){
+        __atomic_add_fetch(&attack_content->refs, 1, __ATOMIC_RELAXED);
+    }
+    portEXIT_CRITICAL(&status_lock);
+}
+
+void attack_status_release(attack_status_snapshot_t *snapshot) {
+    content_release(snapshot->content_ref);
+    snapshot->content_ref = NULL;
+    snapshot->status.content = NULL;
+}
+
+static void milestone_set(attack_milestone_t milestone, uint32_t time){
+    uint32_t not_reached = 0;
+    __atomic_compare_exchange_n(&milestones[milestone], &not_reached, time, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+void attack_milestone(attack_milestone_t milestone){
+    if((milestone >= ATTACK_MILESTONE_MAX) || (__atomic_load_n(&milestones[milestone], __ATOMIC_RELAXED) != 0)){
+        return;
+    }
+    milestone_set(milestone, esp_timer_get_time() / 1000);
+}
+
+/**
+ * @brief Takes over milestones that frame analyzer tracks per frame
+ */
+static void milestones_sync_frame_analyzer(){
+    const frame_analyzer_stats_t *stats = frame_analyzer_get_stats();
+    if(stats->first_data_time >= run_start_time){
+        milestone_set(ATTACK_MILESTONE_FIRST_FRAME, stats->first_data_time);
+    }
+    if(stats->first_eapol_time >= run_start_time){
+        milestone_set(ATTACK_MILESTONE_FIRST_EAPOL, stats->first_eapol_time);
+    }
+}
+
+void attack_get_milestones(uint32_t offsets[ATTACK_MILESTONE_MAX]){
+    if(attack_status.state == RUNNING){
+        milestones_sync_frame_analyzer();
+    }
+    for(unsigned i = 0; i < ATTACK_MILESTONE_MAX; i++){
+        uint32_t time = __atomic_load_n(&milestones[i], __ATOMIC_RELAXED);
+        offsets[i] = (time != 0) ? time - run_start_time : ATTACK_MILESTONE_NOT_REACHED;
+    }
+}
+
+const char *attack_milestone_name(attack_milestone_t milestone){
+    return (milestone < ATTACK_MILESTONE_MAX) ? milestone_names[milestone] : "unknown";
 }
 
-void attack_append_status_content(uint8_t *buffer, unsigned size){
+static attack_content_t *content_alloc(unsigned capacity){
+    if(capacity < CONTENT_MIN_CAPACITY){
+        capacity = CONTENT_MIN_CAPACITY;
+    }
+    attack_content_t *content = malloc(sizeof(attack_content_t) + capacity);
+    if(content == NULL){
+        ESP_LOGE(TAG, "Error allocating status content!");
+        return NULL;
+    }
+    content->refs = 1;
+    content->capacity = capacity;
+    return content;
+}
+
+void attack_append_status_content(const uint8_t *buffer, unsigned size){
     if(size == 0){
-        ESP_LOGE(TAG, "Size can't be 0 if you want to reallocate");
+        ESP_LOGE(TAG, "Size can't be 0 if you want to append");
         return;
     }
-    // temporarily save new location in case of realloc failure to preserve current content
-    char *reallocated_content = realloc(attack_status.content, attack_status.content_size + size);
-    if(reallocated_content == NULL){
-        ESP_LOGE(TAG, "Error reallocating status content! Status content may not be complete.");
+    while(true){
+        portENTER_CRITICAL(&status_lock);
+        unsigned content_size = attack_status.content_size;
+        attack_content_t *base = attack_content;
+        if(content_size + size > ATTACK_STATUS_CONTENT_MAX_SIZE){
+            portEXIT_CRITICAL(&status_lock);
+            ESP_LOGW(TAG, "Status content full, %u bytes not appended", size);
+            return;
+        }
+        if((base != NULL) && (content_size + size <= base->capacity)){
+            // bytes behind published size are not visible to readers until size is published
+            memcpy(&base->data[content_size], buffer, size);
+            content_publish_locked(base, content_size + size);
+            portEXIT_CRITICAL(&status_lock);
+            return;
+        }
+        if(base != NULL){
+            __atomic_add_fetch(&base->refs, 1, __ATOMIC_RELAXED);
+        }
+        portEXIT_CRITICAL(&status_lock);
+
+        // snapshots may still read current buffer, so content is moved into a new one instead of realloc
+        unsigned capacity = (base != NULL) ? base->capacity * 2 : 0;
+        attack_content_t *content = content_alloc((capacity > content_size + size) ? capacity : content_size + size);
+        if(content == NULL){
+            content_release(base);
+            ESP_LOGE(TAG, "Status content may not be complete.");
+            return;
+        }
+        if(content_size > 0){
+            memcpy(content->data, base->data, content_size);
+        }
+        memcpy(&content->data[content_size], buffer, size);
+
+        // content may have been replaced (e.g. by attack_set_status_content()) meanwhile, then append is retried on top of it
+        portENTER_CRITICAL(&status_lock);
+        bool unchanged = (attack_content == base) && (attack_status.content_size == content_size);
+        attack_content_t *previous = unchanged ? content_publish_locked(content, content_size + size) : NULL;
+        portEXIT_CRITICAL(&status_lock);
+        content_release(previous);
+        content_release(base);
+        if(unchanged){
+            return;
+        }
+        content_release(content);
+    }
+}
+
+void attack_set_status_content(const uint8_t *buffer, unsigned size) {
+    attack_content_t *content = content_alloc(size);
+    if(content == NULL){
         return;
     }
-    // copy new data after current content
-    memcpy(&reallocated_content[attack_status.content_size], buffer, size);
-    attack_status.content = reallocated_content;
-    attack_status.content_size += size;
+    memcpy(content->data, buffer, size);
+    content_publish(content, size);
 }
 
-char *attack_alloc_result_content(unsigned size) {
-    attack_status.content_size = size;
-    attack_status.content = (char *) malloc(size);
-    return attack_status.content;
+static void command_post(const attack_command_t *command){
+    if(xQueueSend(command_queue, command, 0) != pdTRUE){
+        ESP_LOGE(TAG, "Command queue full, command %u dropped", command->type);
+    }
+}
+
+void attack_finish(){
+    attack_command_t command = { .type = ATTACK_COMMAND_FINISH, .run = __atomic_load_n(&current_run, __ATOMIC_RELAXED) };
+    command_post(&command);
+}
+
+esp_err_t attack_defer(attack_call_t call, void *arg){
+    attack_command_t command = {
+        .type = ATTACK_COMMAND_CALL,
+        .run = __atomic_load_n(&current_run, __ATOMIC_RELAXED),
+        .call = { .function = call, .arg = arg }
+    };
+    return (xQueueSend(command_queue, &command, 0) == pdTRUE) ? ESP_OK : ESP_ERR_NO_MEM;
 }
 
 /**
  * @brief Callback function for attack timeout timer.
  * 
- * This function is called when attack times out. 
- * It updates attack status state to TIMEOUT.
- * It calls appropriate abort functions based on current attack type.
+ * Runs in esp_timer task, so it only queues timeout command for orchestrator.
  * @param arg not used.
  */
 static void attack_timeout(void* arg){
     ESP_LOGD(TAG, "Attack timed out");
-    
-    attack_update_status(TIMEOUT);
-
-    switch(attack_status.type) {
-        case ATTACK_TYPE_PMKID:
-            ESP_LOGI(TAG, "Aborting PMKID attack...");
-            attack_pmkid_stop();
-            break;
-        case ATTACK_TYPE_HANDSHAKE:
-            ESP_LOGI(TAG, "Abort HANDSHAKE attack...");
-            attack_handshake_stop();
-            break;
-        case ATTACK_TYPE_PASSIVE:
-            ESP_LOGI(TAG, "Abort PASSIVE attack...");
-            break;
-        case ATTACK_TYPE_DOS:
-            ESP_LOGI(TAG, "Abort DOS attack...");
-            attack_dos_stop();
-            break;
-        default:
-            ESP_LOGE(TAG, "Unknown attack type. Not aborting anything");
-    }
+    attack_command_t command = { .type = ATTACK_COMMAND_TIMEOUT, .run = __atomic_load_n(&current_run, __ATOMIC_RELAXED) };
+    command_post(&command);
 }
 
 /**
- * @brief Callback for WEBSERVER_EVENT_ATTACK_REQUEST event.
+ * @brief Starts attack based on request.
  * 
- * This function handles WEBSERVER_EVENT_ATTACK_REQUEST event from event loop.
- * It parses attack_request_t structure and set initial values to attack_status.
  * It sets attack state to RUNNING.
  * It starts attack timeout timer.
  * It starts attack based on chosen type.
+ * Request with unknown AP record is rejected before any state change.
  * 
- * @param args not used
- * @param event_base expects WEBSERVER_EVENTS
- * @param event_id expects WEBSERVER_EVENT_ATTACK_REQUEST
- * @param event_data expects attack_request_t
+ * @param attack_request
  */
-static void attack_request_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+static void attack_start(const attack_request_t *attack_request){
+    if(attack_status.state == RUNNING){
+        ESP_LOGW(TAG, "Attack already running, request ignored");
+        return;
+    }
     ESP_LOGI(TAG, "Starting attack...");
-    attack_request_t *attack_request = (attack_request_t *) event_data;
     attack_config_t attack_config = { .type = attack_request->type, .method = attack_request->method, .timeout = attack_request->timeout };
     attack_config.ap_record = wifictl_get_ap_record(attack_request->ap_record_id);
-    
-    attack_status.state = RUNNING;
-    attack_status.type = attack_config.type;
-
     if(attack_config.ap_record == NULL){
-        ESP_LOGE(TAG, "NPE: No attack_config.ap_record!");
+        // state is left untouched, so the device never gets stuck in RUNNING without timeout
+        ESP_LOGE(TAG, "No AP record with ID %u, attack not started", attack_request->ap_record_id);
         return;
     }
+
+    __atomic_store_n(&current_run, current_run + 1, __ATOMIC_RELAXED);
+    memset(milestones, 0, sizeof(milestones));
+    run_start_time = esp_timer_get_time() / 1000;
+    state_publish(RUNNING, attack_config.type);
+
+    attack_session_start(&attack_config);
     // set timeout
     ESP_ERROR_CHECK(esp_timer_start_once(attack_timeout_handle, attack_config.timeout * 1000000));
     // start attack based on it's type
@@ -145,10 +496,125 @@ static void attack_request_handler(void *args, esp_event_base_t event_base, int3
     }
 }
 
+/**
+ * @brief Stops running attack and closes its session.
+ * 
+ * It calls appropriate abort functions based on current attack type.
+ * @param outcome FINISHED or TIMEOUT
+ */
+static void attack_stop(attack_state_t outcome){
+    // timer is not running if it just expired, which is fine
+    esp_timer_stop(attack_timeout_handle);
+    milestones_sync_frame_analyzer();
+    attack_milestone(ATTACK_MILESTONE_STOP);
+    state_publish(outcome, attack_status.type);
+
+    switch(attack_status.type) {
+        case ATTACK_TYPE_PMKID:
+            ESP_LOGI(TAG, "Stopping PMKID attack...");
+            attack_pmkid_stop();
+            break;
+        case ATTACK_TYPE_HANDSHAKE:
+            ESP_LOGI(TAG, "Stopping HANDSHAKE attack...");
+            attack_handshake_stop();
+            break;
+        case ATTACK_TYPE_PASSIVE:
+            ESP_LOGI(TAG, "Stopping PASSIVE attack...");
+            break;
+        case ATTACK_TYPE_DOS:
+            ESP_LOGI(TAG, "Stopping DOS attack...");
+            attack_dos_stop();
+            break;
+        default:
+            ESP_LOGE(TAG, "Unknown attack type. Not stopping anything");
+    }
+    // attacks may log their results while being stopped, so session is closed afterwards
+    attack_session_end(outcome);
+
+    uint32_t offsets[ATTACK_MILESTONE_MAX];
+    attack_get_milestones(offsets);
+    for(unsigned i = 0; i < ATTACK_MILESTONE_MAX; i++){
+        if(offsets[i] != ATTACK_MILESTONE_NOT_REACHED){
+            metrics_histogram_observe(milestone_metrics[i], offsets[i]);
+        }
+    }
+}
+
+/**
+ * @brief Resets attack status by freeing previously allocated status content and putting attack to READY state.
+ */
+static void attack_reset(){
+    if(attack_status.state == RUNNING){
+        ESP_LOGW(TAG, "Attack is running, reset ignored");
+        return;
+    }
+    ESP_LOGD(TAG, "Resetting attack status...");
+    content_publish(NULL, 0);
+    state_publish(READY, -1);
+}
+
+/**
+ * @brief Orchestrator task that owns attack lifecycle.
+ * 
+ * Processes commands in order they were queued. FINISH, TIMEOUT and CALL commands are applied only to the run
+ * that issued them and only while it is running, so e.g. timeout racing with finish can't stop the next attack.
+ * 
+ * @param arg not used
+ */
+static void attack_task(void *arg){
+    attack_command_t command;
+    while(true){
+        if(xQueueReceive(command_queue, &command, portMAX_DELAY) != pdTRUE){
+            continue;
+        }
+        bool current = (command.run == current_run) && (attack_status.state == RUNNING);
+        switch(command.type){
+            case ATTACK_COMMAND_START:
+                attack_start(&command.request);
+                break;
+            case ATTACK_COMMAND_FINISH:
+                if(current){
+                    attack_stop(FINISHED);
+                }
+                break;
+            case ATTACK_COMMAND_TIMEOUT:
+                if(current){
+                    attack_stop(TIMEOUT);
+                }
+                break;
+            case ATTACK_COMMAND_RESET:
+                attack_reset();
+                break;
+            case ATTACK_COMMAND_CALL:
+                if(current){
+                    command.call.function(command.call.arg);
+                }
+                break;
+            default:
+                ESP_LOGE(TAG, "Unknown command %u", command.type);
+        }
+    }
+}
+
+/**
+ * @brief Callback for WEBSERVER_EVENT_ATTACK_REQUEST event.
+ * 
+ * Queues start command with attack_request_t for orchestrator task.
+ * 
+ * @param args not used
+ * @param event_base expects WEBSERVER_EVENTS
+ * @param event_id expects WEBSERVER_EVENT_ATTACK_REQUEST
+ * @param event_data expects attack_request_t
+ */
+static void attack_request_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+    attack_command_t command = { .type = ATTACK_COMMAND_START, .request = *(attack_request_t *) event_data };
+    command_post(&command);
+}
+
 /**
  * @brief Callback for WEBSERVER_EVENT_ATTACK_RESET event.
  * 
- * This callback resets attack status by freeing previously allocated status content and putting attack to READY state.
+ * Queues reset command for orchestrator task.
  * 
  * @param args not used
  * @param event_base expects WEBSERVER_EVENTS
@@ -156,28 +622,31 @@ static void attack_request_handler(void *args, esp_event_base_t event_base, int3
  * @param event_data not used
  */
 static void attack_reset_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
-    ESP_LOGD(TAG, "Resetting attack status...");
-    if(attack_status.content){
-        free(attack_status.content);
-        attack_status.content = NULL;
-    }
-    attack_status.content_size = 0;
-    attack_status.type = -1;
-    attack_status.state = READY;
+    attack_command_t command = { .type = ATTACK_COMMAND_RESET };
+    command_post(&command);
 }
 
 /**
  * @brief Initialises common attack resources.
  * 
- * Creates attack timeout timer.
+ * Creates attack timeout timer, command queue and orchestrator task.
  * Registers event loop event handlers.
  */
 void attack_init(){
+    result_history_init();
     const esp_timer_create_args_t attack_timeout_args = {
         .callback = &attack_timeout
     };
     ESP_ERROR_CHECK(esp_timer_create(&attack_timeout_args, &attack_timeout_handle));
 
+    for(unsigned i = 0; i < ATTACK_MILESTONE_MAX; i++){
+        metrics_register(milestone_metrics[i]);
+    }
+
+    command_queue = xQueueCreate(COMMAND_QUEUE_LENGTH, sizeof(attack_command_t));
+    xTaskCreatePinnedToCore(attack_task, "attack", TASK_TOPOLOGY_ATTACK_STACK_SIZE, NULL,
+        TASK_TOPOLOGY_ATTACK_PRIORITY, NULL, TASK_TOPOLOGY_ATTACK_CORE);
+
     ESP_ERROR_CHECK(esp_event_handler_register(WEBSERVER_EVENTS, WEBSERVER_EVENT_ATTACK_REQUEST, &attack_request_handler, NULL));
     ESP_ERROR_CHECK(esp_event_handler_register(WEBSERVER_EVENTS, WEBSERVER_EVENT_ATTACK_RESET, &attack_reset_handler, NULL));
-}
\ No newline at end of file
+}
@@ -8,11 +8,16 @@
  * 
  * This file provide interface to control attack wrapper like setting current attack state, 
  * update attack status content, etc...
+ *
+ * Attack lifecycle is owned by orchestrator task. Start, finish, timeout and reset requests from event loop
+ * and timers are queued as commands and processed in order by this task, so blocking Wi-Fi control calls
+ * never run in event loop or esp_timer task that deliver captured frames.
  */
 
 #ifndef ATTACK_H
 #define ATTACK_H
 
+#include <stdint.h>
 #include "esp_wifi_types.h"
 
 /**
@@ -38,6 +43,27 @@ typedef enum {
     TIMEOUT     ///< last attack timed out. This option will be moved as sub category of FINISHED state.
 } attack_state_t;
 
+/**
+ * @brief Milestones of single attack run.
+ *
+ * Every milestone is recorded once per run, when it is reached for the first time.
+ */
+typedef enum {
+    ATTACK_MILESTONE_SNIFFER_START, ///< promiscuous capture started on target channel
+    ATTACK_MILESTONE_FIRST_FRAME,   ///< first data frame from target BSSID
+    ATTACK_MILESTONE_FIRST_EAPOL,   ///< first EAPoL-Key frame from target BSSID
+    ATTACK_MILESTONE_HANDSHAKE_M1,  ///< handshake progressed to M1 (ANonce known)
+    ATTACK_MILESTONE_HANDSHAKE_M2,  ///< handshake progressed to M2 (crackable challenge)
+    ATTACK_MILESTONE_HANDSHAKE_M3,  ///< handshake progressed to M3 (authorized)
+    ATTACK_MILESTONE_HANDSHAKE_M4,  ///< handshake progressed to M4 (complete)
+    ATTACK_MILESTONE_FIRST_PMKID,   ///< first unique PMKID
+    ATTACK_MILESTONE_COMPLETE,      ///< attack objective reached (crackable handshake, PMKID quorum)
+    ATTACK_MILESTONE_STOP,          ///< attack stopped (finished or timed out)
+    ATTACK_MILESTONE_MAX
+} attack_milestone_t;
+
+#define ATTACK_MILESTONE_NOT_REACHED UINT32_MAX
+
 /**
  * @brief Attack config parsed from webserver request
  * 
@@ -50,6 +76,11 @@ typedef struct {
     const wifi_ap_record_t *ap_record;
 } attack_config_t;
 
+/**
+ * @brief Maximum size of status content, it's sent to clients as 16-bit value
+ */
+#define ATTACK_STATUS_CONTENT_MAX_SIZE UINT16_MAX
+
 /**
  * @brief Contains current attack status.
  * 
@@ -58,46 +89,124 @@ typedef struct {
 typedef struct {
     uint8_t state;  ///< attack_state_t
     uint8_t type;   ///< attack_type_t
-    uint16_t content_size;
+    uint16_t content_size;  ///< at most ATTACK_STATUS_CONTENT_MAX_SIZE, appends beyond it are refused
     char *content;
+    uint32_t state_time;    ///< ms since boot when current state was entered
 } attack_status_t;
 
 /**
- * @brief Returns pointer to attack_status_t structure.
- * 
- * @return const attack_status_t*  pointer to the status strucutre
+ * @brief Consistent copy of attack status that keeps its content alive.
+ *
+ * Content is append-only, so bytes within status.content_size never change while snapshot holds reference.
  */
-const attack_status_t *attack_get_status();
+typedef struct {
+    attack_status_t status; ///< status.content points into referenced content buffer or is NULL
+    void *content_ref;      ///< reference released by attack_status_release()
+} attack_status_snapshot_t;
 
 /**
- * @brief Function to update current status of attack.
- * 
- * If FINISHED state is passed, then the attack timeout timer is stopped.
- * @param state new attack state of type attack_state_t to be set
+ * @brief Copies consistent attack status header without content.
+ *
+ * Status is published by seqlock, so this never blocks writers. Content pointer of the copy is always NULL,
+ * use attack_status_acquire() to read content.
+ * @param status copy of current status
+ */
+void attack_get_status(attack_status_t *status);
+
+/**
+ * @brief Takes snapshot of attack status including reference to its content.
+ *
+ * Snapshot stays valid even if status is updated, content is appended or reset meanwhile.
+ * Every snapshot has to be released by attack_status_release().
+ * @param snapshot
+ */
+void attack_status_acquire(attack_status_snapshot_t *snapshot);
+
+/**
+ * @brief Releases content reference held by snapshot.
+ *
+ * @param snapshot
+ */
+void attack_status_release(attack_status_snapshot_t *snapshot);
+
+/**
+ * @brief Function called in orchestrator task
+ *
+ * @param arg argument passed to attack_defer()
  */
-void attack_update_status(attack_state_t state);
+typedef void (*attack_call_t)(void *arg);
+
+/**
+ * @brief Requests finishing of running attack with FINISHED state.
+ *
+ * Attack is stopped asynchronously by orchestrator task. Can be called from any task, e.g. from event handler
+ * that detected attack objective was reached. Repeated requests are ignored.
+ */
+void attack_finish();
+
+/**
+ * @brief Runs function in orchestrator task, e.g. blocking Wi-Fi call requested from timer callback.
+ *
+ * Function is called only if the attack that requested it is still running.
+ * @param call
+ * @param arg
+ * @return esp_err_t
+ *  - ESP_OK if call was queued
+ *  - ESP_ERR_NO_MEM if command queue is full
+ */
+esp_err_t attack_defer(attack_call_t call, void *arg);
+
+/**
+ * @brief Records milestone of running attack, if it was not reached yet in this run.
+ *
+ * Can be called from any task.
+ * @param milestone
+ */
+void attack_milestone(attack_milestone_t milestone);
+
+/**
+ * @brief Returns milestones of the last attack run.
+ *
+ * @param[out] offsets ms since attack start for every attack_milestone_t, ATTACK_MILESTONE_NOT_REACHED if not reached
+ */
+void attack_get_milestones(uint32_t offsets[ATTACK_MILESTONE_MAX]);
+
+/**
+ * @brief Returns short name of milestone, e.g. "first_eapol"
+ *
+ * @param milestone
+ * @return const char*
+ */
+const char *attack_milestone_name(attack_milestone_t milestone);
 
 /**
  * @brief Initialises attack wrapper. This function should be callend only once.
  * 
- * This function creates all necessary resources for attack wrapper. It has to be called before any attack can be run.
+ * This function creates all necessary resources for attack wrapper including orchestrator task.
+ * It has to be called before any attack can be run.
  */
 void attack_init();
 
 /**
- * @brief Allocates status content of given size.
- *  
- * @param size size to be allocated
- * @return char* pointer to newly allocated status content
+ * @brief Replaces status content by given data.
+ *
+ * Content is written by orchestrator task when attack starts or is reset and by event loop handlers
+ * while attack runs. Writers are serialised by status lock, append racing with replacement is applied
+ * on top of the new content. Snapshots holding previous content keep it until released.
+ * @param buffer initial content
+ * @param size size of initial content
  */
-char *attack_alloc_result_content(unsigned size);
+void attack_set_status_content(const uint8_t *buffer, unsigned size);
 
 /**
- * @brief Reallocates current status content and appends new data.
- * 
+ * @brief Appends new data to status content.
+ *
+ * Data is written behind published content, which is moved to larger buffer only if capacity is exhausted.
+ * Append that would grow content beyond ATTACK_STATUS_CONTENT_MAX_SIZE is refused.
+ * See attack_set_status_content() for writer rules.
  * @param buffer new data to be appended to status content
  * @param size size of the new data to be appended
  */
-void attack_append_status_content(uint8_t *buffer, unsigned size);
+void attack_append_status_content(const uint8_t *buffer, unsigned size);
 
 #endif
\ No newline at end of file
@@ -8,7 +8,7 @@
  */
 #include "attack_dos.h"
 
-#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#define LOG_LOCAL_LEVEL CONFIG_MAIN_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 
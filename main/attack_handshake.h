@@ -10,6 +10,7 @@
 #define ATTACK_HANDSHAKE_H
 
 #include "attack.h"
+#include "frame_analyzer.h"
 
 /**
  * @brief Available methods that can be chosen for the attack.
@@ -38,4 +39,12 @@ void attack_handshake_start(attack_config_t *attack_config);
  */
 void attack_handshake_stop();
 
+/**
+ * @brief Returns PMKIDs found in handshake frames during current (or last) handshake attack.
+ * 
+ * @param count output parameter for number of returned records
+ * @return const pmkid_record_t* array of unique PMKID records
+ */
+const pmkid_record_t *attack_handshake_get_pmkids(unsigned *count);
+
 #endif
\ No newline at end of file
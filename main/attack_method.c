@@ -9,7 +9,7 @@
 #include "attack_method.h"
 
 #include <string.h>
-#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#define LOG_LOCAL_LEVEL CONFIG_MAIN_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_timer.h"
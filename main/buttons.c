@@ -0,0 +1,152 @@
+/**
+ * @file buttons.c
+ * @brief Implements interrupt driven button input with timer debouncing
+ *
+ * ISR only masks interrupt of its pin and arms debounce timer. Pin level is then evaluated in esp_timer task,
+ * which also runs hold timers, so button state is never touched concurrently.
+ */
+#include "buttons.h"
+
+#define LOG_LOCAL_LEVEL CONFIG_MAIN_LOG_LEVEL
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "driver/gpio.h"
+#include "freertos/queue.h"
+
+#include "metrics.h"
+
+static const char *TAG = "buttons";
+
+#define EVENT_QUEUE_LENGTH 16
+
+static const gpio_num_t button_gpios[BUTTON_MAX] = {
+    [BUTTON_UP] = 21,
+    [BUTTON_MIDDLE] = 19,
+    [BUTTON_DOWN] = 18
+};
+
+typedef struct {
+    esp_timer_handle_t debounce_timer;
+    esp_timer_handle_t hold_timer;
+    bool pressed;               ///< last stable state
+    bool long_pressed;          ///< long press event was already sent for current hold
+} button_t;
+
+static button_t buttons[BUTTON_MAX];
+static QueueHandle_t event_queue = NULL;
+
+METRICS_COUNTER_DEFINE(metric_dropped_events, "button_dropped_events_total", NULL, "Button events dropped because UI didn't keep up");
+
+static void IRAM_ATTR button_isr(void *arg){
+    button_id_t id = (button_id_t) (uintptr_t) arg;
+    gpio_intr_disable(button_gpios[id]);
+    esp_timer_start_once(buttons[id].debounce_timer, CONFIG_BUTTONS_DEBOUNCE_MS * 1000);
+}
+
+static void post_event(button_id_t id, button_event_type_t type){
+    button_event_t event = { .button = id, .type = type };
+    if(xQueueSend(event_queue, &event, 0) != pdTRUE){
+        metrics_counter_inc(&metric_dropped_events);
+    }
+}
+
+/**
+ * @brief Evaluates stable level of button and re-enables its interrupt
+ */
+static void debounce_timer_callback(void *arg){
+    button_id_t id = (button_id_t) (uintptr_t) arg;
+    button_t *button = &buttons[id];
+    bool pressed = gpio_get_level(button_gpios[id]) == 1;
+    if(pressed != button->pressed){
+        button->pressed = pressed;
+        if(pressed){
+            button->long_pressed = false;
+            post_event(id, BUTTON_EVENT_PRESS);
+            esp_timer_start_once(button->hold_timer, CONFIG_BUTTONS_LONG_PRESS_MS * 1000);
+        }
+        else {
+            esp_timer_stop(button->hold_timer);
+            post_event(id, BUTTON_EVENT_RELEASE);
+        }
+    }
+    gpio_intr_enable(button_gpios[id]);
+    // edge that came while interrupt was masked would be lost otherwise
+    if((gpio_get_level(button_gpios[id]) == 1) != button->pressed){
+        gpio_intr_disable(button_gpios[id]);
+        esp_timer_start_once(button->debounce_timer, CONFIG_BUTTONS_DEBOUNCE_MS * 1000);
+    }
+}
+
+/**
+ * @brief Sends long press once button is held long enough and repeats while it's held
+ */
+static void hold_timer_callback(void *arg){
+    button_id_t id = (button_id_t) (uintptr_t) arg;
+    button_t *button = &buttons[id];
+    if(!button->pressed){
+        return;
+    }
+    post_event(id, button->long_pressed ? BUTTON_EVENT_REPEAT : BUTTON_EVENT_LONG_PRESS);
+    button->long_pressed = true;
+    esp_timer_start_once(button->hold_timer, CONFIG_BUTTONS_REPEAT_PERIOD_MS * 1000);
+}
+
+esp_err_t buttons_init(void){
+    event_queue = xQueueCreate(EVENT_QUEUE_LENGTH, sizeof(button_event_t));
+    if(event_queue == NULL){
+        return ESP_ERR_NO_MEM;
+    }
+    metrics_register(&metric_dropped_events);
+
+    gpio_config_t config = {
+        .pin_bit_mask = 0,
+        .mode = GPIO_MODE_INPUT,
+        .pull_down_en = GPIO_PULLDOWN_ENABLE,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .intr_type = GPIO_INTR_ANYEDGE
+    };
+    for(unsigned i = 0; i < BUTTON_MAX; i++){
+        config.pin_bit_mask |= 1ULL << button_gpios[i];
+    }
+    esp_err_t err = gpio_config(&config);
+    if(err != ESP_OK){
+        return err;
+    }
+    err = gpio_install_isr_service(0);
+    if((err != ESP_OK) && (err != ESP_ERR_INVALID_STATE)){
+        // ESP_ERR_INVALID_STATE means service was already installed by someone else
+        return err;
+    }
+
+    for(unsigned i = 0; i < BUTTON_MAX; i++){
+        const esp_timer_create_args_t debounce_timer_args = {
+            .callback = &debounce_timer_callback,
+            .arg = (void *) (uintptr_t) i
+        };
+        const esp_timer_create_args_t hold_timer_args = {
+            .callback = &hold_timer_callback,
+            .arg = (void *) (uintptr_t) i
+        };
+        if(((err = esp_timer_create(&debounce_timer_args, &buttons[i].debounce_timer)) != ESP_OK)
+            || ((err = esp_timer_create(&hold_timer_args, &buttons[i].hold_timer)) != ESP_OK)
+            || ((err = gpio_isr_handler_add(button_gpios[i], &button_isr, (void *) (uintptr_t) i)) != ESP_OK)){
+            return err;
+        }
+    }
+    ESP_LOGD(TAG, "Buttons initialised");
+    return ESP_OK;
+}
+
+bool buttons_receive(button_event_t *event, TickType_t wait){
+    return xQueueReceive(event_queue, event, wait) == pdTRUE;
+}
+
+esp_err_t buttons_inject(const button_event_t *event){
+    if((event->button >= BUTTON_MAX) || (event->type > BUTTON_EVENT_RELEASE)){
+        return ESP_ERR_INVALID_ARG;
+    }
+    if(event_queue == NULL){
+        return ESP_ERR_INVALID_STATE;
+    }
+    return (xQueueSend(event_queue, event, 0) == pdTRUE) ? ESP_OK : ESP_ERR_NO_MEM;
+}
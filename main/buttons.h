@@ -0,0 +1,68 @@
+/**
+ * @file buttons.h
+ * @brief Provides debounced button events for display UI
+ *
+ * Buttons are read by GPIO interrupts. Every edge disables interrupt of its pin and starts debounce timer,
+ * the pin is sampled once the timer expires. Stable changes are turned into events in a queue:
+ * press, long press after CONFIG_BUTTONS_LONG_PRESS_MS of holding, then repeat every CONFIG_BUTTONS_REPEAT_PERIOD_MS
+ * until release.
+ */
+#ifndef BUTTONS_H
+#define BUTTONS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+/**
+ * @brief Buttons of joystick
+ */
+typedef enum {
+    BUTTON_UP,
+    BUTTON_MIDDLE,
+    BUTTON_DOWN,
+    BUTTON_MAX
+} button_id_t;
+
+/**
+ * @brief Event types in order in which they come for single hold of button
+ */
+typedef enum {
+    BUTTON_EVENT_PRESS,         ///< button went down
+    BUTTON_EVENT_LONG_PRESS,    ///< button is held for CONFIG_BUTTONS_LONG_PRESS_MS
+    BUTTON_EVENT_REPEAT,        ///< button is still held, sent every CONFIG_BUTTONS_REPEAT_PERIOD_MS after long press
+    BUTTON_EVENT_RELEASE        ///< button went up
+} button_event_type_t;
+
+typedef struct {
+    uint8_t button;             ///< button_id_t
+    uint8_t type;               ///< button_event_type_t
+} button_event_t;
+
+/**
+ * @brief Configures button GPIOs, their interrupts and debounce timers.
+ *
+ * @return esp_err_t ESP_OK or error from GPIO or timer setup
+ */
+esp_err_t buttons_init(void);
+
+/**
+ * @brief Waits for next button event.
+ *
+ * @param[out] event
+ * @param wait maximum time to wait, portMAX_DELAY to sleep until a button is used
+ * @return true if event was received, false on timeout
+ */
+bool buttons_receive(button_event_t *event, TickType_t wait);
+
+/**
+ * @brief Queues event as if it came from hardware. Used for scripted input from webserver.
+ *
+ * @param event
+ * @return esp_err_t ESP_OK, ESP_ERR_INVALID_ARG for unknown button or event type, ESP_ERR_INVALID_STATE
+ *  if buttons are not initialised or ESP_ERR_NO_MEM if queue is full
+ */
+esp_err_t buttons_inject(const button_event_t *event);
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @file display_menu.c
+ * @brief Implements menu state machine of display UI
+ */
+#include "display_menu.h"
+
+#include <stdio.h>
+#include "attack.h"
+#include "display_draw.h"
+
+static const char *attack_type_names[] = { "PASSIVE", "HANDSHAKE", "PMKID", "DOS" };
+static const char *handshake_methods[] = { "ROGUE_AP", "BROADCAST", "PASSIVE" };
+static const char *dos_methods[] = { "ROGUE_AP", "BROADCAST", "COMBINE" };
+static const char *pmkid_methods[] = { "SINGLE", "ESS" };
+
+void display_menu_init(display_menu_t *menu, unsigned ap_count){
+    menu->screen = DISPLAY_MENU_AP;
+    menu->selected_ap = 0;
+    menu->selected_type = ATTACK_TYPE_HANDSHAKE;
+    menu->selected_method = 0;
+    menu->timeout = 30;
+    menu->ap_count = ap_count;
+}
+
+const char *display_menu_type_name(uint8_t type){
+    return (type < sizeof(attack_type_names) / sizeof(attack_type_names[0])) ? attack_type_names[type] : "?";
+}
+
+/**
+ * @brief Returns number of methods of attack type, 0 if methods are not named
+ */
+static unsigned method_count(uint8_t type){
+    switch(type){
+        case ATTACK_TYPE_HANDSHAKE:
+            return 3;
+        case ATTACK_TYPE_DOS:
+            return 3;
+        case ATTACK_TYPE_PMKID:
+            return 2;
+        default:
+            return 0;
+    }
+}
+
+bool display_menu_input(display_menu_t *menu, const button_event_t *event){
+    if(event->type == BUTTON_EVENT_RELEASE){
+        return false;
+    }
+    // holding up or down auto-repeats, holding middle goes back to the first menu
+    switch(event->button){
+        case BUTTON_UP:
+            if(menu->screen == DISPLAY_MENU_AP && menu->ap_count > 0){ if(menu->selected_ap > 0) menu->selected_ap--; }
+            else if(menu->screen == DISPLAY_MENU_TYPE){ if(menu->selected_type > 0) menu->selected_type--; }
+            else if(menu->screen == DISPLAY_MENU_METHOD){ if(menu->selected_method > 0) menu->selected_method--; }
+            else if(menu->screen == DISPLAY_MENU_TIMEOUT){ if(menu->timeout > 5) menu->timeout -= 5; }
+            break;
+        case BUTTON_DOWN:
+            if(menu->screen == DISPLAY_MENU_AP && menu->ap_count > 0){ if(menu->selected_ap + 1 < menu->ap_count) menu->selected_ap++; }
+            else if(menu->screen == DISPLAY_MENU_TYPE){ if(menu->selected_type < 3) menu->selected_type++; }
+            else if(menu->screen == DISPLAY_MENU_METHOD){
+                unsigned methods = method_count(menu->selected_type);
+                menu->selected_method = (methods > 0) ? (menu->selected_method + 1) % methods : menu->selected_method + 1;
+            }
+            else if(menu->screen == DISPLAY_MENU_TIMEOUT){ if(menu->timeout <= 250) menu->timeout += 5; }
+            break;
+        case BUTTON_MIDDLE:
+            if(event->type == BUTTON_EVENT_LONG_PRESS){
+                menu->screen = DISPLAY_MENU_AP;
+            } else if(event->type == BUTTON_EVENT_PRESS){
+                if(menu->screen == DISPLAY_MENU_START){
+                    return true;
+                }
+                menu->screen = (menu->screen + 1) % DISPLAY_MENU_MAX;
+            }
+            break;
+    }
+    return false;
+}
+
+void display_menu_lines(const display_menu_t *menu, const char *ssid, char *line1, char *line2){
+    line1[0] = '\0';
+    line2[0] = '\0';
+    unsigned methods;
+    switch(menu->screen){
+        case DISPLAY_MENU_AP:
+            snprintf(line1, DISPLAY_MENU_LINE_SIZE, "AP %u/%u", menu->selected_ap + 1, menu->ap_count);
+            if(menu->ap_count > 0){
+                snprintf(line2, DISPLAY_MENU_LINE_SIZE, "%.32s", ssid);
+            } else snprintf(line2, DISPLAY_MENU_LINE_SIZE, "No APs found");
+            break;
+        case DISPLAY_MENU_TYPE:
+            snprintf(line1, DISPLAY_MENU_LINE_SIZE, "Type: %s", display_menu_type_name(menu->selected_type));
+            snprintf(line2, DISPLAY_MENU_LINE_SIZE, "Use joystick");
+            break;
+        case DISPLAY_MENU_METHOD:
+            methods = method_count(menu->selected_type);
+            if(menu->selected_type == ATTACK_TYPE_HANDSHAKE){
+                snprintf(line1, DISPLAY_MENU_LINE_SIZE, "Method: %s", handshake_methods[menu->selected_method % methods]);
+            } else if(menu->selected_type == ATTACK_TYPE_DOS){
+                snprintf(line1, DISPLAY_MENU_LINE_SIZE, "Method: %s", dos_methods[menu->selected_method % methods]);
+            } else if(menu->selected_type == ATTACK_TYPE_PMKID){
+                snprintf(line1, DISPLAY_MENU_LINE_SIZE, "Method: %s", pmkid_methods[menu->selected_method % methods]);
+            } else {
+                snprintf(line1, DISPLAY_MENU_LINE_SIZE, "Method: %u", menu->selected_method);
+            }
+            snprintf(line2, DISPLAY_MENU_LINE_SIZE, "(press to next)");
+            break;
+        case DISPLAY_MENU_TIMEOUT:
+            snprintf(line1, DISPLAY_MENU_LINE_SIZE, "Timeout: %us", menu->timeout);
+            snprintf(line2, DISPLAY_MENU_LINE_SIZE, "Press to edit");
+            break;
+        case DISPLAY_MENU_START:
+            snprintf(line1, DISPLAY_MENU_LINE_SIZE, "Start");
+            snprintf(line2, DISPLAY_MENU_LINE_SIZE, "Press to confirm");
+            break;
+    }
+}
+
+void display_menu_draw(uint8_t *frame, const char *line1, const char *line2, const char *line3){
+    display_draw_clear(frame);
+    display_draw_text(frame, 0, 0, line1 ? line1 : "");
+    display_draw_text(frame, 0, 32, line2 ? line2 : "");  // page 4 (32px)
+    display_draw_text(frame, 0, 48, line3 ? line3 : "");  // page 6 (48px)
+}
@@ -0,0 +1,85 @@
+/**
+ * @file display_menu.h
+ * @brief Menu state machine of display UI, independent of buttons driver, Wi-Fi and attack tasks
+ *
+ * Kept apart from display_ui.c, so menu flows can be driven by scripted input and rendered on host.
+ */
+#ifndef DISPLAY_MENU_H
+#define DISPLAY_MENU_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "buttons.h"
+
+/**
+ * @brief Size of one text line buffer, longer text is clipped by display anyway
+ */
+#define DISPLAY_MENU_LINE_SIZE 33
+
+typedef enum {
+    DISPLAY_MENU_AP,
+    DISPLAY_MENU_TYPE,
+    DISPLAY_MENU_METHOD,
+    DISPLAY_MENU_TIMEOUT,
+    DISPLAY_MENU_START,
+    DISPLAY_MENU_MAX
+} display_menu_screen_t;
+
+/**
+ * @brief Menu state and attack selected by user
+ */
+typedef struct {
+    uint8_t screen;             ///< display_menu_screen_t
+    uint8_t selected_ap;        ///< index of AP record
+    uint8_t selected_type;      ///< attack_type_t
+    uint8_t selected_method;
+    uint8_t timeout;            ///< seconds
+    unsigned ap_count;
+} display_menu_t;
+
+/**
+ * @brief Sets menu to the first screen with default attack selection
+ *
+ * @param menu
+ * @param ap_count number of scanned AP records
+ */
+void display_menu_init(display_menu_t *menu, unsigned ap_count);
+
+/**
+ * @brief Moves menu by button event
+ *
+ * Up and down change selection on every press, long press and repeat. Middle press moves to the next screen,
+ * long press of middle returns to the first screen. Release is ignored.
+ *
+ * @param menu
+ * @param event
+ * @return true if user confirmed start of selected attack
+ */
+bool display_menu_input(display_menu_t *menu, const button_event_t *event);
+
+/**
+ * @brief Formats text of current screen
+ *
+ * @param menu
+ * @param ssid SSID of selected AP, ignored if there are no AP records
+ * @param[out] line1 DISPLAY_MENU_LINE_SIZE bytes
+ * @param[out] line2 DISPLAY_MENU_LINE_SIZE bytes
+ */
+void display_menu_lines(const display_menu_t *menu, const char *ssid, char *line1, char *line2);
+
+/**
+ * @brief Returns name of attack type shown in menu
+ */
+const char *display_menu_type_name(uint8_t type);
+
+/**
+ * @brief Draws UI screen layout: first line on top, second and third line in the lower half
+ *
+ * @param frame framebuffer (see display_draw.h)
+ * @param line1 may be NULL
+ * @param line2 may be NULL
+ * @param line3 may be NULL
+ */
+void display_menu_draw(uint8_t *frame, const char *line1, const char *line2, const char *line3);
+
+#endif
@@ -11,7 +11,7 @@
 
 #include <stdio.h>
 
-#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#define LOG_LOCAL_LEVEL CONFIG_MAIN_LOG_LEVEL
 #include "esp_log.h"
 #include "esp_event.h"
 
@@ -20,15 +20,21 @@
 #include "webserver.h"
 #include "wifi_scan.h"
 #include "display_ui.h"
+#include "capture_log.h"
+#include "crc32.h"
 
 static const char* TAG = "main";
 
 void app_main(void)
 {
     ESP_LOGD(TAG, "app_main started");
+    // CRC tables are shared by sniffer, capture log and gzip stream tasks
+    crc32_init();
     ESP_ERROR_CHECK(esp_event_loop_create_default());
     wifictl_mgmt_ap_start();
     wifi_scan_print_serial();
+    // capture log is optional, e.g. when flashed with default partition table
+    ESP_ERROR_CHECK_WITHOUT_ABORT(capture_log_init());
     attack_init();
     // start Display UI (joystick + OLED) to configure attacks
     display_ui_start();